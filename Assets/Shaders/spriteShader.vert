@@ -1,7 +1,12 @@
 #version 330 core
 
-uniform mat4 projectionMatrix;
-uniform mat4 viewMatrix;
+// Shared by all sprite shaders and updated once per camera (see UniformBuffer)
+layout (std140) uniform CameraData
+{
+	mat4 projectionMatrix;
+	mat4 viewMatrix;
+};
+
 uniform mat4 worldMatrix;
 uniform vec2 uvOffset;
 uniform vec2 uvStride;
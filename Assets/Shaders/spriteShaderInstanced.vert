@@ -0,0 +1,41 @@
+#version 330 core
+
+// Shared by all sprite shaders and updated once per camera (see UniformBuffer)
+layout (std140) uniform CameraData
+{
+	mat4 projectionMatrix;
+	mat4 viewMatrix;
+};
+
+layout (location = 0) in vec4 positionAttribute;
+layout (location = 1) in vec4 vertexColorAttribute;
+layout (location = 2) in vec2 textureCoordinateAttribute;
+
+// Per-instance attributes (see SpriteBatch)
+layout (location = 3) in vec4 instanceBasis;
+layout (location = 4) in vec4 instanceTranslation;
+layout (location = 5) in vec4 instanceUV;
+layout (location = 6) in vec4 instanceColor;
+
+out vec4 vertexColor;
+out vec2 textureCoordinate;
+
+void main()										
+{
+	// Blend color varies per sprite, so apply it to the vertex color
+	vertexColor = vertexColorAttribute * instanceColor;
+
+	// Calculate appropriate UV based on frame offset and stride (flipping is
+	// done by the batch using a negative stride)
+	textureCoordinate = instanceUV.xy + textureCoordinateAttribute * instanceUV.zw;
+
+	// Rebuild world matrix from 2D basis, translation, and depth
+	mat4 worldMatrix = mat4(
+		vec4(instanceBasis.xy, 0.0, 0.0),
+		vec4(instanceBasis.zw, 0.0, 0.0),
+		vec4(0.0, 0.0, 1.0, 0.0),
+		vec4(instanceTranslation.xyz, 1.0));
+
+	// Calculate vertex position using transform matrices
+	gl_Position = projectionMatrix * viewMatrix * worldMatrix * positionAttribute;
+}
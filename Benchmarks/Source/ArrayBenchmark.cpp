@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ArrayBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Benchmark.h"
+
+#include <Array.h>
+
+#include <string>
+#include <utility>		// move, swap
+#include <vector>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Counts how many instances are alive, to check that arrays destroy their elements
+	struct Counted
+	{
+		Counted() { ++alive; }
+		Counted(const Counted&) { ++alive; }
+		Counted(Counted&&) { ++alive; }
+		~Counted() { --alive; }
+		Counted& operator=(const Counted&) = default;
+		Counted& operator=(Counted&&) = default;
+
+		static int alive;
+	};
+
+	int Counted::alive = 0;
+
+	// Checks that Array destroys the elements it removes.
+	void CheckDestruction()
+	{
+		{
+			Array<Counted> counted;
+			for (int i = 0; i < 10; ++i)
+				counted.EmplaceBack();
+
+			counted.SwapErase(counted.Begin());
+			counted.Erase(counted.Begin());
+			counted.PopBack();
+			Benchmarks::Check(Counted::alive == 7, "Array::Erase, SwapErase, or PopBack leaks elements");
+
+			counted.Resize(3);
+			Benchmarks::Check(Counted::alive == 3, "Array::Resize leaks removed elements");
+
+			counted.Clear();
+			Benchmarks::Check(Counted::alive == 0, "Array::Clear leaks elements");
+
+			counted.Resize(5);
+		}
+		Benchmarks::Check(Counted::alive == 0, "Array destructor leaks elements");
+
+		// Same for elements stored inside the array
+		{
+			Array<Counted, 4> counted;
+			for (int i = 0; i < 8; ++i)
+				counted.EmplaceBack();
+		}
+		Benchmarks::Check(Counted::alive == 0, "Array with inline storage leaks elements");
+	}
+
+	// Adds ints to the end of an array or vector without reserving space.
+	template <size_t InlineCapacity>
+	void Append(Array<int, InlineCapacity>& values, int count)
+	{
+		for (int i = 0; i < count; ++i)
+			values.PushBack(i);
+	}
+
+	void Append(std::vector<int>& values, int count)
+	{
+		for (int i = 0; i < count; ++i)
+			values.push_back(i);
+	}
+
+	// Adds strings that are too long for the small string optimization,
+	// so that growing the container has to move them.
+	void Append(Array<std::string>& values, int count)
+	{
+		for (int i = 0; i < count; ++i)
+			values.EmplaceBack(40, static_cast<char>('a' + i % 26));
+	}
+
+	void Append(std::vector<std::string>& values, int count)
+	{
+		for (int i = 0; i < count; ++i)
+			values.emplace_back(40, static_cast<char>('a' + i % 26));
+	}
+
+	// Removes every other element by swapping the last element into its place.
+	void RemoveHalf(Array<int>& values)
+	{
+		for (size_t i = 0; i < values.Size(); ++i)
+			values.SwapErase(values.Begin() + i);
+	}
+
+	void RemoveHalf(std::vector<int>& values)
+	{
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			std::swap(values[i], values.back());
+			values.pop_back();
+		}
+	}
+
+	// Returns the sum of the elements.
+	template <typename Container>
+	long long Sum(const Container& values)
+	{
+		long long sum = 0;
+		for (auto it = values.begin(); it != values.end(); ++it)
+			sum += *it;
+		return sum;
+	}
+
+	template <typename ValueType, size_t InlineCapacity>
+	long long Sum(const Array<ValueType, InlineCapacity>& values)
+	{
+		long long sum = 0;
+		for (auto it = values.Begin(); it != values.End(); ++it)
+			sum += *it;
+		return sum;
+	}
+
+	// Times filling an Array and a vector from empty. The two are filled in turns,
+	// since how fast the heap hands out large blocks depends on what it did last.
+	// Params:
+	//   name = What is being measured, without the container's name.
+	//   count = How many elements to add to each container.
+	//   repeats = How many times to fill each container.
+	//   unit = What one element is called.
+	//   array = (Out) The last Array filled.
+	//   vector = (Out) The last vector filled.
+	template <typename ValueType>
+	void CompareAppend(const std::string& name, int count, int repeats, const std::string& unit,
+		Array<ValueType>& array, std::vector<ValueType>& vector)
+	{
+		double arraySeconds = 0.0;
+		double vectorSeconds = 0.0;
+
+		for (int r = 0; r < repeats; ++r)
+		{
+			Benchmarks::Stopwatch stopwatch;
+			array = Array<ValueType>();
+			Append(array, count);
+			arraySeconds += stopwatch.GetSeconds();
+
+			stopwatch.Restart();
+			vector = std::vector<ValueType>();
+			Append(vector, count);
+			vectorSeconds += stopwatch.GetSeconds();
+		}
+
+		const double total = static_cast<double>(count) * repeats;
+		Benchmarks::Report("Array " + name, total, arraySeconds, unit);
+		Benchmarks::Report("vector " + name, total, vectorSeconds, unit);
+	}
+
+	// Times making many small containers, as components and events often do.
+	// Params:
+	//   name = What is being measured.
+	//   containers = How many containers to make.
+	template <typename Container>
+	void TimeSmall(const std::string& name, int containers)
+	{
+		long long sum = 0;
+		size_t allocationsBefore = Benchmarks::GetAllocationCount();
+		Benchmarks::Stopwatch stopwatch;
+		for (int i = 0; i < containers; ++i)
+		{
+			Container values;
+			Append(values, 8);
+			sum += Sum(values);
+		}
+		double seconds = stopwatch.GetSeconds();
+		size_t allocations = Benchmarks::GetAllocationCount() - allocationsBefore;
+
+		Benchmarks::Report(name, static_cast<double>(containers), seconds, "arrays");
+		Benchmarks::Report(name + " allocations each", static_cast<double>(allocations) / containers);
+		Benchmarks::KeepResult(&sum);
+	}
+}
+
+namespace Benchmarks
+{
+	// Beta::Array compared with std::vector.
+	void RunArrayBenchmarks()
+	{
+		CheckDestruction();
+
+		const int count = IsQuick() ? 1000 : 1000000;
+		const int repeats = IsQuick() ? 10 : 100;
+
+		// Growing without Reserve
+		Array<int> array;
+		std::vector<int> vector;
+		CompareAppend("append (int)", count, repeats, "ints", array, vector);
+		Check(Sum(array) == Sum(vector), "Array PushBack gives different contents than vector");
+
+		Array<std::string> strings;
+		std::vector<std::string> stringVector;
+		CompareAppend("append (string)", count / 10, repeats, "strings", strings, stringVector);
+
+		// Reading every element
+		long long arraySum = 0;
+		Stopwatch stopwatch;
+		for (int r = 0; r < repeats; ++r)
+			arraySum += Sum(array);
+		Report("Array iterate (int)", static_cast<double>(count) * repeats, stopwatch.GetSeconds(), "ints");
+
+		long long vectorSum = 0;
+		stopwatch.Restart();
+		for (int r = 0; r < repeats; ++r)
+			vectorSum += Sum(vector);
+		Report("vector iterate (int)", static_cast<double>(count) * repeats, stopwatch.GetSeconds(), "ints");
+		KeepResult(&arraySum);
+		KeepResult(&vectorSum);
+
+		// Unordered removal
+		stopwatch.Restart();
+		RemoveHalf(array);
+		Report("Array SwapErase (int)", static_cast<double>(count / 2), stopwatch.GetSeconds(), "ints");
+
+		stopwatch.Restart();
+		RemoveHalf(vector);
+		Report("vector swap and pop_back (int)", static_cast<double>(count / 2), stopwatch.GetSeconds(), "ints");
+		Check(array.Size() == vector.size() && Sum(array) == Sum(vector),
+			"Array SwapErase gives different contents than vector");
+
+		// Many small arrays, which inline storage keeps off the heap
+		const int smallArrays = IsQuick() ? 1000 : 1000000;
+		TimeSmall<Array<int>>("Array (8 ints)", smallArrays);
+		TimeSmall<Array<int, 8>>("Array<int, 8> (8 ints)", smallArrays);
+		TimeSmall<std::vector<int>>("vector (8 ints)", smallArrays);
+
+		size_t allocationsBefore = GetAllocationCount();
+		{
+			Array<int, 8> inlineArray;
+			Append(inlineArray, 8);
+			KeepResult(&inlineArray);
+		}
+		size_t allocations = GetAllocationCount() - allocationsBefore;
+		Check(allocations == 0, "Array with inline storage allocates");
+	}
+}
+
+//------------------------------------------------------------------------------
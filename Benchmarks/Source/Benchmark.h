@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	Benchmark.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+
+namespace Benchmarks
+{
+	//------------------------------------------------------------------------------
+	// Public Classes:
+	//------------------------------------------------------------------------------
+
+	// Measures the time since it was created or last restarted.
+	class Stopwatch
+	{
+	public:
+		// Constructor - starts timing.
+		Stopwatch();
+
+		// Starts timing again from now.
+		void Restart();
+
+		// Returns the number of seconds since the stopwatch was started.
+		double GetSeconds() const;
+
+	private:
+		std::chrono::steady_clock::time_point start;
+	};
+
+	// A benchmark that can be selected on the command line.
+	struct NamedBenchmark
+	{
+		const char* name;
+		void(*run)();
+	};
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Whether benchmarks should use small problem sizes, e.g. when run as a test.
+	bool IsQuick();
+
+	// Returns the number of times operator new has been called so far.
+	size_t GetAllocationCount();
+
+	// Prints a throughput measurement.
+	// Params:
+	//   name = What was measured.
+	//   count = How many operations were performed.
+	//   seconds = How long the operations took.
+	//   unit = What one operation is called, e.g. "rays".
+	void Report(const std::string& name, double count, double seconds, const std::string& unit);
+
+	// Prints a plain value, such as an allocation count.
+	// Params:
+	//   name = What was measured.
+	//   value = The measured value.
+	void Report(const std::string& name, double value);
+
+	// Records the result of a correctness check. Failed checks are printed
+	// and make the program return a non-zero exit code.
+	// Params:
+	//   passed = Whether the check passed.
+	//   what = A description of what was checked.
+	// Returns:
+	//   The value of passed.
+	bool Check(bool passed, const std::string& what);
+
+	// Keeps the compiler from optimizing away work whose result is otherwise
+	// unused. Defined in Main.cpp so that the compiler must assume the
+	// whole result is read.
+	// Params:
+	//   result = Pointer to the result to keep.
+	void KeepResult(const void* result);
+
+	// Starts the engine without a window or GPU and runs benchmarks during its
+	// first frame. The engine can only be started once, so every benchmark that
+	// needs it must be run by the same call.
+	// Params:
+	//   benchmarks = The benchmarks to run, in order.
+	void RunInEngine(const std::vector<NamedBenchmark>& benchmarks);
+
+	//------------------------------------------------------------------------------
+	// Benchmarks:
+	//------------------------------------------------------------------------------
+
+	// Matrix3D construction, multiplication, and inversion.
+	void RunMatrixBenchmarks();
+
+	// Intersection2D batch tests, checked against and compared with the scalar tests.
+	void RunIntersectionBenchmarks();
+
+	// Beta::Array compared with std::vector.
+	void RunArrayBenchmarks();
+
+	// Benchmarks below link the whole engine (see BETA_BENCHMARK_ENGINE)
+	// and are run with RunInEngine.
+
+	// ShaderProgram uniform uploads, and reloading a program without losing its uniform values.
+	void RunShaderBenchmarks();
+
+	// Swept collision tests for fast-moving rigid bodies, compared with the discrete tests.
+	void RunSweptBenchmarks();
+
+	// Collision detection with each broadphase type as the number of objects grows.
+	void RunBroadphaseBenchmarks();
+
+	// JobSystem loops and parallel object updates with 1 to 16 threads.
+	void RunJobBenchmarks();
+
+	// EventManager dispatch as the number of registered listeners grows.
+	void RunEventBenchmarks();
+
+	// GameObject::GetComponent on objects with 2 to 20 components.
+	void RunComponentBenchmarks();
+
+	// ColliderTilemap ray casts on a large map, one at a time and with CastRays.
+	void RunRaycastBenchmarks();
+
+	// Loading large tilemaps from text and binary files, rejecting corrupt binary
+	// files, and rebuilding stale binary files.
+	void RunTilemapBenchmarks();
+
+	// FrameRateController pacing on a simulated clock: frame lengths, overshoot, and missed deadlines.
+	void RunFrameRateBenchmarks();
+
+	// SoundManager voice limits without an audio device: per-sound limits, the global cap, and priorities.
+	void RunSoundBenchmarks();
+
+	// Fixed updates with and without BodyStorage, and skipping the bodies of inactive objects.
+	void RunBodyStorageBenchmarks();
+
+	// Draw calls made by SpriteBatch for sprites that do and do not share a texture.
+	void RunSpriteBatchBenchmarks();
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	BodyStorageBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <BodyStorage.h>
+#include <EngineCore.h>
+#include <GameObject.h>
+#include <GameObjectManager.h>
+#include <RigidBody.h>
+#include <Space.h>
+#include <Transform.h>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Add an object that moves to the right.
+	// Params:
+	//   space = The space to add the object to.
+	// Returns:
+	//   The object's transform.
+	Transform* AddMovingObject(Space& space)
+	{
+		GameObject* object = new GameObject("Body");
+		Transform* transform = new Transform();
+		object->AddComponent(transform);
+		RigidBody* body = new RigidBody();
+		object->AddComponent(body);
+		space.GetObjectManager().AddObject(*object);
+		body->SetVelocity(Vector2D(1.0f, 0.0f));
+		return transform;
+	}
+
+	// Checks that only active objects are moved, with and without body storage.
+	// Params:
+	//   stored = Whether the space keeps its bodies in body storage.
+	void CheckInactiveBodies(bool stored)
+	{
+		Space space("Bodies");
+		GameObjectManager& objectManager = space.GetObjectManager();
+		objectManager.SetBodyStorageEnabled(stored);
+		objectManager.SetInterpolationEnabled(false);
+
+		Transform* active = AddMovingObject(space);
+		Transform* inactive = AddMovingObject(space);
+		inactive->GetOwner()->SetActive(false);
+
+		const float dt = objectManager.GetFixedTimeStep();
+		for (int i = 0; i < 10; ++i)
+			space.Update(dt);
+
+		const std::string mode = stored ? " with body storage" : " without body storage";
+		Benchmarks::Check(active->GetTranslation().x > 0.0f, "Active rigid bodies do not move" + mode);
+		Benchmarks::Check(inactive->GetTranslation().x == 0.0f, "Inactive rigid bodies move" + mode);
+
+		// Objects move again once they are active
+		inactive->GetOwner()->SetActive(true);
+		space.Update(dt);
+		Benchmarks::Check(inactive->GetTranslation().x > 0.0f, "Reactivated rigid bodies do not move" + mode);
+
+		// Destroyed objects are only removed at the end of an update, so move the
+		// stored bodies directly while the object still exists
+		if (stored)
+		{
+			const float destroyedX = active->GetTranslation().x;
+			active->GetOwner()->Destroy();
+			objectManager.GetBodyStorage()->Integrate(dt);
+			Benchmarks::Check(active->GetTranslation().x == destroyedX, "Destroyed rigid bodies move in body storage");
+		}
+
+		space.Shutdown();
+	}
+
+	// Fill a space with moving bodies that have no colliders.
+	// Params:
+	//   space = The space to add the bodies to.
+	//   count = How many bodies to add.
+	//   stored = Whether the space keeps its bodies in body storage.
+	void AddBodies(Space& space, unsigned count, bool stored)
+	{
+		GameObjectManager& objectManager = space.GetObjectManager();
+		objectManager.SetBodyStorageEnabled(stored);
+		objectManager.SetInterpolationEnabled(false);
+
+		for (unsigned i = 0; i < count; ++i)
+		{
+			Transform* transform = AddMovingObject(space);
+			transform->SetTranslation(Vector2D(0.0f, 0.01f * i));
+		}
+	}
+}
+
+namespace Benchmarks
+{
+	// Fixed updates with and without BodyStorage, and skipping the bodies of inactive objects.
+	void RunBodyStorageBenchmarks()
+	{
+		CheckInactiveBodies(false);
+		CheckInactiveBodies(true);
+
+		const unsigned bodies = IsQuick() ? 2000 : 100000;
+		const unsigned steps = IsQuick() ? 5 : 50;
+		const std::string spaceSize = std::to_string(bodies) + " bodies";
+
+		for (int stored = 0; stored < 2; ++stored)
+		{
+			Space space("Bodies");
+			AddBodies(space, bodies, stored != 0);
+			float dt = space.GetObjectManager().GetFixedTimeStep();
+
+			Stopwatch stopwatch;
+			for (unsigned i = 0; i < steps; ++i)
+				space.Update(dt);
+			Report("Fixed updates, " + spaceSize + (stored ? " (body storage)" : " (components)"),
+				static_cast<double>(steps), stopwatch.GetSeconds(), "steps");
+
+			space.Shutdown();
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
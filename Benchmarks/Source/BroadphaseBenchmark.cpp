@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	BroadphaseBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <Camera.h>
+#include <ColliderCircle.h>
+#include <ColliderRectangle.h>
+#include <EngineCore.h>
+#include <EventManager.h>
+#include <GameObject.h>
+#include <GameObjectManager.h>
+#include <RigidBody.h>
+#include <Shapes2D.h>
+#include <Space.h>
+#include <Transform.h>
+
+#include <cmath>		// sqrtf
+#include <random>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Broadphase types in the order they are reported
+	const BroadphaseType broadphaseTypes[] = { BroadphaseNone, BroadphaseQuadtree, BroadphaseAABBTree };
+	const char* const broadphaseNames[] = { "none", "quadtree", "AABB tree" };
+	const unsigned broadphaseCount = sizeof(broadphaseTypes) / sizeof(broadphaseTypes[0]);
+
+	// Counts the collisions that start during a step
+	struct ContactCounter
+	{
+		ContactCounter()
+			: contacts(0)
+		{
+		}
+
+		void OnCollisionStarted(const Event& event)
+		{
+			(void)event;
+			++contacts;
+		}
+
+		unsigned contacts;
+	};
+
+	// Fill a space with slowly moving circles and rectangles. Objects are spread
+	// over the camera's view, since the quadtree only covers what can be seen,
+	// and sized so that each one overlaps about one other on average.
+	// Params:
+	//   space = The space to add the objects to.
+	//   count = How many objects to add.
+	//   objects = (Out) The objects that were added.
+	void AddObjects(Space& space, unsigned count, Array<GameObject*>& objects)
+	{
+		const BoundingRectangle view = space.GetCamera().GetScreenWorldDimensions();
+		const Vector2D field = view.extents * 0.9f;
+		const float spacing = sqrtf(4.0f * field.x * field.y / count);
+
+		std::mt19937 random(count);
+		std::uniform_real_distribution<float> positionX(-field.x, field.x);
+		std::uniform_real_distribution<float> positionY(-field.y, field.y);
+		std::uniform_real_distribution<float> size(0.15f * spacing, 0.35f * spacing);
+		std::uniform_real_distribution<float> speed(-spacing, spacing);
+
+		GameObjectManager& objectManager = space.GetObjectManager();
+		for (unsigned i = 0; i < count; ++i)
+		{
+			Vector2D translation = view.center + Vector2D(positionX(random), positionY(random));
+			float radius = size(random);
+
+			GameObject* object = new GameObject("Body");
+			object->AddComponent(new Transform(translation, Vector2D(radius * 2.0f, radius * 2.0f)));
+			RigidBody* body = new RigidBody();
+			object->AddComponent(body);
+			if (i % 2 == 0)
+				object->AddComponent(new ColliderCircle(radius));
+			else
+				object->AddComponent(new ColliderRectangle(Vector2D(radius, radius)));
+			objectManager.AddObject(*object);
+			body->SetVelocity(Vector2D(speed(random), speed(random)));
+
+			objects.PushBack(object);
+		}
+	}
+
+	// Run one fixed update and count the collisions that started during it.
+	// Params:
+	//   type = The broadphase to use.
+	//   count = How many objects to add.
+	// Returns:
+	//   The number of CollisionStarted events sent.
+	unsigned CountContacts(BroadphaseType type, unsigned count)
+	{
+		Space space("Broadphase", true);
+		GameObjectManager& objectManager = space.GetObjectManager();
+		objectManager.SetBroadphaseType(type);
+
+		Array<GameObject*> objects;
+		AddObjects(space, count, objects);
+
+		ContactCounter counter;
+		EventManager& events = *EngineGetModule(EventManager);
+		Array<ListenerHandle> listeners;
+		for (auto it = objects.Begin(); it != objects.End(); ++it)
+		{
+			listeners.PushBack(events.RegisterEventHandler(*it, "CollisionStarted",
+				counter, &ContactCounter::OnCollisionStarted));
+		}
+
+		space.Update(objectManager.GetFixedTimeStep());
+
+		for (auto it = listeners.Begin(); it != listeners.End(); ++it)
+			events.UnregisterEventHandler(*it);
+		space.Shutdown();
+		return counter.contacts;
+	}
+}
+
+namespace Benchmarks
+{
+	// Collision detection with each broadphase type as the number of objects grows.
+	void RunBroadphaseBenchmarks()
+	{
+		// Every broadphase must find the same collisions as testing every pair
+		const unsigned checkCount = 1000;
+		unsigned expected = CountContacts(BroadphaseNone, checkCount);
+		Report("Contacts among 1000 objects", expected);
+		Check(expected != 0, "Broadphase test objects do not overlap");
+		for (unsigned i = 1; i < broadphaseCount; ++i)
+		{
+			Check(CountContacts(broadphaseTypes[i], checkCount) == expected,
+				std::string("Broadphase ") + broadphaseNames[i] + " misses or repeats contacts");
+		}
+
+		const unsigned quickCounts[] = { 100, 500 };
+		const unsigned fullCounts[] = { 1000, 5000, 20000 };
+		const unsigned* counts = IsQuick() ? quickCounts : fullCounts;
+		const unsigned sizes = IsQuick() ? 2 : 3;
+
+		for (unsigned c = 0; c < sizes; ++c)
+		{
+			const unsigned count = counts[c];
+			for (unsigned b = 0; b < broadphaseCount; ++b)
+			{
+				Space space("Broadphase", true);
+				GameObjectManager& objectManager = space.GetObjectManager();
+				objectManager.SetBroadphaseType(broadphaseTypes[b]);
+
+				Array<GameObject*> objects;
+				AddObjects(space, count, objects);
+
+				// Testing every pair takes seconds per step at the largest size
+				const unsigned steps = broadphaseTypes[b] == BroadphaseNone
+					? (count >= 20000 ? 1 : 5) : 20;
+				float dt = objectManager.GetFixedTimeStep();
+
+				// The first step adds the objects to the AABB tree
+				if (broadphaseTypes[b] == BroadphaseAABBTree)
+					space.Update(dt);
+
+				Stopwatch stopwatch;
+				for (unsigned i = 0; i < steps; ++i)
+					space.Update(dt);
+				Report(std::string("Fixed updates, ") + std::to_string(count) + " objects ("
+					+ broadphaseNames[b] + ")", static_cast<double>(steps), stopwatch.GetSeconds(), "steps");
+
+				space.Shutdown();
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ComponentBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <Collider.h>
+#include <ColliderCircle.h>
+#include <Component.h>
+#include <EngineCore.h>
+#include <EventManager.h>
+#include <GameObject.h>
+#include <RigidBody.h>
+#include <Transform.h>
+
+#include <cstdint>		// uintptr_t
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+// A component that does nothing, so that objects can have many component types
+#define FILLER_COMPONENT(name)                                 \
+class name : public Component                                  \
+{                                                              \
+public:                                                        \
+   name() : Component(#name) {}                                \
+   COMPONENT_SUBCLASS_DECLARATION(name)                        \
+};                                                             \
+COMPONENT_SUBCLASS_DEFINITION(name)                            \
+
+namespace
+{
+	FILLER_COMPONENT(Filler1)
+	FILLER_COMPONENT(Filler2)
+	FILLER_COMPONENT(Filler3)
+	FILLER_COMPONENT(Filler4)
+	FILLER_COMPONENT(Filler5)
+	FILLER_COMPONENT(Filler6)
+	FILLER_COMPONENT(Filler7)
+	FILLER_COMPONENT(Filler8)
+	FILLER_COMPONENT(Filler9)
+	FILLER_COMPONENT(Filler10)
+	FILLER_COMPONENT(Filler11)
+	FILLER_COMPONENT(Filler12)
+	FILLER_COMPONENT(Filler13)
+	FILLER_COMPONENT(Filler14)
+	FILLER_COMPONENT(Filler15)
+	FILLER_COMPONENT(Filler16)
+	FILLER_COMPONENT(Filler17)
+	FILLER_COMPONENT(Filler18)
+
+	// Adds the filler component with the given index to an object.
+	void AddFiller(GameObject& object, unsigned index)
+	{
+		switch (index)
+		{
+		case 1: object.AddComponent<Filler1>(); break;
+		case 2: object.AddComponent<Filler2>(); break;
+		case 3: object.AddComponent<Filler3>(); break;
+		case 4: object.AddComponent<Filler4>(); break;
+		case 5: object.AddComponent<Filler5>(); break;
+		case 6: object.AddComponent<Filler6>(); break;
+		case 7: object.AddComponent<Filler7>(); break;
+		case 8: object.AddComponent<Filler8>(); break;
+		case 9: object.AddComponent<Filler9>(); break;
+		case 10: object.AddComponent<Filler10>(); break;
+		case 11: object.AddComponent<Filler11>(); break;
+		case 12: object.AddComponent<Filler12>(); break;
+		case 13: object.AddComponent<Filler13>(); break;
+		case 14: object.AddComponent<Filler14>(); break;
+		case 15: object.AddComponent<Filler15>(); break;
+		case 16: object.AddComponent<Filler16>(); break;
+		case 17: object.AddComponent<Filler17>(); break;
+		case 18: object.AddComponent<Filler18>(); break;
+		}
+	}
+
+	// Times looking up one type of component on every object.
+	// Params:
+	//   objects = The objects to search.
+	//   lookups = How many times to search each object.
+	//   name = What is being looked up, for the report.
+	// Returns:
+	//   The number of objects on which the component was found.
+	template <typename ComponentType>
+	unsigned TimeLookups(const Array<GameObject*>& objects, unsigned lookups, const std::string& name)
+	{
+		uintptr_t found = 0;
+		unsigned foundCount = 0;
+
+		Benchmarks::Stopwatch stopwatch;
+		for (unsigned i = 0; i < lookups; ++i)
+		{
+			for (auto it = objects.Begin(); it != objects.End(); ++it)
+				found ^= reinterpret_cast<uintptr_t>((*it)->GetComponent<ComponentType>());
+		}
+		Benchmarks::Report(name, static_cast<double>(lookups) * objects.Size(), stopwatch.GetSeconds(), "lookups");
+		Benchmarks::KeepResult(&found);
+
+		for (auto it = objects.Begin(); it != objects.End(); ++it)
+		{
+			if ((*it)->GetComponent<ComponentType>() != nullptr)
+				++foundCount;
+		}
+		return foundCount;
+	}
+}
+
+namespace Benchmarks
+{
+	// GameObject::GetComponent on objects with 2 to 20 components.
+	void RunComponentBenchmarks()
+	{
+		const unsigned objectCount = 1000;
+		const unsigned lookups = IsQuick() ? 10 : 10000;
+		const unsigned componentCounts[] = { 2, 5, 10, 20 };
+
+		for (unsigned c = 0; c < 4; ++c)
+		{
+			// A transform first, a collider last, and fillers in between
+			const unsigned components = componentCounts[c];
+			Array<GameObject*> objects;
+			for (unsigned i = 0; i < objectCount; ++i)
+			{
+				GameObject* object = new GameObject("Object");
+				object->AddComponent(new Transform(Vector2D()));
+				for (unsigned f = 1; f + 1 < components; ++f)
+					AddFiller(*object, f);
+				object->AddComponent(new ColliderCircle(1.0f));
+				objects.PushBack(object);
+			}
+
+			const std::string suffix = " (" + std::to_string(components) + " components)";
+			unsigned first = TimeLookups<Transform>(objects, lookups, "GetComponent, first" + suffix);
+			unsigned last = TimeLookups<ColliderCircle>(objects, lookups, "GetComponent, last" + suffix);
+			unsigned base = TimeLookups<Collider>(objects, lookups, "GetComponent, base class" + suffix);
+			unsigned missing = TimeLookups<RigidBody>(objects, lookups, "GetComponent, missing" + suffix);
+
+			Check(first == objectCount && last == objectCount && base == objectCount && missing == 0,
+				"GetComponent with " + std::to_string(components) + " components finds the wrong components");
+
+			// The base class lookup must find the same component as the derived one
+			bool sameCollider = true;
+			for (auto it = objects.Begin(); sameCollider && it != objects.End(); ++it)
+			{
+				sameCollider = (*it)->GetComponent<Collider>()
+					== static_cast<Collider*>((*it)->GetComponent<ColliderCircle>());
+			}
+			Check(sameCollider, "GetComponent<Collider> does not find the circle collider");
+
+			for (auto it = objects.Begin(); it != objects.End(); ++it)
+				delete *it;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	EngineBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <EngineCore.h>
+#include <EventManager.h>
+#include <JobSystem.h>
+#include <StartupSettings.h>
+
+#include <iostream>		// cout
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Engine module that runs the benchmarks during the first frame, after
+	// every other module has been initialized, and then stops the engine.
+	class BenchmarkRunner : public BetaObject
+	{
+	public:
+		// Constructor
+		// Params:
+		//   benchmarks = The benchmarks to run.
+		BenchmarkRunner(const std::vector<Benchmarks::NamedBenchmark>& benchmarks)
+			: BetaObject("BenchmarkRunner"), benchmarks(benchmarks)
+		{
+		}
+
+		// Runs the benchmarks and stops the engine.
+		void Update(float dt) override
+		{
+			(void)dt;
+
+			for (size_t i = 0; i < benchmarks.size(); ++i)
+			{
+				std::cout << benchmarks[i].name << ":" << std::endl;
+				benchmarks[i].run();
+			}
+
+			EngineCore::GetInstance().Stop();
+		}
+
+	private:
+		const std::vector<Benchmarks::NamedBenchmark>& benchmarks;
+	};
+}
+
+namespace Benchmarks
+{
+	// Starts the engine without a window or GPU and runs benchmarks during its
+	// first frame. The engine can only be started once, so every benchmark that
+	// needs it must be run by the same call.
+	// Params:
+	//   benchmarks = The benchmarks to run, in order.
+	void RunInEngine(const std::vector<NamedBenchmark>& benchmarks)
+	{
+		// High-level systems used by the benchmarks, as a game would add them
+		EngineCore& engine = EngineCore::GetInstance();
+		engine.AddModule<EventManager>();
+		engine.AddModule<JobSystem>();
+		engine.AddModule<BenchmarkRunner>(benchmarks);
+		engine.SetFilePath(BE_BENCHMARK_ASSETS);
+
+		StartupSettings settings;
+		settings.headless = true;
+		settings.debugConsole = false;
+		settings.closeOnEscape = false;
+		settings.frameLimit = 1;
+		engine.Start(settings);
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	EventBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <EngineCore.h>
+#include <EventManager.h>
+#include <GameObject.h>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Counts the events it receives
+	struct EventCounter
+	{
+		EventCounter()
+			: calls(0)
+		{
+		}
+
+		void OnEvent(const Event& event)
+		{
+			(void)event;
+			++calls;
+		}
+
+		unsigned calls;
+	};
+
+	// Checks that events only reach the listeners for their source and type.
+	// Params:
+	//   events = The event manager to use.
+	void CheckDispatch(EventManager& events)
+	{
+		GameObject first("First");
+		GameObject second("Second");
+		EventCounter firstPings;
+		EventCounter firstPingsAgain;
+		EventCounter firstPongs;
+		EventCounter secondPings;
+
+		ListenerHandle handles[] =
+		{
+			events.RegisterEventHandler(&first, "Ping", firstPings, &EventCounter::OnEvent),
+			events.RegisterEventHandler(&first, "Ping", firstPingsAgain, &EventCounter::OnEvent),
+			events.RegisterEventHandler(&first, "Pong", firstPongs, &EventCounter::OnEvent),
+			events.RegisterEventHandler(&second, "Ping", secondPings, &EventCounter::OnEvent),
+		};
+
+		events.SendEvent(new Event("Ping"), &first);
+		events.SendEvent(new Event("Pong"), &first);
+		events.SendEvent(new Event("Ping"), &second);
+		Benchmarks::Check(firstPings.calls == 1 && firstPingsAgain.calls == 1
+			&& firstPongs.calls == 1 && secondPings.calls == 1,
+			"Events reach listeners for other sources or types");
+
+		events.UnregisterEventHandler(handles[0]);
+		events.SendEvent(new Event("Ping"), &first);
+		Benchmarks::Check(firstPings.calls == 1 && firstPingsAgain.calls == 2,
+			"Unregistered listeners still receive events");
+
+		for (size_t i = 0; i < sizeof(handles) / sizeof(handles[0]); ++i)
+			events.UnregisterEventHandler(handles[i]);
+	}
+
+	// Register listeners for many other sources and event types.
+	// Params:
+	//   events = The event manager to use.
+	//   count = How many listeners to register.
+	//   sources = Sources for the listeners, one for every ten listeners.
+	//   counter = The object that handles the events.
+	//   handles = (Out) Handles to the listeners.
+	void AddOtherListeners(EventManager& events, unsigned count, Array<GameObject*>& sources,
+		EventCounter& counter, Array<ListenerHandle>& handles)
+	{
+		const char* const types[] = { "Ping", "Pong", "CollisionStarted", "CollisionEnded", "Damaged" };
+
+		for (unsigned i = 0; i < count; ++i)
+		{
+			if (i % 10 == 0)
+				sources.PushBack(new GameObject("Other"));
+			handles.PushBack(events.RegisterEventHandler(sources[sources.Size() - 1], types[i % 5],
+				counter, &EventCounter::OnEvent));
+		}
+	}
+
+	// Unregister listeners and delete their sources.
+	void RemoveListeners(EventManager& events, Array<GameObject*>& sources, Array<ListenerHandle>& handles)
+	{
+		for (auto it = handles.Begin(); it != handles.End(); ++it)
+			events.UnregisterEventHandler(*it);
+		handles.Clear();
+
+		for (auto it = sources.Begin(); it != sources.End(); ++it)
+			delete *it;
+		sources.Clear();
+	}
+}
+
+namespace Benchmarks
+{
+	// EventManager dispatch as the number of registered listeners grows.
+	void RunEventBenchmarks()
+	{
+		EventManager& events = *EngineGetModule(EventManager);
+		CheckDispatch(events);
+
+		const EventTypeID pingID = GetEventTypeID("Ping");
+		const unsigned sends = IsQuick() ? 1000 : 1000000;
+		GameObject target("Target");
+		EventCounter targetCounter;
+		EventCounter otherCounter;
+		Array<GameObject*> sources;
+		Array<ListenerHandle> handles;
+
+		// One listener for the sent events among many that don't want them
+		const unsigned otherCounts[] = { 0, 1000, 100000 };
+		for (unsigned c = 0; c < 3; ++c)
+		{
+			const unsigned others = IsQuick() ? otherCounts[c] / 100 : otherCounts[c];
+			AddOtherListeners(events, others, sources, otherCounter, handles);
+			ListenerHandle handle = events.RegisterEventHandler(&target, "Ping", targetCounter, &EventCounter::OnEvent);
+
+			targetCounter.calls = 0;
+			Stopwatch stopwatch;
+			for (unsigned i = 0; i < sends; ++i)
+				events.SendEvent(new Event(pingID), &target);
+			Report("SendEvent, 1 listener (" + std::to_string(others) + " others)",
+				static_cast<double>(sends), stopwatch.GetSeconds(), "events");
+
+			Check(targetCounter.calls == sends && otherCounter.calls == 0,
+				"Events with " + std::to_string(others) + " other listeners reach the wrong listeners");
+
+			events.UnregisterEventHandler(handle);
+			RemoveListeners(events, sources, handles);
+		}
+
+		// Many listeners for the same source and type
+		const unsigned fanOutCounts[] = { 10, 1000, 10000 };
+		for (unsigned c = 0; c < 3; ++c)
+		{
+			const unsigned listeners = fanOutCounts[c];
+			Array<EventCounter> counters;
+			counters.Resize(listeners);
+
+			Stopwatch stopwatch;
+			for (unsigned i = 0; i < listeners; ++i)
+				handles.PushBack(events.RegisterEventHandler(&target, "Ping", counters[i], &EventCounter::OnEvent));
+			Report("RegisterEventHandler (" + std::to_string(listeners) + " listeners)",
+				static_cast<double>(listeners), stopwatch.GetSeconds(), "listeners");
+
+			const unsigned fanOutSends = sends / listeners + 1;
+			stopwatch.Restart();
+			for (unsigned i = 0; i < fanOutSends; ++i)
+				events.SendEvent(new Event(pingID), &target);
+			Report("SendEvent, " + std::to_string(listeners) + " listeners",
+				static_cast<double>(fanOutSends) * listeners, stopwatch.GetSeconds(), "handler calls");
+
+			bool allCalled = true;
+			for (auto it = counters.Begin(); allCalled && it != counters.End(); ++it)
+				allCalled = it->calls == fanOutSends;
+			Check(allCalled, "Events skip some of " + std::to_string(listeners) + " listeners");
+
+			// Removed in registration order, the way objects are usually destroyed
+			stopwatch.Restart();
+			RemoveListeners(events, sources, handles);
+			Report("UnregisterEventHandler (" + std::to_string(listeners) + " listeners)",
+				static_cast<double>(listeners), stopwatch.GetSeconds(), "listeners");
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
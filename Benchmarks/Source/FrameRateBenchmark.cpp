@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	FrameRateBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <EngineCore.h>
+#include <FrameRateController.h>
+#include <GraphicsEngine.h>
+
+#include <cmath>		// fabs
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Frame rate cap used by every check, and the length of one frame
+	const unsigned framerateCap = 60;
+	const double frameLength = 1.0 / framerateCap;
+
+	// How late the simulated operating system wakes sleeping threads
+	const double wakeLateness = 0.001;
+
+	// How much time passes each time the simulated clock is read
+	const double readTime = 0.00001;
+
+	// Clock that only moves when it is read, slept on, or told that work was done,
+	// so that pacing can be checked without depending on the machine.
+	class SimulatedClock : public FrameClock
+	{
+	public:
+		SimulatedClock()
+			: time(1.0)
+		{
+		}
+
+		double GetTime() const override
+		{
+			time += readTime;
+			return time;
+		}
+
+		void SleepUntil(double wakeTime) override
+		{
+			time = std::max(time, wakeTime + wakeLateness);
+		}
+
+		// Pretend that a frame spent some time working.
+		void Work(double seconds)
+		{
+			time += seconds;
+		}
+
+	private:
+		mutable double time;
+	};
+
+	// Runs frames that each do the same amount of work, except for every slowEvery-th frame.
+	// Params:
+	//   mode = How the controller waits for the end of each frame.
+	//   frames = How many frames to run.
+	//   work = How long each frame works before it ends.
+	//   slowWork = How long slow frames work.
+	//   slowEvery = How often a frame is slow, or 0 for never.
+	// Returns:
+	//   Statistics about the frames.
+	FrameTimeStats RunFrames(PacingMode mode, unsigned frames, double work,
+		double slowWork = 0.0, unsigned slowEvery = 0)
+	{
+		SimulatedClock clock;
+		FrameRateController controller;
+		controller.Initialize(framerateCap);
+		controller.SetPacingMode(mode);
+		controller.SetClock(&clock);
+
+		for (unsigned i = 0; i < frames; ++i)
+		{
+			bool slow = slowEvery != 0 && i % slowEvery == slowEvery - 1;
+			clock.Work(slow ? slowWork : work);
+			controller.FrameEnd();
+		}
+
+		return controller.GetFrameTimeStats();
+	}
+
+	// Returns whether two times are equal, give or take a few clock reads.
+	bool Near(double first, double second)
+	{
+		return fabs(first - second) <= 4 * readTime;
+	}
+}
+
+namespace Benchmarks
+{
+	// FrameRateController pacing on a simulated clock: frame lengths, overshoot, and missed deadlines.
+	void RunFrameRateBenchmarks()
+	{
+		const unsigned frames = FrameRateController::statsLength;
+
+		// The controller leaves pacing to vertical sync when it is on
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
+		const bool vsync = graphics.GetUseVsync();
+		graphics.SetUseVSync(true);
+		FrameTimeStats synced = RunFrames(PacingHybrid, frames, 0.005);
+		Check(synced.maxOvershoot == 0.0 && synced.missedDeadlines == 0 && synced.max < frameLength,
+			"Frames are paced even though vertical sync is on");
+		graphics.SetUseVSync(false);
+
+		// Sleeping for the whole wait ends every frame as late as the OS wakes the thread
+		FrameTimeStats sleep = RunFrames(PacingSleep, frames, 0.005);
+		Report("Sleep pacing, average overshoot (us)", sleep.averageOvershoot * 1000000.0);
+		Check(sleep.frames == frames && Near(sleep.averageOvershoot, wakeLateness)
+			&& Near(sleep.median, frameLength + wakeLateness),
+			"Sleep pacing does not end frames when the clock wakes the thread");
+		Check(sleep.missedDeadlines == frames, "Frames that end late are not counted as missed deadlines");
+
+		// Spinning for longer than the OS is late ends every frame on time
+		FrameTimeStats hybrid = RunFrames(PacingHybrid, frames, 0.005);
+		Report("Hybrid pacing, average overshoot (us)", hybrid.averageOvershoot * 1000000.0);
+		Check(Near(hybrid.maxOvershoot, 0.0) && Near(hybrid.min, frameLength) && Near(hybrid.max, frameLength),
+			"Hybrid pacing does not end frames on time");
+		Check(hybrid.missedDeadlines == 0, "Frames that end on time are counted as missed deadlines");
+
+		// Frames that do more work than fits in a frame are not waited for
+		FrameTimeStats slow = RunFrames(PacingHybrid, frames, 0.005, 0.025, 4);
+		Report("Hybrid pacing, slow frames, p99 (ms)", slow.percentile99 * 1000.0);
+		Check(slow.missedDeadlines == frames / 4, "Slow frames are not counted as missed deadlines");
+		Check(Near(slow.median, frameLength) && slow.max >= 0.025 && Near(slow.maxOvershoot, 0.0),
+			"Slow frames change the length of the frames after them");
+
+		// Cost of FrameEnd itself, which every frame pays. Hybrid pacing would
+		// mostly measure yielding while the simulated clock spins.
+		const unsigned timedFrames = IsQuick() ? 10000 : 1000000;
+		Stopwatch stopwatch;
+		FrameTimeStats timed = RunFrames(PacingSleep, timedFrames, 0.005);
+		Report("FrameEnd, sleep pacing (simulated clock)", static_cast<double>(timedFrames),
+			stopwatch.GetSeconds(), "frames");
+		KeepResult(&timed);
+
+		graphics.SetUseVSync(vsync);
+	}
+}
+
+//------------------------------------------------------------------------------
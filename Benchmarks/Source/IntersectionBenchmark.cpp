@@ -0,0 +1,282 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	IntersectionBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Benchmark.h"
+
+#include <Intersection2D.h>
+
+#include <cmath>		// floorf
+#include <random>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+using namespace Intersection2D;
+
+namespace
+{
+	// Shapes used by every test, with their batched copies
+	struct Shapes
+	{
+		Array<Circle> circles;
+		Array<BoundingRectangle> rects;
+		CircleBatch circleBatch;
+		RectangleBatch rectBatch;
+	};
+
+	// Creates shapes spread over an area where roughly a tenth of them overlap
+	// any given shape. Every eighth shape has whole-number coordinates, so that
+	// some shapes exactly touch and the edges of each test are checked too.
+	void MakeShapes(unsigned count, Shapes& shapes)
+	{
+		std::mt19937 random(count);
+		std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+		std::uniform_real_distribution<float> size(0.5f, 4.0f);
+
+		for (unsigned i = 0; i < count; ++i)
+		{
+			Vector2D center(position(random), position(random));
+			Vector2D extents(size(random), size(random));
+			if (i % 8 == 0)
+			{
+				center = Vector2D(floorf(center.x), floorf(center.y));
+				extents = Vector2D(floorf(extents.x) + 1.0f, floorf(extents.y) + 1.0f);
+			}
+
+			shapes.circles.PushBack(Circle(center, extents.x));
+			shapes.rects.PushBack(BoundingRectangle(center, extents));
+			shapes.circleBatch.PushBack(shapes.circles[i]);
+			shapes.rectBatch.PushBack(shapes.rects[i]);
+		}
+	}
+
+	// Returns whether two lists of hits are the same.
+	bool SameHits(const Array<unsigned>& expected, const Array<unsigned>& actual)
+	{
+		if (expected.Size() != actual.Size())
+			return false;
+
+		for (size_t i = 0; i < expected.Size(); ++i)
+		{
+			if (expected[i] != actual[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	// Checks a one-against-many batch test against its scalar test, then times both.
+	// Params:
+	//   name = The name of the test.
+	//   count = The number of shapes in each batch.
+	//   repeats = How many times to test each shape against the batch when timing.
+	//   scalar = Adds hits for shape i against every shape, one at a time.
+	//   batch = Adds hits for shape i against every shape using the batch test.
+	template <typename Scalar, typename Batch>
+	void CompareOneToMany(const std::string& name, unsigned count, unsigned repeats,
+		const Scalar& scalar, const Batch& batch)
+	{
+		Array<unsigned> expected;
+		Array<unsigned> actual;
+		bool same = true;
+
+		for (unsigned i = 0; i < count; ++i)
+		{
+			expected.Clear();
+			actual.Clear();
+			scalar(i, expected);
+			batch(i, actual);
+			same = same && SameHits(expected, actual);
+		}
+		Benchmarks::Check(same, name + " batch matches scalar test");
+
+		const double tests = static_cast<double>(count) * count * repeats;
+
+		Benchmarks::Stopwatch stopwatch;
+		for (unsigned repeat = 0; repeat < repeats; ++repeat)
+		{
+			for (unsigned i = 0; i < count; ++i)
+			{
+				expected.Clear();
+				scalar(i, expected);
+			}
+		}
+		Benchmarks::KeepResult(&expected);
+		Benchmarks::Report(name + " (scalar)", tests, stopwatch.GetSeconds(), "tests");
+
+		stopwatch.Restart();
+		for (unsigned repeat = 0; repeat < repeats; ++repeat)
+		{
+			for (unsigned i = 0; i < count; ++i)
+			{
+				actual.Clear();
+				batch(i, actual);
+			}
+		}
+		Benchmarks::KeepResult(&actual);
+		Benchmarks::Report(name + " (batch)", tests, stopwatch.GetSeconds(), "tests");
+	}
+
+	// Checks a pairwise batch test against its scalar test, then times both.
+	// Params:
+	//   name = The name of the test.
+	//   count = The number of pairs.
+	//   repeats = How many times to test all of the pairs when timing.
+	//   scalar = Returns whether pair i intersects.
+	//   batch = Adds the indices of all intersecting pairs using the batch test.
+	template <typename Scalar, typename Batch>
+	void ComparePairs(const std::string& name, unsigned count, unsigned repeats,
+		const Scalar& scalar, const Batch& batch)
+	{
+		Array<unsigned> expected;
+		Array<unsigned> actual;
+
+		for (unsigned i = 0; i < count; ++i)
+		{
+			if (scalar(i))
+				expected.PushBack(i);
+		}
+		batch(actual);
+		Benchmarks::Check(SameHits(expected, actual), name + " batch matches scalar test");
+
+		const double tests = static_cast<double>(count) * repeats;
+
+		Benchmarks::Stopwatch stopwatch;
+		for (unsigned repeat = 0; repeat < repeats; ++repeat)
+		{
+			expected.Clear();
+			for (unsigned i = 0; i < count; ++i)
+			{
+				if (scalar(i))
+					expected.PushBack(i);
+			}
+		}
+		Benchmarks::KeepResult(&expected);
+		Benchmarks::Report(name + " (scalar)", tests, stopwatch.GetSeconds(), "tests");
+
+		stopwatch.Restart();
+		for (unsigned repeat = 0; repeat < repeats; ++repeat)
+		{
+			actual.Clear();
+			batch(actual);
+		}
+		Benchmarks::KeepResult(&actual);
+		Benchmarks::Report(name + " (batch)", tests, stopwatch.GetSeconds(), "tests");
+	}
+}
+
+namespace Benchmarks
+{
+	// Intersection2D batch tests, checked against and compared with the scalar tests.
+	void RunIntersectionBenchmarks()
+	{
+		const unsigned count = IsQuick() ? 257 : 2053;
+		const unsigned repeats = IsQuick() ? 1 : 10;
+
+		// Odd counts, so that the leftover shapes after the last full set of lanes are tested
+		Shapes shapes;
+		MakeShapes(count, shapes);
+
+		// The second shape of each pair is the next shape in the list
+		Shapes nextShapes;
+		for (unsigned i = 0; i < count; ++i)
+		{
+			nextShapes.circleBatch.PushBack(shapes.circles[(i + 1) % count]);
+			nextShapes.rectBatch.PushBack(shapes.rects[(i + 1) % count]);
+		}
+
+		CompareOneToMany("Circle vs circles", count, repeats,
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				for (unsigned j = 0; j < count; ++j)
+					if (CircleCircleIntersection(shapes.circles[i], shapes.circles[j]))
+						hits.PushBack(j);
+			},
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				CircleCircleIntersectionBatch(shapes.circles[i], shapes.circleBatch, hits);
+			});
+
+		CompareOneToMany("Rectangle vs rectangles", count, repeats,
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				for (unsigned j = 0; j < count; ++j)
+					if (RectangleRectangleIntersection(shapes.rects[i], shapes.rects[j]))
+						hits.PushBack(j);
+			},
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				RectangleRectangleIntersectionBatch(shapes.rects[i], shapes.rectBatch, hits);
+			});
+
+		CompareOneToMany("Rectangle vs circles", count, repeats,
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				for (unsigned j = 0; j < count; ++j)
+					if (RectangleCircleIntersection(shapes.rects[i], shapes.circles[j]))
+						hits.PushBack(j);
+			},
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				RectangleCircleIntersectionBatch(shapes.rects[i], shapes.circleBatch, hits);
+			});
+
+		CompareOneToMany("Circle vs rectangles", count, repeats,
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				for (unsigned j = 0; j < count; ++j)
+					if (RectangleCircleIntersection(shapes.rects[j], shapes.circles[i]))
+						hits.PushBack(j);
+			},
+			[&](unsigned i, Array<unsigned>& hits)
+			{
+				CircleRectangleIntersectionBatch(shapes.circles[i], shapes.rectBatch, hits);
+			});
+
+		const unsigned pairRepeats = repeats * count;
+
+		ComparePairs("Circle pairs", count, pairRepeats,
+			[&](unsigned i)
+			{
+				return CircleCircleIntersection(shapes.circles[i], shapes.circles[(i + 1) % count]);
+			},
+			[&](Array<unsigned>& hits)
+			{
+				CircleCircleIntersectionPairs(shapes.circleBatch, nextShapes.circleBatch, hits);
+			});
+
+		ComparePairs("Rectangle pairs", count, pairRepeats,
+			[&](unsigned i)
+			{
+				return RectangleRectangleIntersection(shapes.rects[i], shapes.rects[(i + 1) % count]);
+			},
+			[&](Array<unsigned>& hits)
+			{
+				RectangleRectangleIntersectionPairs(shapes.rectBatch, nextShapes.rectBatch, hits);
+			});
+
+		ComparePairs("Rectangle-circle pairs", count, pairRepeats,
+			[&](unsigned i)
+			{
+				return RectangleCircleIntersection(shapes.rects[i], shapes.circles[(i + 1) % count]);
+			},
+			[&](Array<unsigned>& hits)
+			{
+				RectangleCircleIntersectionPairs(shapes.rectBatch, nextShapes.circleBatch, hits);
+			});
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	JobBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <EngineCore.h>
+#include <GameObject.h>
+#include <GameObjectManager.h>
+#include <JobSystem.h>
+#include <RigidBody.h>
+#include <Space.h>
+#include <Transform.h>
+
+#include <cmath>		// sinf, cosf
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Thread counts that are measured, including the thread that calls ParallelFor
+	const unsigned threadCounts[] = { 1, 2, 4, 8, 16 };
+	const unsigned threadCountCount = sizeof(threadCounts) / sizeof(threadCounts[0]);
+
+	// Fill a space with moving, spinning bodies that have no colliders,
+	// so that fixed updates are mostly rigid body updates.
+	// Params:
+	//   space = The space to add the bodies to.
+	//   count = How many bodies to add.
+	//   parallel = Whether the space updates rigid bodies in parallel.
+	void AddBodies(Space& space, unsigned count, bool parallel)
+	{
+		GameObjectManager& objectManager = space.GetObjectManager();
+		objectManager.SetParallelUpdateEnabled(parallel);
+		objectManager.SetInterpolationEnabled(false);
+
+		for (unsigned i = 0; i < count; ++i)
+		{
+			float angle = 0.001f * i;
+			GameObject* object = new GameObject("Body");
+			object->AddComponent(new Transform(Vector2D(cosf(angle), sinf(angle)) * (0.01f * i)));
+			RigidBody* body = new RigidBody();
+			object->AddComponent(body);
+			objectManager.AddObject(*object);
+			body->SetVelocity(Vector2D(-sinf(angle), cosf(angle)));
+			body->SetAngularVelocity(angle);
+		}
+	}
+
+	// Returns the translations of all bodies in a space, in the order they were added.
+	void GetTranslations(Space& space, Array<Vector2D>& translations)
+	{
+		Array<GameObject*> objects;
+		space.GetObjectManager().GetAllObjectsWithComponent<Transform>(objects);
+		for (auto it = objects.Begin(); it != objects.End(); ++it)
+			translations.PushBack((*it)->GetComponent<Transform>()->GetTranslation());
+	}
+
+	// Checks that updating bodies in parallel moves them exactly as a serial update does.
+	// Params:
+	//   jobSystem = The job system used for parallel updates.
+	void CheckParallelUpdate(JobSystem& jobSystem)
+	{
+		const unsigned count = 1000;
+		const unsigned steps = 10;
+		Array<Vector2D> expected;
+		Array<Vector2D> actual;
+
+		jobSystem.SetThreadCount(4);
+		for (int parallel = 0; parallel < 2; ++parallel)
+		{
+			Space space("Jobs");
+			AddBodies(space, count, parallel != 0);
+			float dt = space.GetObjectManager().GetFixedTimeStep();
+			for (unsigned i = 0; i < steps; ++i)
+				space.Update(dt);
+
+			GetTranslations(space, parallel ? actual : expected);
+			space.Shutdown();
+		}
+
+		bool same = expected.Size() == count && actual.Size() == count;
+		for (unsigned i = 0; same && i < count; ++i)
+			same = expected[i].x == actual[i].x && expected[i].y == actual[i].y;
+		Benchmarks::Check(same, "Parallel rigid body updates differ from serial updates");
+	}
+}
+
+namespace Benchmarks
+{
+	// JobSystem loops and parallel object updates with 1 to 16 threads.
+	void RunJobBenchmarks()
+	{
+		JobSystem& jobSystem = *EngineGetModule(JobSystem);
+		CheckParallelUpdate(jobSystem);
+
+		// A loop with enough work per item that threads are not limited by memory
+		const unsigned items = IsQuick() ? 10000 : 1000000;
+		Array<float> results;
+		results.Resize(items);
+
+		auto kernel = [&results](unsigned begin, unsigned end)
+		{
+			for (unsigned i = begin; i < end; ++i)
+			{
+				float value = 0.001f * i;
+				for (int j = 0; j < 16; ++j)
+					value = sinf(value) + cosf(value);
+				results[i] = value;
+			}
+		};
+
+		// The same loop without the job system, as a baseline
+		Stopwatch stopwatch;
+		kernel(0, items);
+		Report("Loop (no job system)", static_cast<double>(items), stopwatch.GetSeconds(), "items");
+		Array<float> expected(results);
+
+		for (unsigned t = 0; t < threadCountCount; ++t)
+		{
+			jobSystem.SetThreadCount(threadCounts[t]);
+
+			stopwatch.Restart();
+			jobSystem.ParallelFor(items, 256, kernel);
+			Report("ParallelFor (" + std::to_string(threadCounts[t]) + " threads)",
+				static_cast<double>(items), stopwatch.GetSeconds(), "items");
+
+			bool same = true;
+			for (unsigned i = 0; same && i < items; ++i)
+				same = results[i] == expected[i];
+			Check(same, "ParallelFor with " + std::to_string(threadCounts[t]) + " threads skips or repeats items");
+		}
+
+		// Fixed updates of a large space, with and without parallel updates
+		const unsigned bodies = IsQuick() ? 2000 : 100000;
+		const unsigned steps = IsQuick() ? 5 : 50;
+		const std::string spaceSize = std::to_string(bodies) + " bodies";
+
+		for (unsigned t = 0; t <= threadCountCount; ++t)
+		{
+			// The first run updates serially
+			bool parallel = t != 0;
+			if (parallel)
+				jobSystem.SetThreadCount(threadCounts[t - 1]);
+
+			Space space("Jobs");
+			AddBodies(space, bodies, parallel);
+			float dt = space.GetObjectManager().GetFixedTimeStep();
+
+			stopwatch.Restart();
+			for (unsigned i = 0; i < steps; ++i)
+				space.Update(dt);
+			Report("Fixed updates, " + spaceSize + (parallel ? " (" + std::to_string(threadCounts[t - 1])
+				+ " threads)" : " (serial)"), static_cast<double>(steps), stopwatch.GetSeconds(), "steps");
+
+			space.Shutdown();
+		}
+
+		// Later benchmarks use every hardware thread
+		jobSystem.SetThreadCount(0);
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	Main.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Benchmark.h"
+
+#include <atomic>		// allocation counter
+#include <cstdlib>		// malloc, free
+#include <cstring>		// strcmp
+#include <iomanip>		// setprecision
+#include <iostream>		// cout
+#include <new>			// bad_alloc
+
+//------------------------------------------------------------------------------
+
+namespace
+{
+	std::atomic<size_t> allocationCount(0);
+	bool quick = false;
+	bool failed = false;
+
+	// Written by KeepResult. Volatile stores cannot be removed, so neither can
+	// the work that produced the stored value.
+	const void* volatile resultSink = nullptr;
+
+	// Benchmarks that can be selected on the command line
+	const Benchmarks::NamedBenchmark benchmarks[] =
+	{
+		{ "matrix", Benchmarks::RunMatrixBenchmarks },
+		{ "intersection", Benchmarks::RunIntersectionBenchmarks },
+		{ "array", Benchmarks::RunArrayBenchmarks },
+	};
+
+#if BE_BENCHMARK_ENGINE
+	// Benchmarks that are run inside the engine
+	const Benchmarks::NamedBenchmark engineBenchmarks[] =
+	{
+		{ "shader", Benchmarks::RunShaderBenchmarks },
+		{ "swept", Benchmarks::RunSweptBenchmarks },
+		{ "broadphase", Benchmarks::RunBroadphaseBenchmarks },
+		{ "jobs", Benchmarks::RunJobBenchmarks },
+		{ "events", Benchmarks::RunEventBenchmarks },
+		{ "components", Benchmarks::RunComponentBenchmarks },
+		{ "raycast", Benchmarks::RunRaycastBenchmarks },
+		{ "tilemap", Benchmarks::RunTilemapBenchmarks },
+		{ "framerate", Benchmarks::RunFrameRateBenchmarks },
+		{ "sound", Benchmarks::RunSoundBenchmarks },
+		{ "bodies", Benchmarks::RunBodyStorageBenchmarks },
+		{ "sprites", Benchmarks::RunSpriteBatchBenchmarks },
+	};
+#endif
+
+	const size_t benchmarkCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+#if BE_BENCHMARK_ENGINE
+	const size_t engineBenchmarkCount = sizeof(engineBenchmarks) / sizeof(engineBenchmarks[0]);
+#else
+	const Benchmarks::NamedBenchmark* const engineBenchmarks = nullptr;
+	const size_t engineBenchmarkCount = 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Allocation Counting:
+//------------------------------------------------------------------------------
+
+void* operator new(size_t size)
+{
+	++allocationCount;
+	void* memory = malloc(size != 0 ? size : 1);
+	if (memory == nullptr)
+		throw std::bad_alloc();
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+namespace Benchmarks
+{
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor - starts timing.
+	Stopwatch::Stopwatch()
+		: start(std::chrono::steady_clock::now())
+	{
+	}
+
+	// Starts timing again from now.
+	void Stopwatch::Restart()
+	{
+		start = std::chrono::steady_clock::now();
+	}
+
+	// Returns the number of seconds since the stopwatch was started.
+	double Stopwatch::GetSeconds() const
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Whether benchmarks should use small problem sizes, e.g. when run as a test.
+	bool IsQuick()
+	{
+		return quick;
+	}
+
+	// Returns the number of times operator new has been called so far.
+	size_t GetAllocationCount()
+	{
+		return allocationCount;
+	}
+
+	// Prints a throughput measurement.
+	// Params:
+	//   name = What was measured.
+	//   count = How many operations were performed.
+	//   seconds = How long the operations took.
+	//   unit = What one operation is called, e.g. "rays".
+	void Report(const std::string& name, double count, double seconds, const std::string& unit)
+	{
+		double rate = count / seconds;
+		const char* prefix = " ";
+		if (rate >= 1000000.0)
+		{
+			rate /= 1000000.0;
+			prefix = " M ";
+		}
+		else if (rate >= 1000.0)
+		{
+			rate /= 1000.0;
+			prefix = " K ";
+		}
+
+		std::cout << "  " << std::left << std::setw(48) << name << std::right << std::fixed
+			<< std::setprecision(2) << std::setw(10) << rate << prefix << unit << "/s"
+			<< std::defaultfloat << std::setprecision(6) << std::endl;
+	}
+
+	// Prints a plain value, such as an allocation count.
+	// Params:
+	//   name = What was measured.
+	//   value = The measured value.
+	void Report(const std::string& name, double value)
+	{
+		std::cout << "  " << std::left << std::setw(48) << name << std::right
+			<< std::setw(10) << value << std::endl;
+	}
+
+	// Records the result of a correctness check. Failed checks are printed
+	// and make the program return a non-zero exit code.
+	// Params:
+	//   passed = Whether the check passed.
+	//   what = A description of what was checked.
+	// Returns:
+	//   The value of passed.
+	bool Check(bool passed, const std::string& what)
+	{
+		if (!passed)
+		{
+			std::cout << "  FAILED: " << what << std::endl;
+			failed = true;
+		}
+
+		return passed;
+	}
+
+	// Keeps the compiler from optimizing away work whose result is otherwise
+	// unused. Defined in Main.cpp so that the compiler must assume the
+	// whole result is read.
+	// Params:
+	//   result = Pointer to the result to keep.
+	void KeepResult(const void* result)
+	{
+		resultSink = result;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Main:
+//------------------------------------------------------------------------------
+
+// Runs the benchmarks named on the command line, or all of them if none are named.
+// Pass --quick to use small problem sizes, e.g. to check correctness only.
+int main(int argc, char* argv[])
+{
+	bool selected[benchmarkCount + engineBenchmarkCount] = {};
+	bool anySelected = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--quick") == 0)
+		{
+			quick = true;
+			continue;
+		}
+
+		bool found = false;
+		for (size_t j = 0; j < benchmarkCount + engineBenchmarkCount; ++j)
+		{
+			const char* name = j < benchmarkCount ? benchmarks[j].name : engineBenchmarks[j - benchmarkCount].name;
+			if (strcmp(argv[i], name) == 0)
+			{
+				selected[j] = true;
+				anySelected = found = true;
+			}
+		}
+
+		if (!found)
+		{
+			std::cout << "Unknown benchmark: " << argv[i] << std::endl;
+			return 1;
+		}
+	}
+
+	for (size_t i = 0; i < benchmarkCount; ++i)
+	{
+		if (anySelected && !selected[i])
+			continue;
+
+		std::cout << benchmarks[i].name << ":" << std::endl;
+		benchmarks[i].run();
+	}
+
+#if BE_BENCHMARK_ENGINE
+	std::vector<Benchmarks::NamedBenchmark> inEngine;
+	for (size_t i = 0; i < engineBenchmarkCount; ++i)
+	{
+		if (!anySelected || selected[benchmarkCount + i])
+			inEngine.push_back(engineBenchmarks[i]);
+	}
+	if (!inEngine.empty())
+		Benchmarks::RunInEngine(inEngine);
+#endif
+
+	return failed ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
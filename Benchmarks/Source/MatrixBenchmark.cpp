@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	MatrixBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Benchmark.h"
+
+#include <Matrix2D.h>
+#include <Matrix3D.h>
+
+#include <algorithm>	// max
+#include <cmath>		// fabsf
+#include <vector>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Number of objects in the synthetic scene
+	const size_t sceneObjects = 10000;
+
+	// Returns a matrix with some translation, rotation, and scale.
+	Matrix3D MakeTransform(size_t index)
+	{
+		float value = static_cast<float>(index);
+		return Matrix3D(Matrix2D::TranslationMatrix(value * 0.5f, value * -0.25f)
+			* Matrix2D::RotationMatrixRadians(value * 0.01f)
+			* Matrix2D::ScalingMatrix(1.0f + value * 0.001f, 2.0f));
+	}
+
+	// Returns the largest difference between the matrix and the identity.
+	float DistanceFromIdentity(const Matrix3D& matrix)
+	{
+		float distance = 0.0f;
+		for (int column = 0; column < 4; ++column)
+		{
+			for (int row = 0; row < 4; ++row)
+			{
+				float expected = column == row ? 1.0f : 0.0f;
+				distance = std::max(distance, fabsf(matrix.data[column][row] - expected));
+			}
+		}
+
+		return distance;
+	}
+}
+
+namespace Benchmarks
+{
+	// Matrix3D construction, multiplication, and inversion.
+	void RunMatrixBenchmarks()
+	{
+		const size_t count = IsQuick() ? 10000 : 10000000;
+
+		// Build the inputs first, so that only the matrix operations are timed
+		std::vector<Matrix3D> matrices;
+		matrices.reserve(1024);
+		for (size_t i = 0; i < 1024; ++i)
+			matrices.push_back(MakeTransform(i));
+
+		for (size_t i = 0; i < matrices.size(); ++i)
+			Check(DistanceFromIdentity(matrices[i] * matrices[i].Inverse()) < 1e-3f, "Matrix3D::Inverse");
+
+		Stopwatch stopwatch;
+		for (size_t i = 0; i < count; ++i)
+		{
+			Matrix3D identity;
+			KeepResult(&identity);
+		}
+		Report("Matrix3D construct", static_cast<double>(count), stopwatch.GetSeconds(), "matrices");
+
+		Matrix3D product;
+		stopwatch.Restart();
+		for (size_t i = 0; i < count; ++i)
+		{
+			product = matrices[i & 1023] * matrices[(i + 1) & 1023];
+			KeepResult(&product);
+		}
+		Report("Matrix3D multiply", static_cast<double>(count), stopwatch.GetSeconds(), "matrices");
+
+		Matrix3D inverse;
+		stopwatch.Restart();
+		for (size_t i = 0; i < count; ++i)
+		{
+			inverse = matrices[i & 1023].Inverse();
+			KeepResult(&inverse);
+		}
+		Report("Matrix3D inverse", static_cast<double>(count), stopwatch.GetSeconds(), "matrices");
+
+		// A frame of a scene: build each object's world matrix from its 2D
+		// transform and combine it with the camera, as SetTransform does.
+		const Matrix3D viewProjection = MakeTransform(7).Inverse();
+		const size_t frames = IsQuick() ? 1 : 100;
+		size_t allocations = 0;
+
+		stopwatch.Restart();
+		for (size_t frame = 0; frame < frames; ++frame)
+		{
+			size_t allocationsBefore = GetAllocationCount();
+			for (size_t i = 0; i < sceneObjects; ++i)
+			{
+				Matrix3D worldViewProjection = viewProjection * MakeTransform(i);
+				KeepResult(&worldViewProjection);
+			}
+			allocations += GetAllocationCount() - allocationsBefore;
+		}
+		Report("10k object frames", static_cast<double>(frames), stopwatch.GetSeconds(), "frames");
+		Report("10k object frame allocations", static_cast<double>(allocations / frames));
+		Check(allocations == 0, "Matrix3D allocates");
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	RaycastBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <ColliderTilemap.h>
+#include <EngineCore.h>
+#include <GameObject.h>
+#include <GameObjectManager.h>
+#include <JobSystem.h>
+#include <Shapes2D.h>
+#include <Space.h>
+#include <Tilemap.h>
+#include <Transform.h>
+
+#include <random>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Make a square map where about one cell in ten is solid.
+	// Params:
+	//   size = The width and height of the map, in tiles.
+	std::shared_ptr<Tilemap> MakeMap(unsigned size)
+	{
+		std::shared_ptr<Tilemap> map = std::make_shared<Tilemap>(size, size, "Raycast");
+
+		std::mt19937 random(size);
+		std::uniform_int_distribution<int> cell(0, 9);
+		for (unsigned row = 0; row < size; ++row)
+		{
+			for (unsigned column = 0; column < size; ++column)
+			{
+				if (cell(random) == 0)
+					map->SetCellValue(column, row, 1);
+			}
+		}
+
+		return map;
+	}
+
+	// Make rays that start anywhere on a map and are up to a quarter of it long.
+	// Params:
+	//   size = The width and height of the map, in tiles.
+	//   count = How many rays to make.
+	//   rays = (Out) The rays, in world coordinates.
+	void MakeRays(unsigned size, unsigned count, Array<LineSegment>& rays)
+	{
+		// Cells are centered on their indices, and rows go down
+		const float extent = static_cast<float>(size);
+		std::mt19937 random(count);
+		std::uniform_real_distribution<float> x(-0.5f, extent - 0.5f);
+		std::uniform_real_distribution<float> y(0.5f - extent, 0.5f);
+		std::uniform_real_distribution<float> offset(-0.25f * extent, 0.25f * extent);
+
+		rays.Reserve(count);
+		for (unsigned i = 0; i < count; ++i)
+		{
+			Vector2D start(x(random), y(random));
+			rays.PushBack(LineSegment(start, start + Vector2D(offset(random), offset(random))));
+		}
+	}
+
+	// Returns whether two ray results are the same.
+	bool SameHit(const TilemapRayHit& first, const TilemapRayHit& second)
+	{
+		return first.hit == second.hit && (!first.hit || (first.t == second.t
+			&& first.column == second.column && first.row == second.row));
+	}
+}
+
+namespace Benchmarks
+{
+	// ColliderTilemap ray casts on a large map, one at a time and with CastRays.
+	void RunRaycastBenchmarks()
+	{
+		const unsigned size = IsQuick() ? 128 : 1024;
+		const unsigned count = IsQuick() ? 10000 : 1000000;
+
+		Space space("Raycast");
+		GameObject* object = new GameObject("Map");
+		object->AddComponent(new Transform());
+		ColliderTilemap* collider = new ColliderTilemap();
+		object->AddComponent(collider);
+		space.GetObjectManager().AddObject(*object);
+		collider->SetTilemap(MakeMap(size));
+
+		Array<LineSegment> rays;
+		MakeRays(size, count, rays);
+		const std::string mapSize = std::to_string(size) + "x" + std::to_string(size);
+
+		// One ray at a time on the calling thread
+		Array<TilemapRayHit> expected;
+		expected.Resize(count);
+		Stopwatch stopwatch;
+		for (unsigned i = 0; i < count; ++i)
+			expected[i] = collider->CastRay(rays[i]);
+		Report("CastRay, " + mapSize + " map", static_cast<double>(count), stopwatch.GetSeconds(), "rays");
+
+		unsigned hits = 0;
+		for (auto it = expected.Begin(); it != expected.End(); ++it)
+			hits += it->hit ? 1 : 0;
+		Check(hits != 0 && hits != count, "Raycast test rays all hit or all miss");
+
+		// All rays together, split across the job system's threads (0 = every hardware thread)
+		JobSystem& jobSystem = *EngineGetModule(JobSystem);
+		const unsigned threadCounts[] = { 1, 4, 0 };
+		Array<TilemapRayHit> results;
+
+		for (unsigned t = 0; t < 3; ++t)
+		{
+			jobSystem.SetThreadCount(threadCounts[t]);
+			const std::string threads = std::to_string(jobSystem.GetThreadCount());
+
+			stopwatch.Restart();
+			collider->CastRays(rays, results);
+			Report("CastRays, " + mapSize + " map (" + threads + " threads)",
+				static_cast<double>(count), stopwatch.GetSeconds(), "rays");
+
+			bool same = results.Size() == count;
+			for (unsigned i = 0; same && i < count; ++i)
+				same = SameHit(results[i], expected[i]);
+			Check(same, "CastRays with " + threads + " threads differs from CastRay");
+		}
+
+		space.Shutdown();
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ShaderBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <Color.h>
+#include <EngineCore.h>
+#include <GraphicsEngine.h>
+#include <Matrix3D.h>
+#include <NullGraphics.h>
+#include <ShaderProgram.h>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Checks that a program sets the values of its uniforms again after it is relinked.
+	void CheckReload()
+	{
+		ShaderProgram* program = ShaderProgram::CreateProgramFromFile("spriteShader.vert", "spriteShader.frag");
+		if (!Benchmarks::Check(program != nullptr, "Create sprite shader"))
+			return;
+
+		// Uniforms that are only set once, like the ones GraphicsEngine and SpriteBatch set
+		const SpriteUniforms& uniforms = program->GetSpriteUniforms();
+		program->SetUniform(uniforms.tintColor, Color(0.5f, 0.25f, 1.0f, 1.0f));
+		program->SetUniform(uniforms.blendColor, Colors::White);
+		program->SetUniform(uniforms.diffuse, 0);
+
+		NullGraphics::ResetStats();
+		Benchmarks::Check(program->Reload(), "Reload sprite shader");
+		Benchmarks::Check(NullGraphics::GetStats().uniformUpdates == 3,
+			"Reload sets tintColor, blendColor, and diffuse again");
+		Benchmarks::Check(program->GetSpriteUniforms().tintColor.IsValid(), "Reload finds uniforms again");
+
+		delete program;
+
+		// The engine's own sprite shaders, as reloaded when spriteShader.frag changes
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
+		graphics.SetScreenTintColor(Color(1.0f, 0.5f, 0.5f, 1.0f));
+		graphics.SetSpriteBlendColor(Colors::White);
+
+		NullGraphics::ResetStats();
+		Benchmarks::Check(ShaderProgram::ReloadFile("spriteShader.frag"), "Reload spriteShader.frag");
+
+		// At least the tint and blend colors of the sprite and batch shaders
+		Benchmarks::Check(NullGraphics::GetStats().uniformUpdates >= 4,
+			"Reloading spriteShader.frag sets the engine's sprite uniforms again");
+		Benchmarks::Check(graphics.GetSpriteShader().GetSpriteUniforms().tintColor.IsValid()
+			&& graphics.GetSpriteBatchShader().GetSpriteUniforms().tintColor.IsValid(),
+			"Reloaded sprite shaders find uniforms again");
+	}
+}
+
+namespace Benchmarks
+{
+	// ShaderProgram uniform uploads, and reloading a program without losing its uniform values.
+	void RunShaderBenchmarks()
+	{
+		CheckReload();
+
+		// Uploads with the null backend, which only counts them, so this is the
+		// engine's own cost of setting a uniform
+		const ShaderProgram& shader = EngineGetModule(GraphicsEngine)->GetSpriteShader();
+		const SpriteUniforms& uniforms = shader.GetSpriteUniforms();
+		const size_t count = IsQuick() ? 10000 : 10000000;
+
+		Matrix3D matrix;
+		Stopwatch stopwatch;
+		for (size_t i = 0; i < count; ++i)
+			shader.SetUniform(uniforms.worldMatrix, matrix);
+		Report("SetUniform (Matrix3D)", static_cast<double>(count), stopwatch.GetSeconds(), "uniforms");
+
+		Color color;
+		stopwatch.Restart();
+		for (size_t i = 0; i < count; ++i)
+			shader.SetUniform(uniforms.blendColor, color);
+		Report("SetUniform (Color)", static_cast<double>(count), stopwatch.GetSeconds(), "uniforms");
+
+		size_t allocationsBefore = GetAllocationCount();
+		for (size_t i = 0; i < 1000; ++i)
+			shader.SetUniform(uniforms.worldMatrix, matrix);
+		size_t allocations = GetAllocationCount() - allocationsBefore;
+		Check(allocations == 0, "SetUniform allocates");
+	}
+}
+
+//------------------------------------------------------------------------------
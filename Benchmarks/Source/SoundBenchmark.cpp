@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	SoundBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <EngineCore.h>
+#include <SoundManager.h>
+
+#include <cstdint>		// uint16_t, uint32_t
+#include <filesystem>
+#include <fstream>		// ofstream
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Sound effects used by the checks. Each is its own file, since sounds are found by name.
+	const char* const effectNames[] = { "Shot.wav", "Step.wav", "Ambience.wav", "Alarm.wav" };
+	const unsigned effectCount = sizeof(effectNames) / sizeof(effectNames[0]);
+
+	// Length of the effects, long enough that none end while the checks run
+	const unsigned effectSeconds = 30;
+	const unsigned sampleRate = 8000;
+
+	// Writes a little-endian value to a file.
+	template <typename ValueType>
+	void WriteValue(std::ofstream& file, ValueType value)
+	{
+		for (unsigned i = 0; i < sizeof(value); ++i)
+			file.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+	}
+
+	// Writes a silent 8-bit mono WAV file.
+	// Params:
+	//   path = Where to write the file.
+	//   seconds = The length of the sound.
+	void WriteSilence(const std::string& path, unsigned seconds)
+	{
+		const uint32_t samples = sampleRate * seconds;
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+		file.write("RIFF", 4);
+		WriteValue<uint32_t>(file, 36 + samples);
+		file.write("WAVEfmt ", 8);
+		WriteValue<uint32_t>(file, 16);			// Format size
+		WriteValue<uint16_t>(file, 1);			// PCM
+		WriteValue<uint16_t>(file, 1);			// Channels
+		WriteValue<uint32_t>(file, sampleRate);
+		WriteValue<uint32_t>(file, sampleRate);	// Bytes per second
+		WriteValue<uint16_t>(file, 1);			// Bytes per sample
+		WriteValue<uint16_t>(file, 8);			// Bits per sample
+		file.write("data", 4);
+		WriteValue<uint32_t>(file, samples);
+
+		// 8-bit samples are unsigned, so silence is half way
+		const std::string silence(samples, static_cast<char>(0x80));
+		file.write(silence.data(), silence.size());
+	}
+
+	// Returns whether the sound manager's counters have the given values.
+	bool StatsAre(const SoundManager& sounds, unsigned active, unsigned plays, unsigned stolen, unsigned rejected)
+	{
+		const SoundStats& stats = sounds.GetStats();
+		return stats.activeVoices == active && stats.plays == plays
+			&& stats.voicesStolen == stolen && stats.playsRejected == rejected;
+	}
+}
+
+namespace Benchmarks
+{
+	// SoundManager voice limits without an audio device: per-sound limits, the global cap, and priorities.
+	void RunSoundBenchmarks()
+	{
+		// Effects are written to a temporary folder rather than the engine's assets
+		EngineCore& engine = EngineCore::GetInstance();
+		const std::filesystem::path folder = std::filesystem::temp_directory_path() / "BetaSoundBenchmark";
+		std::filesystem::create_directories(folder / "Audio");
+		engine.SetFilePath(folder.string() + "/");
+
+		{
+			SoundManager sounds(true);
+			SoundHandle effects[effectCount];
+			for (unsigned i = 0; i < effectCount; ++i)
+			{
+				WriteSilence((folder / "Audio" / effectNames[i]).string(), effectSeconds);
+				sounds.AddEffect(effectNames[i]);
+				effects[i] = sounds.GetSound(effectNames[i]);
+			}
+			SoundHandle shot = effects[0];
+			SoundHandle step = effects[1];
+			SoundHandle ambience = effects[2];
+			SoundHandle alarm = effects[3];
+
+			bool loaded = true;
+			for (unsigned i = 0; i < effectCount; ++i)
+				loaded = effects[i].IsValid() && loaded;
+			Check(loaded, "SoundManager could not load effects without an audio device");
+
+			// A sound with a limit replaces its own oldest copy
+			sounds.SetVoiceLimit(shot, 2);
+			for (int i = 0; i < 3; ++i)
+				sounds.PlaySound(shot);
+			Check(StatsAre(sounds, 2, 3, 1, 0), "A sound's voice limit does not replace its oldest copy");
+
+			// At the global cap, the oldest of the least important sounds is replaced.
+			// Shots are now the oldest of the sounds with the default priority.
+			sounds.SetMaxVoices(4);
+			for (int i = 0; i < 3; ++i)
+				sounds.PlaySound(step);
+			Check(StatsAre(sounds, 4, 6, 2, 0), "Sounds past the voice cap do not replace the oldest sound");
+
+			// Less important sounds are not played when every voice is more important
+			sounds.SetPriority(ambience, 200);
+			sounds.PlaySound(ambience);
+			Check(StatsAre(sounds, 4, 6, 2, 1), "A sound less important than every voice is played");
+
+			// More important sounds replace less important ones first, even if they are newer
+			sounds.SetMaxVoices(5);
+			sounds.PlaySound(ambience);
+			sounds.SetPriority(alarm, 0);
+			sounds.PlaySound(alarm);
+			Check(StatsAre(sounds, 5, 8, 3, 1), "An important sound does not replace the least important voice");
+			sounds.PlaySound(ambience);
+			Check(StatsAre(sounds, 5, 8, 3, 2), "A replaced unimportant sound is played again at the voice cap");
+			Check(sounds.GetStats().peakVoices == 5, "SoundManager reports the wrong peak voice count");
+
+			// Playing at the cap, where every play replaces a voice
+			const unsigned plays = IsQuick() ? 1000 : 100000;
+			sounds.SetMaxVoices(32);
+			sounds.SetVoiceLimit(shot, 0);
+			Stopwatch stopwatch;
+			for (unsigned i = 0; i < plays; ++i)
+				sounds.PlaySound(shot);
+			Report("PlaySound at the voice cap (32 voices)", static_cast<double>(plays), stopwatch.GetSeconds(), "plays");
+			Check(sounds.GetStats().activeVoices == 32, "Playing at the voice cap changes the number of voices");
+
+			sounds.Shutdown();
+		}
+
+		engine.SetFilePath(BE_BENCHMARK_ASSETS);
+		std::error_code error;
+		std::filesystem::remove_all(folder, error);
+	}
+}
+
+//------------------------------------------------------------------------------
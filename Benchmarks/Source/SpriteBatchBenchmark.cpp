@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	SpriteBatchBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <Color.h>
+#include <EngineCore.h>
+#include <GraphicsEngine.h>
+#include <Matrix2D.h>
+#include <Mesh.h>
+#include <MeshFactory.h>
+#include <SpriteBatch.h>
+#include <Texture.h>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Queues sprites on a batch and draws them as one frame.
+	// Params:
+	//   batch = The sprite batch to draw with.
+	//   mesh = The mesh of every sprite.
+	//   textures = The textures to cycle through, one per sprite.
+	//   numTextures = The number of textures.
+	//   count = The number of sprites.
+	// Returns:
+	//   The counters for the frame.
+	const SpriteBatchStats& DrawFrame(SpriteBatch& batch, const Mesh& mesh,
+		const Texture* const* textures, unsigned numTextures, unsigned count)
+	{
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
+		for (unsigned i = 0; i < count; ++i)
+		{
+			Matrix2D transform = Matrix2D::TranslationMatrix(static_cast<float>(i), 0.0f);
+			batch.Add(mesh, *textures[i % numTextures], transform, 0.0f, Colors::White,
+				Vector2D(), Vector2D(1.0f, 1.0f), false, false, BM_Blend);
+		}
+		batch.FrameEnd(graphics);
+		return batch.GetStats();
+	}
+}
+
+namespace Benchmarks
+{
+	// Draw calls made by SpriteBatch for sprites that do and do not share a texture.
+	void RunSpriteBatchBenchmarks()
+	{
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
+		Mesh* mesh = EngineGetModule(MeshFactory)->CreateQuadMesh();
+		Array<Color> red(1);
+		red[0] = Colors::Red;
+		Texture* other = new Texture(red, 1, 1, "Other");
+		const Texture* sameTexture[] = { &graphics.GetDefaultTexture() };
+		const Texture* twoTextures[] = { &graphics.GetDefaultTexture(), other };
+
+		SpriteBatch batch;
+		batch.Init();
+
+		const unsigned count = 1000;
+		const SpriteBatchStats& same = DrawFrame(batch, *mesh, sameTexture, 1, count);
+		Check(same.sprites == count, "Sprite batch does not count every sprite");
+		Check(same.batches == 1, "Sprites drawn in one frame are split into several batches");
+		Check(same.drawCalls == 1, "Sprites that share a texture are not drawn with one draw call");
+		Check(same.textureBinds == 1, "Sprites that share a texture bind it more than once");
+
+		// Sprites at the same depth keep their order, so alternating textures are never merged
+		const SpriteBatchStats& alternating = DrawFrame(batch, *mesh, twoTextures, 2, count);
+		Check(alternating.batches == 1, "Sprites drawn in one frame are split into several batches");
+		Check(alternating.drawCalls == count, "Sprites at the same depth are reordered by texture");
+
+		const unsigned frames = IsQuick() ? 10 : 1000;
+		Stopwatch stopwatch;
+		for (unsigned i = 0; i < frames; ++i)
+			DrawFrame(batch, *mesh, sameTexture, 1, count);
+		Report("Sprite batch, 1000 sprites, one texture", static_cast<double>(frames) * count,
+			stopwatch.GetSeconds(), "sprites");
+
+		stopwatch.Restart();
+		for (unsigned i = 0; i < frames; ++i)
+			DrawFrame(batch, *mesh, twoTextures, 2, count);
+		Report("Sprite batch, 1000 sprites, two textures", static_cast<double>(frames) * count,
+			stopwatch.GetSeconds(), "sprites");
+
+		delete other;
+		delete mesh;
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	SweptBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <Collider.h>
+#include <ColliderCircle.h>
+#include <ColliderRectangle.h>
+#include <EngineCore.h>
+#include <EventManager.h>
+#include <GameObject.h>
+#include <GameObjectManager.h>
+#include <RigidBody.h>
+#include <Space.h>
+#include <Transform.h>
+#include <Vector2D.h>		// AlmostEqual
+
+#include <cmath>		// fabsf
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// A bullet that crosses a thin wall between two fixed updates
+	const float bulletRadius = 0.05f;
+	const float bulletSpeed = 200.0f;
+	const float bulletStart = -1.0f;
+	const float wallHalfWidth = 0.05f;
+
+	// What the bullet does when it hits something
+	enum BulletResponse
+	{
+		BR_None,
+		BR_Stop,
+		BR_Bounce,
+	};
+
+	// Counts the bullet's collisions and responds to them
+	struct BulletHandler
+	{
+		BulletHandler(RigidBody& body, BulletResponse response)
+			: body(body), response(response), hits(0), firstHit(nullptr)
+		{
+		}
+
+		void OnCollisionStarted(const Event& event)
+		{
+			if (hits++ == 0)
+				firstHit = &static_cast<const CollisionEvent&>(event).otherObject;
+
+			if (response == BR_Stop)
+				body.SetVelocity(Vector2D());
+			else if (response == BR_Bounce)
+				body.SetVelocity(-body.GetVelocity());
+		}
+
+		RigidBody& body;
+		BulletResponse response;
+		unsigned hits;
+		const GameObject* firstHit;
+	};
+
+	// Add a thin, static wall to a space.
+	GameObject& AddWall(Space& space, float x)
+	{
+		GameObject* wall = new GameObject("Wall");
+		wall->AddComponent(new Transform(Vector2D(x, 0.0f), Vector2D(wallHalfWidth * 2.0f, 4.0f)));
+		wall->AddComponent(new ColliderRectangle(Vector2D(wallHalfWidth, 2.0f)));
+		space.GetObjectManager().AddObject(*wall);
+		return *wall;
+	}
+
+	// The result of firing a bullet for one fixed update
+	struct BulletResult
+	{
+		unsigned hits;
+		const GameObject* firstHit;
+		Vector2D translation;
+		Vector2D velocity;
+	};
+
+	// Fire a bullet at walls and run a single fixed update.
+	// Params:
+	//   wallsX = Where the walls are, in the order they are added.
+	//   fastMoving = Whether the bullet is flagged as fast-moving.
+	//   response = What the bullet does when it hits a wall.
+	//   hitIndex = (Out) Index in wallsX of the wall that was hit first, or -1.
+	//   startX = Where the bullet starts.
+	BulletResult FireBullet(const Array<float>& wallsX, bool fastMoving, BulletResponse response, int& hitIndex,
+		float startX = bulletStart)
+	{
+		Space space("Swept");
+		GameObjectManager& objectManager = space.GetObjectManager();
+		objectManager.SetInterpolationEnabled(false);
+
+		Array<GameObject*> walls;
+		for (auto it = wallsX.Begin(); it != wallsX.End(); ++it)
+			walls.PushBack(&AddWall(space, *it));
+
+		GameObject* bullet = new GameObject("Bullet");
+		bullet->AddComponent(new Transform(Vector2D(startX, 0.0f), Vector2D(bulletRadius * 2.0f, bulletRadius * 2.0f)));
+		RigidBody* body = new RigidBody();
+		bullet->AddComponent(body);
+		bullet->AddComponent(new ColliderCircle(bulletRadius));
+		objectManager.AddObject(*bullet);
+		body->SetVelocity(Vector2D(bulletSpeed, 0.0f));
+		body->SetFastMoving(fastMoving);
+
+		BulletHandler handler(*body, response);
+		EventManager& events = *EngineGetModule(EventManager);
+		ListenerHandle listener = events.RegisterEventHandler(bullet, "CollisionStarted",
+			handler, &BulletHandler::OnCollisionStarted);
+
+		space.Update(objectManager.GetFixedTimeStep());
+
+		BulletResult result;
+		result.hits = handler.hits;
+		result.firstHit = handler.firstHit;
+		result.translation = bullet->GetComponent<Transform>()->GetTranslation();
+		result.velocity = body->GetVelocity();
+
+		hitIndex = -1;
+		for (size_t i = 0; i < walls.Size(); ++i)
+		{
+			if (walls[i] == result.firstHit)
+				hitIndex = static_cast<int>(i);
+		}
+
+		events.UnregisterEventHandler(listener);
+		space.Shutdown();
+		return result;
+	}
+
+	// Checks that fast bullets hit thin walls that slow ones pass through,
+	// and that they keep moving for the rest of the step after the impact.
+	void CheckThinWalls()
+	{
+		const float dt = 1.0f / 120.0f;
+		const float stepLength = bulletSpeed * dt;
+		// Where the bullet touches the wall at x = 0
+		const float contact = -wallHalfWidth - bulletRadius;
+		const float tolerance = 0.01f;
+
+		Array<float> wall;
+		wall.PushBack(0.0f);
+		int hitIndex;
+
+		// The bullet crosses the whole wall in less than a step
+		BulletResult discrete = FireBullet(wall, false, BR_None, hitIndex);
+		Benchmarks::Report("Discrete test wall hits", discrete.hits);
+
+		BulletResult swept = FireBullet(wall, true, BR_None, hitIndex);
+		Benchmarks::Check(swept.hits == 1, "Fast bullet passes through a thin wall");
+		Benchmarks::Check(fabsf(swept.translation.x - (bulletStart + stepLength)) < tolerance,
+			"Fast bullet loses the rest of its step after an impact");
+
+		BulletResult stopped = FireBullet(wall, true, BR_Stop, hitIndex);
+		Benchmarks::Check(fabsf(stopped.translation.x - contact) < tolerance,
+			"Fast bullet stopped by a handler is not left at the wall");
+
+		// Bounces back for the time left after the impact
+		BulletResult bounced = FireBullet(wall, true, BR_Bounce, hitIndex);
+		float remaining = stepLength - (contact - bulletStart);
+		Benchmarks::Check(bounced.velocity.x < 0.0f
+			&& fabsf(bounced.translation.x - (contact - remaining)) < tolerance,
+			"Fast bullet does not bounce back for the rest of its step");
+
+		// Bounces off a second wall behind the bullet with the time left after that
+		Array<float> walls;
+		walls.PushBack(0.0f);
+		walls.PushBack(-0.9f);
+		const float start = -0.4f;
+		const float otherContact = -0.9f + wallHalfWidth + bulletRadius;
+		BulletResult twice = FireBullet(walls, true, BR_Bounce, hitIndex, start);
+		remaining = stepLength - (contact - start) - (contact - otherContact);
+		Benchmarks::Check(twice.hits == 2 && twice.velocity.x > 0.0f
+			&& fabsf(twice.translation.x - (otherContact + remaining)) < tolerance,
+			"Fast bullet does not bounce between two walls during one step");
+
+		// The nearer wall is hit first, whichever order the walls are tested in
+		walls[0] = 0.0f;
+		walls[1] = -0.5f;
+		BulletResult nearLast = FireBullet(walls, true, BR_Stop, hitIndex);
+		bool hitNearLast = hitIndex == 1 && nearLast.hits == 1;
+
+		walls[0] = -0.5f;
+		walls[1] = 0.0f;
+		BulletResult nearFirst = FireBullet(walls, true, BR_Stop, hitIndex);
+		bool hitNearFirst = hitIndex == 0 && nearFirst.hits == 1;
+
+		Benchmarks::Check(hitNearLast && hitNearFirst
+			&& AlmostEqual(nearLast.translation, nearFirst.translation),
+			"Fast bullet impacts depend on the order of the walls");
+	}
+}
+
+namespace Benchmarks
+{
+	// Swept collision tests for fast-moving rigid bodies, compared with the discrete tests.
+	void RunSweptBenchmarks()
+	{
+		CheckThinWalls();
+
+		// Bullets flying through a field of thin walls, with and without swept tests
+		const unsigned bullets = IsQuick() ? 50 : 500;
+		const unsigned steps = IsQuick() ? 10 : 100;
+
+		for (int fast = 0; fast < 2; ++fast)
+		{
+			Space space("Swept");
+			GameObjectManager& objectManager = space.GetObjectManager();
+			objectManager.SetBroadphaseType(BroadphaseAABBTree);
+
+			for (int i = 0; i < 20; ++i)
+				AddWall(space, 2.0f * i);
+
+			for (unsigned i = 0; i < bullets; ++i)
+			{
+				GameObject* bullet = new GameObject("Bullet");
+				bullet->AddComponent(new Transform(Vector2D(bulletStart, 0.004f * i)));
+				RigidBody* body = new RigidBody();
+				bullet->AddComponent(body);
+				bullet->AddComponent(new ColliderCircle(bulletRadius));
+				objectManager.AddObject(*bullet);
+				body->SetVelocity(Vector2D(bulletSpeed, 0.0f));
+				body->SetFastMoving(fast != 0);
+			}
+
+			float dt = objectManager.GetFixedTimeStep();
+			Stopwatch stopwatch;
+			for (unsigned i = 0; i < steps; ++i)
+				space.Update(dt);
+			Report(fast ? "Bullet steps (swept)" : "Bullet steps (discrete)",
+				static_cast<double>(steps), stopwatch.GetSeconds(), "steps");
+
+			space.Shutdown();
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
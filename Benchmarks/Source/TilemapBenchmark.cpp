@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	TilemapBenchmark.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+// Engine headers rely on the standard headers in the engine's stdafx.h
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include <EngineCore.h>
+#include <FileStream.h>
+#include <Tilemap.h>
+
+#include <chrono>		// hours
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+//------------------------------------------------------------------------------
+
+using namespace Beta;
+
+namespace
+{
+	// Name of the map that is saved and loaded
+	const std::string mapName = "Benchmark";
+
+	// Make a square map filled with random tile indices.
+	// Params:
+	//   size = The width and height of the map, in tiles.
+	std::shared_ptr<Tilemap> MakeMap(unsigned size)
+	{
+		std::shared_ptr<Tilemap> map = std::make_shared<Tilemap>(size, size, mapName);
+
+		std::mt19937 random(size);
+		std::uniform_int_distribution<int> cell(0, 15);
+		for (unsigned row = 0; row < size; ++row)
+		{
+			for (unsigned column = 0; column < size; ++column)
+				map->SetCellValue(column, row, cell(random));
+		}
+
+		return map;
+	}
+
+	// Saves a map in the text format.
+	void SaveText(const Tilemap& map, const std::string& path)
+	{
+		FileStream stream(path, OM_Write);
+		map.Serialize(stream);
+	}
+
+	// Returns whether two maps have the same cells.
+	bool SameCells(const Tilemap& first, const Tilemap& second)
+	{
+		if (first.GetWidth() != second.GetWidth() || first.GetHeight() != second.GetHeight())
+			return false;
+
+		const int* firstCells = first.GetCellData();
+		const int* secondCells = second.GetCellData();
+		for (unsigned i = 0; i < first.GetWidth() * first.GetHeight(); ++i)
+		{
+			if (firstCells[i] != secondCells[i])
+				return false;
+		}
+		return true;
+	}
+
+	// Times loading the map through the tilemap manager. Each load is released
+	// before the next, so that the manager reads the file every time.
+	// Params:
+	//   name = What is being measured.
+	//   loads = How many times to load the map.
+	//   expected = The map that should be loaded.
+	void TimeLoads(const std::string& name, unsigned loads, const Tilemap& expected)
+	{
+		bool loaded = true;
+		Benchmarks::Stopwatch stopwatch;
+		for (unsigned i = 0; i < loads; ++i)
+			loaded = ResourceGetTilemap(mapName) != nullptr && loaded;
+		Benchmarks::Report(name, static_cast<double>(loads), stopwatch.GetSeconds(), "loads");
+
+		std::shared_ptr<const Tilemap> map = ResourceGetTilemap(mapName);
+		Benchmarks::Check(loaded && map != nullptr && SameCells(*map, expected),
+			name + " gives the wrong cells");
+	}
+
+	// Overwrites one of the 32-bit fields in a binary map's header.
+	// Params:
+	//   path = The binary map to change.
+	//   offset = The position of the field in the file.
+	//   value = The new value of the field.
+	void ChangeHeader(const std::string& path, std::streamoff offset, uint32_t value)
+	{
+		std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(offset);
+		file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	// Checks that binary maps whose headers claim more data than the file holds
+	// are rejected before anything is allocated for them.
+	// Params:
+	//   binaryPath = A valid binary map, which is not changed.
+	void CheckCorruptHeaders(const std::string& binaryPath)
+	{
+		const std::string corruptPath = binaryPath + ".corrupt";
+		const std::filesystem::copy_options overwrite = std::filesystem::copy_options::overwrite_existing;
+
+		// Run-length encoded cells for a 4 billion by 4 billion map
+		std::filesystem::copy_file(binaryPath, corruptPath, overwrite);
+		ChangeHeader(corruptPath, 8, 0xFFFFFFFF);
+		ChangeHeader(corruptPath, 12, 0xFFFFFFFF);
+		ChangeHeader(corruptPath, 24, 1);
+		Tilemap hugeMap(1, 1, mapName);
+		Benchmarks::Check(!hugeMap.DeserializeBinary(corruptPath),
+			"Binary tilemap with more cells than its runs describe is loaded");
+
+		// 4 billion objects
+		std::filesystem::copy_file(binaryPath, corruptPath, overwrite);
+		ChangeHeader(corruptPath, 56, 0xFFFFFFFF);
+		Tilemap manyObjects(1, 1, mapName);
+		Benchmarks::Check(!manyObjects.DeserializeBinary(corruptPath),
+			"Binary tilemap with more objects than the file holds is loaded");
+
+		std::filesystem::remove(corruptPath);
+	}
+}
+
+namespace Benchmarks
+{
+	// Loading large tilemaps from text and binary files, rejecting corrupt binary
+	// files, and rebuilding stale binary files.
+	void RunTilemapBenchmarks()
+	{
+		// Maps are written to a temporary folder rather than the engine's assets
+		EngineCore& engine = EngineCore::GetInstance();
+		const std::filesystem::path folder = std::filesystem::temp_directory_path() / "BetaTilemapBenchmark";
+		std::filesystem::create_directories(folder / "Levels");
+		engine.SetFilePath(folder.string() + "/");
+
+		const std::string textPath = (folder / "Levels" / (mapName + ".txt")).string();
+		const std::string binaryPath = (folder / "Levels" / (mapName + ".map")).string();
+
+		const unsigned size = IsQuick() ? 128 : 2048;
+		const std::string mapSize = std::to_string(size) + "x" + std::to_string(size);
+		std::shared_ptr<Tilemap> original = MakeMap(size);
+		SaveText(*original, textPath);
+
+		// Without a binary file, the text file is parsed
+		std::filesystem::remove(binaryPath);
+		TimeLoads("Load text, " + mapSize + " map", IsQuick() ? 2 : 5, *original);
+
+		Check(Tilemap::ConvertToBinary(textPath, binaryPath), "Tilemap::ConvertToBinary fails");
+		TimeLoads("Load binary, " + mapSize + " map", IsQuick() ? 20 : 100, *original);
+		CheckCorruptHeaders(binaryPath);
+
+		// Editing the text file makes the binary file stale. The old binary file is
+		// made older than the text file, since saves can land in the same clock tick.
+		std::shared_ptr<const Tilemap> oldMap = ResourceGetTilemap(mapName);
+		const int oldCell = original->GetCellValue(0, 0);
+		original->SetCellValue(0, 0, oldCell + 1);
+		SaveText(*original, textPath);
+		std::filesystem::last_write_time(binaryPath,
+			std::filesystem::last_write_time(textPath) - std::chrono::hours(1));
+
+		// The manager still has the old map, so forget it without releasing it
+		Tilemap::GetTilemapManager().Clear();
+		std::shared_ptr<const Tilemap> newMap = ResourceGetTilemap(mapName);
+		Check(newMap != nullptr && newMap->IsMapped() && SameCells(*newMap, *original),
+			"Tilemap binary file is not rebuilt when the text file is newer");
+		Check(std::filesystem::last_write_time(binaryPath) >= std::filesystem::last_write_time(textPath),
+			"Rebuilt tilemap binary file is older than the text file");
+		Check(oldMap->GetCellValue(0, 0) == oldCell,
+			"Rebuilding a tilemap binary file changes maps that are already loaded");
+
+		oldMap.reset();
+		newMap.reset();
+		engine.SetFilePath(BE_BENCHMARK_ASSETS);
+		std::error_code error;
+		std::filesystem::remove_all(folder, error);
+	}
+}
+
+//------------------------------------------------------------------------------
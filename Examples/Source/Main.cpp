@@ -65,6 +65,9 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR, _In_ int)
 	// Add additional modules to engine
 	engine.AddModule<SoundManager>();
 	engine.AddModule<EventManager>();
+	engine.AddModule<ResourceLoader>();
+	engine.AddModule<JobSystem>();
+	engine.AddModule<FileWatcher>();
 
 	// Set initial level
 	SpaceManager* spaceManager = engine.AddModule<SpaceManager>();
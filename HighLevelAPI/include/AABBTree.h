@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	AABBTree.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Vector2D.h"
+#include "Shapes2D.h"
+#include <Array.h>
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Forward References:
+	//------------------------------------------------------------------------------
+
+	class GameObject;
+	struct CastResult;
+
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Two proxies whose fattened bounds overlap
+	struct BE_HL_API BroadphasePair
+	{
+		// Constructors
+		BroadphasePair();
+		BroadphasePair(int proxyA, int proxyB);
+
+		// Operators
+		bool operator<(const BroadphasePair& other) const;
+
+		// Public variables
+		int proxyA; // Always the smaller of the two
+		int proxyB;
+	};
+
+	// Dynamic bounding volume hierarchy that persists between steps. Each object is
+	// stored with slightly enlarged ("fat") bounds, so objects that move only a small
+	// amount do not need to be reinserted. Bounds are in world space and the tree
+	// grows to fit any world size.
+	class AABBTree
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Consts:
+		//------------------------------------------------------------------------------
+
+		// Returned when a proxy could not be created
+		static const int nullProxy = -1;
+
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor
+		// Params:
+		//   margin = How much to enlarge stored bounds, as a fraction of their size.
+		BE_HL_API AABBTree(float margin = 0.1f);
+
+		// Draws the bounds of each object in the tree (for debug purposes only).
+		BE_HL_API void Draw() const;
+
+		// Adds an object to the tree.
+		// Params:
+		//   object = The game object being added to the tree.
+		//   bounds = The world-space bounds of the object.
+		// Returns:
+		//   The ID of the proxy that represents the object in the tree.
+		BE_HL_API int AddObject(GameObject* object, const BoundingRectangle& bounds);
+
+		// Removes an object from the tree.
+		// Params:
+		//   proxy = The ID returned when the object was added.
+		BE_HL_API void RemoveObject(int proxy);
+
+		// Updates the bounds of an object. The object is only reinserted if it has
+		// left its fattened bounds.
+		// Params:
+		//   proxy        = The ID returned when the object was added.
+		//   bounds       = The new world-space bounds of the object.
+		//   displacement = How far the object moved this step, used to predict its next position.
+		// Returns:
+		//   True if the object had to be reinserted, false otherwise.
+		BE_HL_API bool UpdateObject(int proxy, const BoundingRectangle& bounds, const Vector2D& displacement = Vector2D());
+
+		// Recomputes the list of overlapping pairs. Only objects that were added
+		// or reinserted since the last call are queried against the tree.
+		BE_HL_API void UpdatePairs();
+
+		// Returns the list of overlapping pairs as of the last call to UpdatePairs.
+		BE_HL_API const Array<BroadphasePair>& GetPairs() const;
+
+		// Returns the game object associated with a proxy.
+		BE_HL_API GameObject* GetObject(int proxy) const;
+
+		// Retrieve all objects whose bounds overlap the given area.
+		// Params:
+		//   bounds  = The area to search.
+		//   results = The list that stores the nearby objects.
+		BE_HL_API void RetrieveNearbyObjects(const BoundingRectangle& bounds, Array<GameObject*>& results) const;
+
+		// Retrieve all objects from the tree that intersect with a given ray.
+		// Params:
+		//   ray     = The ray to test against.
+		//   results = Intersecting objects and their distance from the ray's origin.
+		//   filter  = Objects with this name are excluded.
+		BE_HL_API void CastRay(const LineSegment& ray, Array<CastResult>& results, const std::string& filter) const;
+
+		// Remove all objects from the tree.
+		BE_HL_API void Clear();
+
+		// Returns the number of objects in the tree.
+		BE_HL_API unsigned GetObjectCount() const;
+
+		// Returns the height of the tree (0 for an empty tree or a single leaf).
+		BE_HL_API int GetHeight() const;
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		struct Node
+		{
+			// Leaves have no children
+			bool IsLeaf() const;
+
+			BoundingRectangle bounds; // Fattened bounds for leaves, union of children otherwise
+			GameObject* object;		  // Only valid for leaves
+			int parent;				  // Also used as the next index in the free list
+			int child1;
+			int child2;
+			int height;				  // Leaves are 0, free nodes are -1
+			bool moved;				  // Leaf was (re)inserted since the last pair update
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		AABBTree(const AABBTree&) = delete;
+		AABBTree& operator=(const AABBTree&) = delete;
+
+		// Take a node from the free list, growing the pool if needed.
+		int AllocateNode();
+
+		// Return a node to the free list.
+		void FreeNode(int node);
+
+		// Attach a leaf to the tree, choosing the sibling that increases cost the least.
+		void InsertLeaf(int leaf);
+
+		// Detach a leaf from the tree.
+		void RemoveLeaf(int leaf);
+
+		// Perform a rotation at the given node if it is unbalanced.
+		// Returns:
+		//   The index of the node that replaced the given node.
+		int Balance(int node);
+
+		// Creates the fattened bounds that are stored for a leaf.
+		BoundingRectangle Fatten(const BoundingRectangle& bounds, const Vector2D& displacement) const;
+
+		// Add a pair to the pair list for the given proxies.
+		void AddPair(int proxyA, int proxyB);
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		Array<Node> nodes;	 // Node pool. Proxy IDs are indices into this array.
+		int root;
+		int freeList;
+		unsigned objectCount;
+		float margin;
+
+		Array<int> moveBuffer;		  // Leaves (re)inserted since the last pair update
+		Array<BroadphasePair> pairs;  // Current overlapping pairs
+		mutable Array<int> stack;	  // Scratch space for traversals
+	};
+}
+
+//------------------------------------------------------------------------------
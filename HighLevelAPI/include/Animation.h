@@ -43,6 +43,12 @@ namespace Beta
 		BE_HL_API AnimationManager();
 	private:
 		AnimationPtr Create(const std::string& name) override;
+
+		// Reloading - The animation is read on a worker thread, then copied into
+		// the existing animation and its sprite source found on the main thread.
+		ResourceData* LoadData(const std::string& name) override;
+		bool CanReload() const override;
+		void FinishLoad(Animation& animation, ResourceData* data) override;
 	};
 
 	class Animation : public Serializable
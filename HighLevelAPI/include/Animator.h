@@ -51,6 +51,12 @@ namespace Beta
 		//	 dt = Change in time (in seconds) since the last game loop.
 		BE_HL_API void Update(float dt);
 
+		// Advancing frames only changes this object's sprite, so animators
+		// can be updated in parallel during Update.
+		// Params:
+		//   phase = The part of the game loop that is being run.
+		BE_HL_API bool IsThreadSafe(UpdatePhase phase) const override;
+
 		// Play an animation.
 		// Params:
 		//   animationIndex = The index of the animation to play.
@@ -19,5 +19,6 @@
 
 // Systems
 #include <Quadtree.h>
+#include <AABBTree.h>
 
 //------------------------------------------------------------------------------
@@ -22,5 +22,8 @@
 // Systems
 #include <GameObjectManager.h>
 #include <GameObjectFactory.h>
+#include <JobSystem.h>
+#include <ResourceLoader.h>
+#include <FileWatcher.h>
 
 //------------------------------------------------------------------------------
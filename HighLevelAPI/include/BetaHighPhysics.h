@@ -13,5 +13,6 @@
 
 // Components
 #include <RigidBody.h>
+#include <BodyStorage.h>
 
 //------------------------------------------------------------------------------
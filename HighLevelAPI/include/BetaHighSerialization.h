@@ -16,5 +16,6 @@
 
 // Interface
 #include <Serializable.h>
+#include <MappedFile.h>
 
 //------------------------------------------------------------------------------
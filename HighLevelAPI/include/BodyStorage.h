@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	BodyStorage.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <Array.h>
+#include <Vector2D.h>
+#include <Matrix2D.h>
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Stores the data of transforms and rigid bodies as separate arrays for each
+	// field (translations, velocities, etc.), so that physics can be integrated
+	// and matrices recalculated for all objects in a few tight loops.
+	//
+	// Each transform is given a slot. A rigid body uses the same slot as the
+	// transform it moves. Slots are grouped into fixed-size blocks that are
+	// never moved, so the address of a slot's data stays the same until the
+	// slot is removed.
+	//
+	// Enabled per space with GameObjectManager::SetBodyStorageEnabled. Transform
+	// and RigidBody components move their data here when they are initialized,
+	// and their functions then read and write the stored data.
+	class BodyStorage
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Consts:
+		//------------------------------------------------------------------------------
+
+		// Number of slots in each block.
+		static const unsigned blockSize = 256;
+
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor - Creates empty storage.
+		BE_HL_API BodyStorage();
+
+		// Destructor - Frees all blocks.
+		BE_HL_API ~BodyStorage();
+
+		// Reserve a slot for a transform.
+		// Params:
+		//   translation = The starting translation.
+		//   rotation = The starting rotation.
+		//   scale = The starting scale.
+		// Returns:
+		//   The index of the slot.
+		BE_HL_API unsigned AddTransform(const Vector2D& translation, float rotation, const Vector2D& scale);
+
+		// Free a transform's slot, along with its rigid body if it has one.
+		// Params:
+		//   slot = The slot returned by AddTransform.
+		BE_HL_API void RemoveTransform(unsigned slot);
+
+		// Add rigid body data to a transform's slot.
+		// Params:
+		//   slot = The slot of the transform moved by the rigid body.
+		//   velocity = The starting velocity.
+		//   angularVelocity = The starting angular velocity.
+		//   inverseMass = The inverse of the body's mass.
+		BE_HL_API void AddBody(unsigned slot, const Vector2D& velocity, float angularVelocity, float inverseMass);
+
+		// Remove rigid body data from a slot.
+		// Params:
+		//   slot = The slot of the transform moved by the rigid body.
+		BE_HL_API void RemoveBody(unsigned slot);
+
+		// Set whether a slot's rigid body is moved. Slots of inactive and
+		// destroyed objects are skipped, as they are when updated one by one.
+		// Params:
+		//   slot = The slot returned by AddTransform.
+		//   active = Whether the slot's object is being updated.
+		BE_HL_API void SetActive(unsigned slot, bool active);
+
+		// Calculate every rigid body's acceleration from its forces, then reset the forces.
+		BE_HL_API void ApplyForces();
+
+		// Update velocities, translations, and rotations of all rigid bodies.
+		// Params:
+		//   dt = Change in time (in seconds) since the last fixed update.
+		BE_HL_API void Integrate(float dt);
+
+		// Recalculate the matrices of all transforms that have changed.
+		BE_HL_API void UpdateMatrices();
+
+		// Returns the number of transforms in the storage.
+		BE_HL_API unsigned GetTransformCount() const;
+
+		// Returns the number of rigid bodies in the storage.
+		BE_HL_API unsigned GetBodyCount() const;
+
+		// Transform data
+		BE_HL_API Vector2D& GetTranslation(unsigned slot);
+		BE_HL_API float& GetRotation(unsigned slot);
+		BE_HL_API Vector2D& GetScale(unsigned slot);
+		BE_HL_API Matrix2D& GetMatrix(unsigned slot);
+		BE_HL_API Matrix2D& GetInverseMatrix(unsigned slot);
+		BE_HL_API bool& GetIsDirty(unsigned slot);
+
+		// Rigid body data
+		BE_HL_API Vector2D& GetVelocity(unsigned slot);
+		BE_HL_API Vector2D& GetAcceleration(unsigned slot);
+		BE_HL_API Vector2D& GetForcesSum(unsigned slot);
+		BE_HL_API Vector2D& GetOldTranslation(unsigned slot);
+		BE_HL_API float& GetOldRotation(unsigned slot);
+		BE_HL_API float& GetAngularVelocity(unsigned slot);
+		BE_HL_API float& GetInverseMass(unsigned slot);
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		// What a slot is being used for
+		enum SlotFlags
+		{
+			SlotUsed = 1,
+			SlotHasBody = 2,
+			SlotInactive = 4,
+		};
+
+		// Flags that decide whether a slot's rigid body is moved (only SlotHasBody may be set)
+		static const unsigned char SlotMoves = SlotHasBody | SlotInactive;
+
+		struct Block
+		{
+			Block();
+
+			// Transform data
+			Vector2D translation[blockSize];
+			float rotation[blockSize];
+			Vector2D scale[blockSize];
+			Matrix2D matrix[blockSize];
+			Matrix2D inverseMatrix[blockSize];
+			bool isDirty[blockSize];
+
+			// Rigid body data
+			Vector2D velocity[blockSize];
+			Vector2D acceleration[blockSize];
+			Vector2D forcesSum[blockSize];
+			Vector2D oldTranslation[blockSize];
+			float oldRotation[blockSize];
+			float angularVelocity[blockSize];
+			float inverseMass[blockSize];
+
+			unsigned char flags[blockSize];
+
+			// One past the highest slot in this block that has been used
+			unsigned end;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		BodyStorage(const BodyStorage&) = delete;
+		BodyStorage& operator=(const BodyStorage&) = delete;
+
+		// Run a function on every block, using the job system if there is one.
+		template <typename Function>
+		void ForEachBlock(const Function& function);
+
+		// Integrate the rigid bodies in a single block.
+		static void IntegrateBlock(Block& block, float dt);
+
+		// Recalculate the changed matrices in a single block.
+		static void UpdateBlockMatrices(Block& block);
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		Array<Block*> blocks;
+
+		// Slots that were removed and can be reused
+		Array<unsigned> freeSlots;
+
+		unsigned numTransforms;
+		unsigned numBodies;
+	};
+}
+
+//------------------------------------------------------------------------------
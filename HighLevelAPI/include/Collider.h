@@ -18,7 +18,7 @@
 #include "Component.h"
 
 #include "EventManager.h" // Event
-#include <set>	// std::set
+#include <Array.h>
 
 //------------------------------------------------------------------------------
 
@@ -31,7 +31,9 @@ namespace Beta
 	class Transform;
 	class Sprite;
 	struct LineSegment;
+	struct BoundingRectangle;
 	class RigidBody;
+	class Vector2D;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
@@ -41,8 +43,41 @@ namespace Beta
 	struct CollisionEvent : public Event
 	{
 		BE_HL_API CollisionEvent(GameObject& otherObject, const std::string& type = "CollisionPersisted");
+		BE_HL_API CollisionEvent(GameObject& otherObject, EventTypeID typeID);
 		GameObject& otherObject;
+
+		// Collision events are sent for every contact on every fixed step,
+		// so their memory is reused from a pool instead of the system heap.
+		// (NOTE: The debug version of new in stdafx.h must not touch these.)
+#pragma push_macro("new")
+#undef new
+		BE_HL_API static void* operator new(size_t size);
+		BE_HL_API static void* operator new(size_t size, int blockType, const char* file, int line);
+		BE_HL_API static void operator delete(void* memory, size_t size);
+		BE_HL_API static void operator delete(void* memory, int blockType, const char* file, int line);
+#pragma pop_macro("new")
+	};
+
+	// Collision list event - Sent once per fixed step with every object that an
+	// object is still colliding with, in place of individual "CollisionPersisted"
+	// events. Only sent to objects whose collider has batched persisted contacts.
+	struct CollisionListEvent : public Event
+	{
+		BE_HL_API CollisionListEvent(const Array<GameObject*>& otherObjects);
+
+		// Only valid while the event is being handled.
+		const Array<GameObject*>& otherObjects;
+
+		// Allocated from the same pool as collision events
+#pragma push_macro("new")
+#undef new
+		BE_HL_API static void* operator new(size_t size);
+		BE_HL_API static void* operator new(size_t size, int blockType, const char* file, int line);
+		BE_HL_API static void operator delete(void* memory, size_t size);
+		BE_HL_API static void operator delete(void* memory, int blockType, const char* file, int line);
+#pragma pop_macro("new")
 	};
+
 	typedef enum ColliderType
 	{
 		ColliderTypeCircle,
@@ -75,6 +110,44 @@ namespace Beta
 		//	 other = Reference to the second collider component.
 		BE_HL_API void CheckCollision(const Collider& other);
 
+		// Send collision events using the result of a shape test that has already
+		// been done, such as a batch test from Intersection2D.
+		// Params:
+		//	 other = Reference to the second collider component.
+		//   colliding = Whether the shapes are colliding.
+		BE_HL_API void CheckCollision(const Collider& other, bool colliding);
+
+		// Did this fast-moving collider's object hit anything along its path that
+		// it has not been moved back to yet? Impacts are found by CheckCollision.
+		BE_HL_API bool HasImpact() const;
+
+		// Get the time of the earliest impact found for this collider.
+		// Returns:
+		//   The time of impact, from 0 (start of the step) to 1 (end of the step).
+		BE_HL_API float GetTimeOfImpact() const;
+
+		// Move this collider's object back to its earliest impact and send collision
+		// events for it, then move the object through the rest of the step with the
+		// velocity it has after the events. Use FindImpact to look for anything else
+		// in its way. Does nothing if the object has no impact.
+		// Params:
+		//   dt = The length of the fixed update.
+		//   continueStep = False to leave the object at the impact.
+		// Returns:
+		//   True if the object moved through the rest of the step, false if it stopped
+		//   (e.g. it was destroyed or moved by an event handler).
+		BE_HL_API bool StepToImpact(float dt, bool continueStep = true);
+
+		// Look for an impact with another collider during the part of the step that
+		// StepToImpact last moved this collider's object through.
+		// Params:
+		//	 other = Reference to the second collider component.
+		BE_HL_API void FindImpact(const Collider& other);
+
+		// Finish moving this collider's object with StepToImpact, forgetting any
+		// impact that was not stepped to.
+		BE_HL_API void EndImpactSteps();
+
 		// Perform intersection test between two arbitrary colliders.
 		// Params:
 		//	 other = Reference to the second collider component.
@@ -86,6 +159,38 @@ namespace Beta
 		//   t   = The t value for the intersection.
 		BE_HL_API virtual bool IsIntersectingWith(const LineSegment& ray, float& t) const = 0;
 
+		// Find when this collider first touched another during the last fixed update,
+		// using the old and current translations of both objects. Used to catch
+		// fast-moving objects that passed through others. Defaults to no collision.
+		// Params:
+		//	 other = Reference to the second collider component.
+		//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+		// Returns:
+		//   True if the colliders touched during the step, but were not touching at its start.
+		BE_HL_API virtual bool IsSweptCollidingWith(const Collider& other, float& t) const;
+
+		// Get the world-space bounds of this collider's shape (used by the broadphase).
+		// Returns:
+		//   A rectangle containing the entire collision shape.
+		BE_HL_API virtual BoundingRectangle GetBounds() const;
+
+		// Get the world-space bounds of the area this collider moved through during the
+		// last fixed update (used by the broadphase). Same as GetBounds unless fast-moving.
+		BE_HL_API BoundingRectangle GetSweptBounds() const;
+
+		// Does this collider's object have a rigid body that is flagged as fast-moving?
+		BE_HL_API bool IsFastMoving() const;
+
+		// Get the translation of this collider's object before the last fixed update.
+		// Objects without rigid bodies do not move, so their current translation is used.
+		BE_HL_API Vector2D GetOldTranslation() const;
+
+		// Get the path of this collider's object during the last fixed update, as seen by
+		// another collider's object that stays at its old translation.
+		// Params:
+		//	 other = Reference to the second collider component.
+		BE_HL_API LineSegment GetPathRelativeTo(const Collider& other) const;
+
 		// Get the type of this component.
 		BE_HL_API ColliderType GetColliderType() const;
 
@@ -95,6 +200,25 @@ namespace Beta
 		// Set this collider's processed bool.
 		BE_HL_API void SetProcessed(bool value);
 
+		// Get the ID of this collider's proxy in the broadphase (-1 if it has none).
+		BE_HL_API int GetBroadphaseProxy() const;
+
+		// Set the ID of this collider's proxy in the broadphase.
+		BE_HL_API void SetBroadphaseProxy(int proxy);
+
+		// Choose how this object is told about collisions that continue from the
+		// previous step. When batched, a single "CollisionsPersisted" event
+		// (CollisionListEvent) is sent at the start of each fixed step, listing
+		// every object it was still colliding with during the previous step.
+		// Otherwise, a "CollisionPersisted" event is sent for each contact as it
+		// is found. Started and ended events are not affected. Defaults to false.
+		// Params:
+		//   batched = Whether to batch persisted contacts.
+		BE_HL_API void SetPersistedContactsBatched(bool batched);
+
+		// Are persisted contacts sent as a single event?
+		BE_HL_API bool ArePersistedContactsBatched() const;
+
 	protected:
 		// Component pointers
 		Transform* transform;
@@ -102,6 +226,26 @@ namespace Beta
 		Sprite* sprite;
 
 	private:
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Send the contacts that persisted during the last step as a single event.
+		void SendPersistedContacts();
+
+		// Remember an impact if it is the earliest one found for this fast-moving collider.
+		// Params:
+		//	 other = Reference to the collider that was hit.
+		//   t     = The time of impact, from 0 (start of the step) to 1 (end of the step).
+		void RecordImpact(const Collider& other, float t) const;
+
+		// Move this collider's object back along its path during the last fixed update.
+		// Params:
+		//   t = Where to move the object, from 0 (start of the step) to 1 (end of the step).
+		// Returns:
+		//   The object's new translation.
+		Vector2D MoveAlongPath(float t);
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
@@ -113,9 +257,30 @@ namespace Beta
 		// Whether the collider has been checked for collisions this frame.
 		bool processed;
 
-		// IDs of objects this collider is colliding with
-		std::set<BetaObject::IDType> collidersPrevious;
-		std::set<BetaObject::IDType> collidersCurrent;
+		// Proxy ID in the game object manager's broadphase tree.
+		int broadphaseProxy;
+
+		// IDs of colliders this collider is colliding with, sorted so that
+		// they can be searched and compared without any extra memory.
+		Array<BetaObject::IDType, 4> collidersPrevious;
+		Array<BetaObject::IDType, 4> collidersCurrent;
+
+		// Whether persisted contacts are sent as a single event.
+		bool batchPersisted;
+
+		// Earliest impact found for this fast-moving collider during the current
+		// step, and the ID of the collider it hit. Found by both colliders in a
+		// pair, so they can change during the other collider's CheckCollision.
+		mutable float timeOfImpact;
+		mutable BetaObject::IDType impactID;
+
+		// IDs of colliders that persisted contact with this one during the
+		// current step. Filled in by both colliders in a pair, so it can
+		// change during the other collider's (const) CheckCollision.
+		mutable Array<BetaObject::IDType, 4> persistedContacts;
+
+		// Objects sent in the batched event, kept to reuse their memory.
+		Array<GameObject*> persistedObjects;
 
 		// Systems
 		EventManager* eventManager;
@@ -70,6 +70,19 @@ namespace Beta
 		//   t   = The t value for the intersection.
 		BE_HL_API bool IsIntersectingWith(const LineSegment& ray, float& t) const override;
 
+		// Find when a circle or rectangle first touched these lines during the last fixed update.
+		// (NOTE: IsCollidingWith already tests circles along their paths, but this is
+		// also used for the rest of a step after a fast circle's impact.)
+		// Params:
+		//	 other = Reference to the second collider component.
+		//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+		BE_HL_API bool IsSweptCollidingWith(const Collider& other, float& t) const override;
+
+		// Get the world-space bounds of this collider's shape (used by the broadphase).
+		// Returns:
+		//   A rectangle containing the entire collision shape.
+		BE_HL_API BoundingRectangle GetBounds() const override;
+
 		// Save object data to file.
 		// Params:
 		//   stream = The stream object used to save the object's data.
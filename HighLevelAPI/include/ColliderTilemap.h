@@ -57,6 +57,20 @@ namespace Beta
 		bool right;
 	};
 
+	// Result of a ray cast against the cells of a tilemap.
+	struct BE_HL_API TilemapRayHit
+	{
+		TilemapRayHit();
+
+		// Whether the ray hit a tile.
+		bool hit;
+		// How far along the ray the hit occurred, from 0 (start) to 1 (end).
+		float t;
+		// The indices of the tile that was hit.
+		int column;
+		int row;
+	};
+
 	// Map collision event - Generated when object collides with tilemap
 	struct MapCollisionEvent : public Event
 	{
@@ -88,12 +102,39 @@ namespace Beta
 		//	 Return the results of the collision check.
 		BE_HL_API bool IsCollidingWith(const Collider& other) const override;
 
-		// Perform intersection test with ray. [NOT CURRENTLY IMPLEMENTED]
+		// Perform intersection test with ray. Walks the cells crossed by the ray
+		// in order, stopping at the first tile.
 		// Params:
 		//   ray = The ray with which to test intersection.
 		//   t   = The t value for the intersection.
 		BE_HL_API bool IsIntersectingWith(const LineSegment& ray, float& t) const override;
 
+		// Find when a circle or rectangle first touched a tile during the last fixed update,
+		// by casting rays from the points on its leading sides that IsCollidingWith tests.
+		// Params:
+		//	 other = Reference to the second collider component.
+		//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+		BE_HL_API bool IsSweptCollidingWith(const Collider& other, float& t) const override;
+
+		// Find the first tile hit by a ray.
+		// Params:
+		//   ray = The ray, in world coordinates.
+		// Returns:
+		//   Where the ray hit the map, if it did.
+		BE_HL_API TilemapRayHit CastRay(const LineSegment& ray) const;
+
+		// Cast many rays at once, e.g. for line of sight or lighting queries.
+		// Uses all threads if there is a job system.
+		// Params:
+		//   rays = The rays, in world coordinates.
+		//   results = (Out) The result for each ray, in the same order.
+		BE_HL_API void CastRays(const Array<LineSegment>& rays, Array<TilemapRayHit>& results) const;
+
+		// Get the world-space bounds of this collider's shape (used by the broadphase).
+		// Returns:
+		//   A rectangle containing the entire collision shape.
+		BE_HL_API BoundingRectangle GetBounds() const override;
+
 		// Sets the tilemap to use for this collider.
 		// Params:
 		//   map = A pointer to the tilemap resource.
@@ -122,6 +163,20 @@ namespace Beta
 		//   True if there is a collision, false otherwise.
 		bool IsSideColliding(const BoundingRectangle& rectangle, RectangleSide side) const;
 
+		// Gets the points on a side of a rectangle that are tested for collision.
+		// Params:
+		//   rectangle = The bounding rectangle for an object.
+		//   side = The side of the rectangle.
+		//   hotspots = (Out) The points on that side.
+		static void GetHotspots(const BoundingRectangle& rectangle, RectangleSide side, Vector2D hotspots[2]);
+
+		// Gets the extents of the rectangle used to test an object against the tilemap.
+		// Params:
+		//   other = The object's collider.
+		// Returns:
+		//   The rectangle's extents.
+		static Vector2D GetObjectExtents(const Collider& other);
+
 		// Determines whether a point is within a collidable cell in the tilemap.
 		// Params:
 		//   x = The x component of the point, in world coordinates.
@@ -131,6 +186,14 @@ namespace Beta
 		//   or true if there is a tile at that position.
 		bool IsCollidingAtPosition(float x, float y) const;
 
+		// Walks the cells crossed by a ray (Amanatides-Woo), stopping at the first tile.
+		// Params:
+		//   start = The start of the ray, in tile space.
+		//   end = The end of the ray, in tile space.
+		// Returns:
+		//   Where the ray hit the map, if it did.
+		TilemapRayHit CastRayTileSpace(const Vector2D& start, const Vector2D& end) const;
+
 		// Moves an object and sets its velocity based on where it collided with the tilemap.
 		// Params:
 		//   objectRectangle = A bounding rectangle that encompasses the object.
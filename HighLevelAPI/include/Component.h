@@ -19,6 +19,7 @@
 #include "Serializable.h"
 
 #include <Array.h>
+#include <ObjectPool.h>
 #include <EngineCore.h>
 #include "EventManager.h"
 
@@ -142,8 +143,7 @@ void subClassType::UnregisterEventHandlers()                            \
 // Define the type and overload for IsClassType (RTTI, no inheritance)
 // This should be placed in the source (.cpp) file for any subclasses that need RTTI.
 #define COMPONENT_SUBCLASS_DEFINITION(subClassType)                     \
-const size_t subClassType::type = std::hash<std::string>()(             \
-   TYPE_TO_STRING(subClassType));                                       \
+const size_t subClassType::type = Beta::Component::RegisterType();      \
 bool subClassType::IsOfType(size_t classType) const                     \
 {                                                                       \
    return classType == subClassType::GetType();                         \
@@ -155,8 +155,7 @@ COMPONENT_SUBCLASS_EVENT_DEFINITION(subClassType)                       \
 // Define the type and overload for IsClassType (RTTI, no inheritance)
 // This should be placed in the source (.cpp) file for any subclasses that need RTTI.
 #define COMPONENT_ABSTRACT_DEFINITION(subClassType)                     \
-const size_t subClassType::type = std::hash<std::string>()(             \
-   TYPE_TO_STRING(subClassType));                                       \
+const size_t subClassType::type = Beta::Component::RegisterType();      \
 bool subClassType::IsOfType(size_t classType) const                     \
 {                                                                       \
    return classType == subClassType::GetType();                         \
@@ -166,8 +165,7 @@ size_t subClassType::GetType() { return type; }                         \
 // Define the type and overload for IsClassType (RTTI with single-level inheritance)
 // This should be placed in the source (.cpp) file for any subclasses that need RTTI.
 #define COMPONENT_SUBCLASS_SUBCLASS_DEFINITION(parentClassType, subClassType) \
-const size_t subClassType::type = std::hash<std::string>()(                   \
-   TYPE_TO_STRING(subClassType));                                             \
+const size_t subClassType::type = Beta::Component::RegisterType();            \
 bool subClassType::IsOfType(size_t classType) const                           \
 {                                                                             \
    if(classType == subClassType::GetType())                                   \
@@ -186,6 +184,15 @@ namespace Beta
    // Public Structures:
    //------------------------------------------------------------------------------
 
+   // Parts of the game loop in which components are updated
+   typedef enum UpdatePhase
+   {
+      // Update, using a variable timestep
+      PhaseUpdate,
+      // FixedUpdate, using a fixed timestep
+      PhaseFixedUpdate,
+   } UpdatePhase;
+
    class Component : public BetaObject, public Serializable
    {
    public:
@@ -212,6 +219,44 @@ namespace Beta
 
       // Unregisters any events that were registered during intialization
       BE_HL_API virtual void UnregisterEventHandlers() = 0;
+
+      // Assigns the next type ID to a component class. IDs start at zero and
+      // are dense, so objects can use them to index their components directly.
+      // Called once per class by the COMPONENT_*_DEFINITION macros.
+      BE_HL_API static size_t RegisterType();
+
+      // Returns the number of component classes that have been assigned type IDs.
+      BE_HL_API static size_t GetTypeCount();
+
+      // Whether this component can be updated at the same time as other objects
+      // during the given phase. Such updates may only change the component's own
+      // object: they must not add or destroy other objects, send events, or draw.
+      // When parallel updates are enabled in the object's GameObjectManager and a
+      // JobSystem module exists, these components are updated in parallel after
+      // all other components have been updated. Defaults to false.
+      // Params:
+      //   phase = The part of the game loop that is being run.
+      BE_HL_API virtual bool IsThreadSafe(UpdatePhase phase) const;
+
+      // Components are allocated from pools shared by all component classes
+      // of the same size, so spawning and destroying objects reuses memory
+      // instead of going back to the system heap.
+      // (NOTE: The debug version of new in stdafx.h must not touch these.)
+#pragma push_macro("new")
+#undef new
+      BE_HL_API static void* operator new(size_t size);
+      BE_HL_API static void* operator new(size_t size, int blockType, const char* file, int line);
+      BE_HL_API static void operator delete(void* memory, size_t size);
+      BE_HL_API static void operator delete(void* memory, int blockType, const char* file, int line);
+#pragma pop_macro("new")
+
+      // Get the pool used for components of the given size, e.g. to reserve
+      // memory before spawning many objects at once.
+      // Params:
+      //   size = The size of the component class, in bytes.
+      // Returns:
+      //   The pool, or nullptr if components that large use the system heap.
+      BE_HL_API static ObjectPool* GetPool(size_t size);
    };
 }
 
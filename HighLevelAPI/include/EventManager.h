@@ -17,12 +17,32 @@
 
 #include <BetaObject.h>
 #include <Array.h>
+#include <functional>	 // invoke
 #include <string>
+#include <unordered_map> // Listeners by source
 
 //------------------------------------------------------------------------------
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Integer ID for an event type name. IDs are assigned the first time a name
+	// is used and stay the same for the rest of the program.
+	typedef unsigned EventTypeID;
+
+	// Get the ID for an event type name, assigning a new ID if needed.
+	// Params:
+	//   type = The name of the event type, e.g. "CollisionStarted".
+	BE_HL_API EventTypeID GetEventTypeID(const std::string& type);
+
+	// Get the name of an event type from its ID.
+	// Params:
+	//   typeID = An ID returned by GetEventTypeID.
+	BE_HL_API const std::string& GetEventTypeName(EventTypeID typeID);
+
 	//------------------------------------------------------------------------------
 	// Public Structures:
 	//------------------------------------------------------------------------------
@@ -36,11 +56,17 @@ namespace Beta
 		//   type = The type of event that for which we are listening.
 		BE_HL_API Event(const std::string& type);
 
+		// Constructor for Event - Avoids looking up the type name.
+		// Params:
+		//   typeID = The ID of the event type, from GetEventTypeID.
+		BE_HL_API Event(EventTypeID typeID);
+
 		// Destructor - Virtual to ensure correct behavior for subclasses.
 		BE_HL_API virtual ~Event();
 
 		// The type of the event.
-		const std::string type; 
+		const EventTypeID typeID;
+		const std::string& type;
 	};
 
 	// Dummy base class for Listeners.
@@ -61,7 +87,24 @@ namespace Beta
 		BE_HL_API virtual void CallHandler(const Event* event) const = 0;
 
 		const BetaObject* source;	// The source of the event, typically a game object component.
-		const std::string type;			// The type of event that for which we are listening.
+		const EventTypeID typeID;	// The type of event that for which we are listening.
+		const std::string& type;	// Name of the event type.
+
+	private:
+		friend class EventManager;
+
+		unsigned slot;			// Index of this listener's handle in the event manager.
+		unsigned bucketIndex;	// Position within the listeners for its source and type.
+	};
+
+	// Identifies a registered listener so that it can be removed quickly.
+	struct BE_HL_API ListenerHandle
+	{
+		// Creates a handle that does not refer to any listener.
+		ListenerHandle();
+
+		unsigned index;		 // Slot in the event manager.
+		unsigned generation; // Incremented each time the slot is reused.
 	};
 
 	// Describes the conditions under which an event should be handled
@@ -96,7 +139,7 @@ namespace Beta
 			const Listener<ObjectType>& otherObject = (const Listener<ObjectType>&)(other);
 
 			if (source != otherObject.source) return false;
-			if (type != otherObject.type) return false;
+			if (typeID != otherObject.typeID) return false;
 			if (&destination != &otherObject.destination) return false;
 			if (handler != otherObject.handler) return false;
 			return true;
@@ -143,11 +186,13 @@ namespace Beta
 		//   type		 = The type of event, e.g. "CollisionEvent".
 		//   destination = The object that contains the event handler function.
 		//   handler	 = The function that will be called when the event is received.
+		// Returns:
+		//   A handle that can be used to unregister the handler.
 		template <class ObjectType>
-		void RegisterEventHandler(const BetaObject* source, const std::string& type, ObjectType& destination,
+		ListenerHandle RegisterEventHandler(const BetaObject* source, const std::string& type, ObjectType& destination,
 			void (ObjectType::*handler)(const Event&))
 		{
-			listeners.PushBack(new Listener<ObjectType>(source, type, destination, handler));
+			return AddListener(new Listener<ObjectType>(source, type, destination, handler));
 		}
 
 		// Registers an event handler with the event manager. The handler will be called
@@ -155,10 +200,12 @@ namespace Beta
 		// Params:
 		//   listener = The listener containing information about the source, type,
 		//     destination, and event handler function.
+		// Returns:
+		//   A handle that can be used to unregister the handler.
 		template <class ObjectType>
-		void RegisterEventHandler(Listener<ObjectType>& listener)
+		ListenerHandle RegisterEventHandler(Listener<ObjectType>& listener)
 		{
-			listeners.PushBack(&listener);
+			return AddListener(&listener);
 		}
 
 		// Removes a registered event handler from the list of listeners in the event manager.
@@ -184,23 +231,30 @@ namespace Beta
 		template <class ObjectType>
 		void UnregisterEventHandler(const Listener<ObjectType>& listener)
 		{
+			// Registered listeners know where they are stored
+			if (RemoveListener(listener))
+				return;
+
 			// Find a listener that matches the given parameters.
-			for (auto it = listeners.Begin(); it != listeners.End(); )
+			const Array<ListenerBase*>* candidates = FindListeners(listener.typeID, listener.source);
+			if (candidates == nullptr)
+				return;
+
+			for (auto it = candidates->Begin(); it != candidates->End(); ++it)
 			{
-				if (listener == *(*it))
+				if (*it != nullptr && listener == *(*it))
 				{
-					delete (*it);
-					(*it) = nullptr;
-					it = listeners.Erase(it);
+					RemoveListener(*(*it));
 					return;
 				}
-				else
-				{
-					++it;
-				}
 			}
 		}
 
+		// Removes a registered event handler from the list of listeners in the event manager.
+		// Params:
+		//   handle = The handle returned when the handler was registered.
+		BE_HL_API void UnregisterEventHandler(ListenerHandle handle);
+
 	private:
 		//------------------------------------------------------------------------------
 		// Private Functions:
@@ -210,6 +264,20 @@ namespace Beta
 		EventManager(const EventManager&) = delete;
 		EventManager& operator=(const EventManager&) = delete;
 
+		// Add a listener to the dispatch table. The event manager takes ownership of the listener.
+		BE_HL_API ListenerHandle AddListener(ListenerBase* listener);
+
+		// Remove a listener if it is the instance that was registered.
+		// Returns:
+		//   True if the listener was removed, false if it is not registered.
+		BE_HL_API bool RemoveListener(const ListenerBase& listener);
+
+		// Get the listeners for the given source and type, or null if there are none.
+		BE_HL_API const Array<ListenerBase*>* FindListeners(EventTypeID typeID, const BetaObject* source) const;
+
+		// Send an event to its listeners right away.
+		void Dispatch(const Event* event, const BetaObject* source);
+
 		//------------------------------------------------------------------------------
 		// Private Structures:
 		//------------------------------------------------------------------------------
@@ -229,11 +297,39 @@ namespace Beta
 			float delay;		// How long to wait before sending the event.
 		};
 
+		// Listeners for a single source and event type, in registration order.
+		// Removed listeners leave a null entry until the bucket is compacted.
+		struct ListenerBucket
+		{
+			ListenerBucket();
+
+			Array<ListenerBase*> listeners;
+			unsigned removed;
+		};
+
+		// Buckets for a single event type, indexed by source.
+		typedef std::unordered_map<const BetaObject*, ListenerBucket> SourceTable;
+
+		// Entry referenced by a listener handle.
+		struct ListenerSlot
+		{
+			ListenerBase* listener;
+			unsigned generation;
+		};
+
+		// Remove null entries from a source's bucket, deleting it if it is empty.
+		// The bucket is looked up again, since handlers that register listeners
+		// can rehash the table and invalidate iterators held across them.
+		void CompactBucket(SourceTable& table, const BetaObject* source);
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
 
-		Array<ListenerBase*> listeners; // List of all registered handlers/listeners.
+		Array<SourceTable*> dispatchTable;  // Listeners indexed by event type ID, then source.
+		Array<ListenerSlot> slots;			// All registered listeners, indexed by handle.
+		Array<unsigned> freeSlots;			// Unused entries in slots.
+		unsigned dispatchDepth;				// How many dispatches are in progress.
 		Array<DelayedEvent*> delayedEvents; // List of all events that have been delayed.
 	};
 }
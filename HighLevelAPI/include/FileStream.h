@@ -103,6 +103,26 @@ namespace Beta
 			WriteArray(array, width, height, insertCommas);
 		}
 
+		// Writes a variable name and array to the currently open file.
+		// (Overload for arrays stored contiguously, row by row)
+		// Params:
+		//   name = The name of the array that will be written to the file.
+		//   variable = The value of the variable that will be written to the file.
+		//   width = The width of the array.
+		//   height = The height of the array.
+		//   insertCommas = Whether to separate values in the array with commas.
+		template<typename T>
+		void WriteArrayVariable(const std::string& name, T* const array, size_t width,
+			size_t height, bool insertCommas)
+		{
+			CheckFileOpen();
+
+			for (unsigned i = 0; i < indentLevel; ++i)
+				stream << tab;
+			stream << name << " : " << std::endl;
+			WriteArray(array, width, height, insertCommas);
+		}
+
 		// Writes a variable name and array to the currently open file.
 		// Params:
 		//   name = The name of the array that will be written to the file.
@@ -165,6 +185,38 @@ namespace Beta
 			EndScope();
 		}
 
+		// Writes an array to the currently open file.
+		// (Overload for arrays stored contiguously, row by row)
+		// Params:
+		//   array =  The array that will be written to the file.
+		//   width = The width of the array.
+		//   height = The height of the array.
+		//   insertCommas = Whether to separate values in the array with commas.
+		template<typename T>
+		void WriteArray(T* const array, size_t width, size_t height, bool insertCommas)
+		{
+			CheckFileOpen();
+
+			BeginScope();
+
+			std::string separator = " ";
+			if (insertCommas)
+				separator = ", ";
+
+			for (size_t r = 0; r < height; ++r)
+			{
+				for (unsigned i = 0; i < indentLevel; ++i)
+					stream << tab;
+
+				for (size_t c = 0; c < width; ++c)
+					stream << array[r * width + c] << separator;
+
+				stream << std::endl;
+			}
+
+			EndScope();
+		}
+
 		// Writes an array to the currently open file.
 		// Params:
 		//   array =  The array that will be written to the file.
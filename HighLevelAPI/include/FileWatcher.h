@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	FileWatcher.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <BetaObject.h>
+
+#include <Array.h>
+#include <unordered_map>	// Watched folders, modification times
+#include <filesystem>		// file_time_type
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Reloads assets while the game is running. Watches the engine's assets
+	// folder for files that are saved, and reloads the resources and shaders
+	// that were loaded from them in place, so that anything using them sees
+	// the changes without a restart. Only the changed files are read again,
+	// and resources are only updated between frames.
+	//
+	// On Linux, changes are reported by inotify. Elsewhere, or if inotify is
+	// not available, the modification times of all files in the assets folder
+	// are checked a few times per second.
+	class FileWatcher : public BetaObject
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor
+		// Params:
+		//   pollInterval = The time between checks of the assets folder, in seconds,
+		//     when changes can't be reported by the operating system.
+		BE_HL_API FileWatcher(float pollInterval = 0.5f);
+
+		// Destructor - Stops watching the assets folder.
+		BE_HL_API ~FileWatcher();
+
+		// Start watching the assets folder.
+		BE_HL_API void Initialize() override;
+
+		// Reload the resources loaded from files that have changed since the last update.
+		// Params:
+		//   dt = The change in time since the previous frame.
+		BE_HL_API void Update(float dt) override;
+
+		// Stop watching the assets folder.
+		BE_HL_API void Shutdown() override;
+
+		// Reload the resources and shaders loaded from a file, as if it had changed.
+		// Params:
+		//   path = The path of the file, relative to the assets folder.
+		//     Ex: Textures/Monkey.png
+		// Returns:
+		//   True if anything was reloaded, false if nothing uses the file.
+		BE_HL_API bool ReloadFile(const std::string& path);
+
+		// Returns the number of changed files that have been reloaded.
+		BE_HL_API unsigned GetReloadCount() const;
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+
+		// Ask inotify to report changes in a folder and all of its subfolders.
+		// Params:
+		//   folder = The path of the folder, relative to the assets folder.
+		void WatchFolder(const std::string& folder);
+
+		// Get the files that inotify has reported as changed.
+		// Params:
+		//   changed = The array that the paths of the files will be added to.
+		void ReadEvents(Array<std::string>& changed);
+
+		// Compare the modification time of every file with the last time seen.
+		// Params:
+		//   changed = The array that the paths of new and modified files
+		//     will be added to, or nullptr to only record the times.
+		void ScanFiles(Array<std::string>* changed);
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		// Assets folder, ending in a slash
+		std::string root;
+
+		// inotify instance, or -1 if files are being polled
+		int inotifyFd;
+		// Paths of watched folders, by inotify watch descriptor
+		std::unordered_map<int, std::string> watchedFolders;
+
+		// Last modification time of each file, when polling
+		std::unordered_map<std::string, std::filesystem::file_time_type> modificationTimes;
+		float pollInterval;
+		float pollTimer;
+
+		unsigned reloadCount;
+	};
+}
+
+//------------------------------------------------------------------------------
@@ -41,6 +41,16 @@ namespace Beta
 	{
 	public:
 		BE_HL_API ArchetypeManager();
+
+		// Load an archetype's file again and replace its components, so that objects
+		// created from it afterward use the new data. Objects that were already
+		// created are unchanged. Archetypes are read on the main thread, since
+		// their components may load other resources while being read.
+		// Params:
+		//   name = The name of the archetype.
+		// Returns:
+		//   True if the archetype is in use and was reloaded, false otherwise.
+		BE_HL_API bool Reload(const std::string& name) override;
 	private:
 		Archetype Create(const std::string& name) override;
 	};
@@ -76,9 +86,7 @@ namespace Beta
 		ComponentType* AddComponent()
 		{
 			ComponentType* component = new ComponentType;
-
-			component->SetOwner(this);
-			components.PushBack(component);
+			AddComponent(component);
 
 			return component;
 		}
@@ -87,18 +95,15 @@ namespace Beta
 		BE_HL_API void AddComponent(Component* component);
 
 		// Retrieves the component with the given type if it exists.
+		// If there are several, the one that was added first is returned.
 		template<typename ComponentType>
 		ComponentType* GetComponent() const
 		{
-			size_t numComponents = components.Size();
+			size_t type = ComponentType::GetType();
+			if (type >= componentsByType.Size())
+				return nullptr;
 
-			for (size_t i = 0; i < numComponents; ++i)
-			{
-				if (components[i]->IsOfType(ComponentType::GetType()))
-					return static_cast<ComponentType*>(components[i]);
-			}
-
-			return nullptr;
+			return static_cast<ComponentType*>(componentsByType[type]);
 		}
 
 		// Initialize this object's components and set it to active.
@@ -119,6 +124,18 @@ namespace Beta
 		//	 dt = A fixed change in time, usually 1/60th of a second.
 		BE_HL_API void FixedUpdate(float dt) override;
 
+		// Update only the components that are, or are not, thread-safe for Update.
+		// Params:
+		//	 dt = Change in time (in seconds) since the last game loop.
+		//   threadSafe = Whether to update the thread-safe components or all others.
+		BE_HL_API void Update(float dt, bool threadSafe);
+
+		// Update only the components that are, or are not, thread-safe for FixedUpdate.
+		// Params:
+		//	 dt = A fixed change in time, usually 1/60th of a second.
+		//   threadSafe = Whether to update the thread-safe components or all others.
+		BE_HL_API void FixedUpdate(float dt, bool threadSafe);
+
 		// Draw any visible components attached to the game object.
 		BE_HL_API void Draw() override;
 
@@ -147,6 +164,21 @@ namespace Beta
 		// Use this to manage game object archetype resources!
 		BE_HL_API static ArchetypeManager& GetArchetypeManager();
 
+		// Game objects are allocated from their own pool, so spawning
+		// and destroying objects reuses memory.
+		// (NOTE: The debug version of new in stdafx.h must not touch these.)
+#pragma push_macro("new")
+#undef new
+		BE_HL_API static void* operator new(size_t size);
+		BE_HL_API static void* operator new(size_t size, int blockType, const char* file, int line);
+		BE_HL_API static void operator delete(void* memory, size_t size);
+		BE_HL_API static void operator delete(void* memory, int blockType, const char* file, int line);
+#pragma pop_macro("new")
+
+		// Get the pool that game objects are allocated from, e.g. to
+		// reserve memory before spawning many objects at once.
+		BE_HL_API static ObjectPool& GetPool();
+
 	private:
 		//------------------------------------------------------------------------------
 		// Private Functions:
@@ -155,12 +187,23 @@ namespace Beta
 		// Deleted to prevent accidental copies of objects.
 		GameObject& operator=(const GameObject& rhs) = delete;
 
+		// Replace this object's components with those of another object,
+		// leaving the other object empty. Used to reload archetypes.
+		// Params:
+		//   other = The object whose components will be moved to this one.
+		void TakeComponents(GameObject& other);
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
 
-		// Array of components
-		Array<Component*> components;
+		// Array of components. Most objects have only a few,
+		// which are stored inside the object itself.
+		Array<Component*, 4> components;
+
+		// Components indexed by type ID, including the IDs of their base classes.
+		// Only as long as the largest type ID this object has.
+		Array<Component*> componentsByType;
 
 		// Whether or not the object should be updated and drawn.
 		bool active;
@@ -172,6 +215,8 @@ namespace Beta
 		Archetype baseArchetype;
 
 		static ArchetypeManager archetypeManager;
+
+		friend class ArchetypeManager;
 	};
 
 	#define ResourceGetArchetype(a) GameObject::GetArchetypeManager().GetResource(a)
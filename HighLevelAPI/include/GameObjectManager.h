@@ -16,7 +16,9 @@
 //------------------------------------------------------------------------------
 
 #include "GameObject.h"
+#include "Intersection2D.h"	// CircleBatch, RectangleBatch
 #include <Array.h>
+#include <mutex>	// Objects added during parallel updates
 
 //------------------------------------------------------------------------------
 
@@ -27,14 +29,30 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	class Quadtree;
+	class AABBTree;
 	struct CastResult;
 	class Vector2D;
 	class Space;
+	class JobSystem;
+	class BodyStorage;
+	class Collider;
+	struct BroadphasePair;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// Spatial data structures that can be used to find pairs of colliding objects
+	typedef enum BroadphaseType
+	{
+		// Test every pair of objects
+		BroadphaseNone,
+		// Rebuild a quadtree around the camera every step
+		BroadphaseQuadtree,
+		// Keep a dynamic tree of bounding boxes between steps
+		BroadphaseAABBTree,
+	} BroadphaseType;
+
 	// You are free to change the contents of this structure as long as you do not
 	//   change the public functions declared in the header.
 	class GameObjectManager : public BetaObject
@@ -61,7 +79,8 @@ namespace Beta
 		// Shutdown the game object manager, destroying all active objects.
 		BE_HL_API void Shutdown(void) override;
 
-		// Add a game object to the active game object list.
+		// Add a game object to the active game object list. Objects added while
+		// components are being updated in parallel are added once the update is done.
 		// Params:
 		//	 gameObject = Reference to the game object to be added to the list.
 		BE_HL_API void AddObject(GameObject& gameObject);
@@ -97,6 +116,65 @@ namespace Beta
 		// Enable or disable use of the quadtree data structure for collision detection.
 		BE_HL_API void SetQuadtreeEnabled(bool enabled);
 
+		// Get the spatial data structure currently used for collision detection and raycasts.
+		BE_HL_API BroadphaseType GetBroadphaseType() const;
+
+		// Set the spatial data structure used for collision detection and raycasts.
+		// Params:
+		//   type = The type of broadphase to use.
+		BE_HL_API void SetBroadphaseType(BroadphaseType type);
+
+		// Get the dynamic tree used when the broadphase type is BroadphaseAABBTree.
+		BE_HL_API const AABBTree& GetAABBTree() const;
+
+		// Enable or disable storing transform and rigid body data in arrays,
+		// so that physics and matrices are updated in batches.
+		// Can only be changed while the manager has no objects.
+		// Params:
+		//   enabled = Whether body storage should be used.
+		BE_HL_API void SetBodyStorageEnabled(bool enabled);
+
+		// Get the storage used for transforms and rigid bodies in this space.
+		// Returns:
+		//   A pointer to the storage, or nullptr if it is not enabled.
+		BE_HL_API BodyStorage* GetBodyStorage() const;
+
+		// Enable or disable updating thread-safe components (see Component::IsThreadSafe)
+		// in parallel using the JobSystem module. These components are then updated
+		// after all other components, rather than in their objects' order, so this
+		// is off by default. Has no effect if there is no JobSystem module.
+		// Params:
+		//   enabled = Whether thread-safe components should be updated in parallel.
+		BE_HL_API void SetParallelUpdateEnabled(bool enabled);
+
+		// Returns whether thread-safe components are updated in parallel.
+		BE_HL_API bool IsParallelUpdateEnabled() const;
+
+		// Set the time between fixed updates. Large levels can run physics
+		// at a lower rate (e.g. 30-60 Hz) to save time.
+		// Params:
+		//   dt = The fixed timestep, in seconds. Must be greater than zero.
+		BE_HL_API void SetFixedTimeStep(float dt);
+
+		// Returns the time between fixed updates, in seconds.
+		BE_HL_API float GetFixedTimeStep() const;
+
+		// Enable or disable drawing objects with rigid bodies between their
+		// last two fixed update states, so that motion stays smooth when
+		// physics runs at a different rate than the screen. Enabled by default.
+		// Params:
+		//   enabled = Whether draws should use interpolated transforms.
+		BE_HL_API void SetInterpolationEnabled(bool enabled);
+
+		// Returns whether draws use interpolated transforms.
+		BE_HL_API bool IsInterpolationEnabled() const;
+
+		// Get how far the current frame is between the last fixed update and the next.
+		// Returns:
+		//   The unused fraction of a fixed step, from 0 (last fixed update)
+		//   to 1 (current state). Always 1 if interpolation is disabled.
+		BE_HL_API float GetInterpolationAlpha() const;
+
 		// Perform a raycast and return all objects that intersect with the ray.
 		// Params:
 		//   start     = The starting point of the ray in world coordinates.
@@ -133,12 +211,39 @@ namespace Beta
 		// Update object physics using fixed timestep.
 		void FixedUpdate(float dt);
 
+		// Update thread-safe components on all threads, then add any objects
+		// that were created during the update.
+		void ParallelUpdate(JobSystem& jobSystem, UpdatePhase phase, float dt);
+
 		// Check collisions between pairs of objects.
 		void CheckCollisions();
 
 		// Check collisions using the quadtree.
 		void CheckCollisionsQuadtree();
 
+		// Check collisions using the pairs found by the AABB tree.
+		void CheckCollisionsAABBTree();
+
+		// Test the shapes of the circle and rectangle pairs found by the AABB tree
+		// together, using the batch tests in Intersection2D.
+		// Params:
+		//   pairs = The pairs found by the AABB tree.
+		void TestPairsBatched(const Array<BroadphasePair>& pairs);
+
+		// Get the result of a pair's batch test, if its shapes have not changed since.
+		// Params:
+		//   pairIndex = The index of the pair in the AABB tree's pairs.
+		//   first = The first collider of the pair.
+		//   second = The second collider of the pair.
+		//   colliding = (Out) Whether the shapes were colliding.
+		// Returns:
+		//   True if the result can be used, false if the pair must be tested again.
+		bool GetBatchedResult(unsigned pairIndex, const Collider& first, const Collider& second, bool& colliding) const;
+
+		// Move fast objects that hit something during the step back to their earliest
+		// impacts, then through the rest of the step (see Collider::StepToImpact).
+		void StepFastObjects();
+
 		// Destroy any objects marked for destruction.
 		void DestroyObjects();
 
@@ -148,17 +253,51 @@ namespace Beta
 		// Inserts objects into the quadtree
 		void PopulateQuadtree();
 
+		// Adds new objects to the AABB tree and updates the bounds of existing objects.
+		void UpdateAABBTree();
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
 
 		Array<GameObject*> objects;
 		float timeAccumulator;
-		const float fixedUpdateDt;
 
+		// Whether thread-safe components are updated using the job system
+		bool parallelUpdateEnabled;
+
+		// Objects added while components were being updated in parallel
+		bool inParallelUpdate;
+		Array<GameObject*> deferredObjects;
+		std::mutex deferredMutex;
+		float fixedUpdateDt;
+		bool interpolationEnabled;
+
+		BroadphaseType broadphaseType;
 		Quadtree* quadtree;
-		bool quadtreeEnabled;
+		AABBTree* aabbTree;
 		Array<GameObject*> collidableObjects;
+
+		// Shapes of the AABB tree's pairs that are tested together, for each kind
+		// of pair, along with the results of the tests. Each pair's slot is its
+		// index in the batches for its kind.
+		Array<unsigned> batchSlots;
+		Intersection2D::CircleBatch batchCircles[2];
+		Intersection2D::RectangleBatch batchRectangles[2];
+		Intersection2D::RectangleBatch batchMixedRectangles;
+		Intersection2D::CircleBatch batchMixedCircles;
+		Array<bool> batchCircleResults;
+		Array<bool> batchRectangleResults;
+		Array<bool> batchMixedResults;
+		Array<unsigned> batchHits;
+
+		// Fast colliders with impacts during the current step, and objects
+		// that may be in their way during the rest of the step
+		Array<Collider*> impactColliders;
+		Array<GameObject*> impactCandidates;
+
+		// Batched transform and rigid body data, if enabled
+		BodyStorage* bodyStorage;
 	};
 }
 
@@ -16,6 +16,7 @@
 //------------------------------------------------------------------------------
 
 #include "Shapes2D.h"
+#include <Array.h>
 
 //------------------------------------------------------------------------------
 
@@ -30,6 +31,47 @@ namespace Beta
 
 	namespace Intersection2D
 	{
+		//------------------------------------------------------------------------------
+		// Public Structures:
+		//------------------------------------------------------------------------------
+
+		// Circles stored as separate arrays for each field, so that batch
+		// tests can load the same field of several circles at once.
+		struct CircleBatch
+		{
+			// Add a circle to the end of the batch.
+			BE_HL_API void PushBack(const Circle& circle);
+
+			// Remove all circles from the batch.
+			BE_HL_API void Clear();
+
+			// Returns the number of circles in the batch.
+			BE_HL_API unsigned Size() const;
+
+			Array<float> x;
+			Array<float> y;
+			Array<float> radius;
+		};
+
+		// Rectangles stored as separate arrays for each side, so that batch
+		// tests can load the same side of several rectangles at once.
+		struct RectangleBatch
+		{
+			// Add a rectangle to the end of the batch.
+			BE_HL_API void PushBack(const BoundingRectangle& rectangle);
+
+			// Remove all rectangles from the batch.
+			BE_HL_API void Clear();
+
+			// Returns the number of rectangles in the batch.
+			BE_HL_API unsigned Size() const;
+
+			Array<float> left;
+			Array<float> bottom;
+			Array<float> right;
+			Array<float> top;
+		};
+
 		//------------------------------------------------------------------------------
 		// Public Function Declarations:
 		//------------------------------------------------------------------------------
@@ -116,6 +158,112 @@ namespace Beta
 		// Returns:
 		//   True if intersection, false otherwise.
 		BE_HL_API bool LineLineIntersection(const LineSegment& first, const LineSegment& second, Vector2D& intersection, float& t);
+
+		// Check whether a moving circle touches a static circle during its move.
+		// Params:
+		//  movingCircle = Start and end of the moving circle's center.
+		//  radius		 = Radius of the moving circle.
+		//  staticCircle = The circle that is not moving.
+		//  t = T value of the first contact along the move.
+		// Returns:
+		//   True if the circles touch during the move, but did not overlap at its start.
+		BE_HL_API bool MovingCircleCircleIntersection(const LineSegment& movingCircle, float radius,
+			const Circle& staticCircle, float& t);
+
+		// Check whether a moving circle touches a static rectangle during its move.
+		// Params:
+		//  movingCircle = Start and end of the moving circle's center.
+		//  radius		 = Radius of the moving circle.
+		//  staticRectangle = The rectangle that is not moving.
+		//  t = T value of the first contact along the move.
+		// Returns:
+		//   True if the shapes touch during the move, but did not overlap at its start.
+		BE_HL_API bool MovingCircleRectangleIntersection(const LineSegment& movingCircle, float radius,
+			const BoundingRectangle& staticRectangle, float& t);
+
+		// Check whether a moving rectangle touches a static rectangle during its move.
+		// Params:
+		//  movingRectangle = Start and end of the moving rectangle's center.
+		//  extents		 = Extents of the moving rectangle.
+		//  staticRectangle = The rectangle that is not moving.
+		//  t = T value of the first contact along the move.
+		// Returns:
+		//   True if the rectangles touch during the move, but did not overlap at its start.
+		BE_HL_API bool MovingRectangleRectangleIntersection(const LineSegment& movingRectangle, const Vector2D& extents,
+			const BoundingRectangle& staticRectangle, float& t);
+
+		// Check whether a moving rectangle touches a static line segment during its move.
+		// Params:
+		//  movingRectangle = Start and end of the moving rectangle's center.
+		//  extents		 = Extents of the moving rectangle.
+		//  staticLine	 = The line segment that is not moving.
+		//  t = T value of the first contact along the move.
+		// Returns:
+		//   True if the shapes touch during the move, but did not overlap at its start.
+		BE_HL_API bool MovingRectangleLineIntersection(const LineSegment& movingRectangle, const Vector2D& extents,
+			const LineSegment& staticLine, float& t);
+
+		// The batch tests below give the same results as the tests above, but test
+		// several shapes at once using SSE or AVX when the build allows it.
+
+		// Check which circles in a batch intersect a circle.
+		// Params:
+		//  circle  = The circle.
+		//  circles = The circles to test against it.
+		//  hits = (Out) The indices of the intersecting circles are added to this array.
+		BE_HL_API void CircleCircleIntersectionBatch(const Circle& circle, const CircleBatch& circles,
+			Array<unsigned>& hits);
+
+		// Check which rectangles in a batch intersect a rectangle.
+		// Params:
+		//  rect  = The rectangle.
+		//  rects = The rectangles to test against it.
+		//  hits = (Out) The indices of the intersecting rectangles are added to this array.
+		BE_HL_API void RectangleRectangleIntersectionBatch(const BoundingRectangle& rect, const RectangleBatch& rects,
+			Array<unsigned>& hits);
+
+		// Check which circles in a batch intersect a rectangle.
+		// Params:
+		//  rect    = The rectangle.
+		//  circles = The circles to test against it.
+		//  hits = (Out) The indices of the intersecting circles are added to this array.
+		BE_HL_API void RectangleCircleIntersectionBatch(const BoundingRectangle& rect, const CircleBatch& circles,
+			Array<unsigned>& hits);
+
+		// Check which rectangles in a batch intersect a circle.
+		// Params:
+		//  circle = The circle.
+		//  rects  = The rectangles to test against it.
+		//  hits = (Out) The indices of the intersecting rectangles are added to this array.
+		BE_HL_API void CircleRectangleIntersectionBatch(const Circle& circle, const RectangleBatch& rects,
+			Array<unsigned>& hits);
+
+		// Check which pairs of circles intersect. Pair i is made of the circles
+		// at index i in each batch. Both batches must be the same size.
+		// Params:
+		//  first  = The first circle of each pair.
+		//  second = The second circle of each pair.
+		//  hits = (Out) The indices of the intersecting pairs are added to this array.
+		BE_HL_API void CircleCircleIntersectionPairs(const CircleBatch& first, const CircleBatch& second,
+			Array<unsigned>& hits);
+
+		// Check which pairs of rectangles intersect. Pair i is made of the rectangles
+		// at index i in each batch. Both batches must be the same size.
+		// Params:
+		//  first  = The first rectangle of each pair.
+		//  second = The second rectangle of each pair.
+		//  hits = (Out) The indices of the intersecting pairs are added to this array.
+		BE_HL_API void RectangleRectangleIntersectionPairs(const RectangleBatch& first, const RectangleBatch& second,
+			Array<unsigned>& hits);
+
+		// Check which pairs of rectangles and circles intersect. Pair i is made of the
+		// shapes at index i in each batch. Both batches must be the same size.
+		// Params:
+		//  rects   = The rectangle of each pair.
+		//  circles = The circle of each pair.
+		//  hits = (Out) The indices of the intersecting pairs are added to this array.
+		BE_HL_API void RectangleCircleIntersectionPairs(const RectangleBatch& rects, const CircleBatch& circles,
+			Array<unsigned>& hits);
 	}
 }
 
@@ -0,0 +1,142 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	JobSystem.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <BetaObject.h>
+
+#include <functional>			// RangeFunction
+#include <deque>				// Job queues
+#include <vector>				// Worker threads
+#include <thread>				// Worker threads
+#include <mutex>				// Queue locks
+#include <condition_variable>	// Waking workers
+#include <atomic>				// Job counts
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Splits loops across a pool of worker threads. Each thread has its own
+	// queue of jobs, and threads that run out of work steal jobs from the
+	// others, so uneven loops still keep every thread busy.
+	class JobSystem : public BetaObject
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Typedefs:
+		//------------------------------------------------------------------------------
+
+		// Processes the items in the range [begin, end).
+		typedef std::function<void(unsigned begin, unsigned end)> RangeFunction;
+
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor - Starts the worker threads.
+		// Params:
+		//   numThreads = The number of threads that run jobs, including the thread
+		//     that calls ParallelFor. If 0, the number of hardware threads is used.
+		BE_HL_API JobSystem(unsigned numThreads = 0);
+
+		// Destructor - Stops the worker threads.
+		BE_HL_API ~JobSystem();
+
+		// Run a function over a range of items using all threads, and wait for it to finish.
+		// Calls made from inside a job run on the calling thread.
+		// Params:
+		//   count     = The number of items.
+		//   grainSize = The number of items given to a thread at a time.
+		//   function  = The function that processes a range of items.
+		BE_HL_API void ParallelFor(unsigned count, unsigned grainSize, const RangeFunction& function);
+
+		// Returns the number of threads that run jobs, including the calling thread.
+		BE_HL_API unsigned GetThreadCount() const;
+
+		// Restart the pool with a different number of threads.
+		// Must not be called while jobs are running.
+		// Params:
+		//   numThreads = The number of threads that run jobs, including the
+		//     thread that calls ParallelFor. If 0, the number of hardware threads is used.
+		BE_HL_API void SetThreadCount(unsigned numThreads);
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		struct Job
+		{
+			const RangeFunction* function;
+			unsigned begin;
+			unsigned end;
+			// Number of jobs from the same ParallelFor that have not finished
+			std::atomic<unsigned>* remaining;
+		};
+
+		// Jobs owned by one thread. The owner takes jobs from the back,
+		// while other threads steal from the front.
+		struct JobQueue
+		{
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		// Create the queues and worker threads.
+		void StartWorkers(unsigned numThreads);
+
+		// Stop the worker threads and destroy the queues.
+		void StopWorkers();
+
+		// Runs jobs until the job system is stopped.
+		void WorkerLoop(unsigned queueIndex);
+
+		// Take a job from a thread's own queue, or steal one from another queue.
+		bool PopJob(unsigned queueIndex, Job& job);
+
+		// Run a job and mark it as finished.
+		void RunJob(const Job& job);
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		// One queue per thread. Queue 0 belongs to the thread that calls ParallelFor.
+		std::vector<JobQueue*> queues;
+		std::vector<std::thread> workers;
+
+		// Jobs that have been queued but not yet taken by a thread
+		std::atomic<unsigned> queuedJobs;
+
+		std::mutex sleepMutex;
+		std::condition_variable workAvailable;
+		bool stopping;
+	};
+}
+
+//------------------------------------------------------------------------------
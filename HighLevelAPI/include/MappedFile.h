@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	MappedFile.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <string>
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Maps the contents of a file into memory so that it can be used in place
+	// without reading it into a separate buffer. Pages are copy-on-write: the
+	// contents can be modified, but changes are never written back to the file.
+	class MappedFile
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor - Does not map anything.
+		BE_HL_API MappedFile();
+
+		// Destructor - Unmaps the file if one is open.
+		BE_HL_API ~MappedFile();
+
+		// Map a file into memory, replacing any file that is already mapped.
+		// Params:
+		//   filename = The path of the file to map.
+		// Returns:
+		//   True if the file was mapped, false otherwise.
+		BE_HL_API bool Open(const std::string& filename);
+
+		// Unmap the current file.
+		BE_HL_API void Close();
+
+		// Test whether a file is currently mapped.
+		BE_HL_API bool IsOpen() const;
+
+		// Returns a pointer to the start of the mapped file.
+		BE_HL_API char* GetData() const;
+
+		// Returns the size of the mapped file in bytes.
+		BE_HL_API size_t GetSize() const;
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		char* data;
+		size_t size;
+	};
+}
+
+//------------------------------------------------------------------------------
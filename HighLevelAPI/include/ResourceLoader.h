@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ResourceLoader.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <BetaObject.h>
+
+#include <functional>			// LoadFunction, FinishFunction
+#include <deque>				// Load queues
+#include <vector>				// Worker threads
+#include <thread>				// Worker threads
+#include <mutex>				// Queue locks
+#include <condition_variable>	// Waking workers
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Base class for data that is read and decoded on a worker thread and
+	// then handed back to the main thread to finish creating a resource.
+	struct ResourceData
+	{
+		// Virtual destructor
+		virtual ~ResourceData() {}
+	};
+
+	// Loads resources in the background. File I/O and decoding happen on a
+	// small pool of worker threads, while the final step (such as uploading
+	// a texture to the GPU) happens on the main thread during Update, limited
+	// to a fixed amount of time per frame.
+	class ResourceLoader : public BetaObject
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Typedefs:
+		//------------------------------------------------------------------------------
+
+		// Runs on a worker thread. Returns the loaded data, or nullptr on failure.
+		typedef std::function<ResourceData*()> LoadFunction;
+
+		// Runs on the main thread with the result of the load function.
+		typedef std::function<void(ResourceData*)> FinishFunction;
+
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor - Starts the worker threads.
+		// Params:
+		//   numWorkers = The number of worker threads. If 0, a count is
+		//     chosen based on the number of hardware threads.
+		BE_HL_API ResourceLoader(unsigned numWorkers = 0);
+
+		// Destructor - Finishes all queued loads, then stops the worker threads.
+		BE_HL_API ~ResourceLoader();
+
+		// Finishes loads that are ready, until the upload budget is used up.
+		// Params:
+		//   dt = The change in time since the previous frame.
+		BE_HL_API void Update(float dt) override;
+
+		// Queue a resource to be loaded in the background.
+		// Params:
+		//   load   = Reads and decodes the resource. Must not use graphics or
+		//            any other main-thread state.
+		//   finish = Creates the resource from the loaded data. Called on the
+		//            main thread, even if loading failed. The data is deleted
+		//            once it returns.
+		BE_HL_API void QueueLoad(const LoadFunction& load, const FinishFunction& finish);
+
+		// Wait for all queued loads and finish them, ignoring the upload budget.
+		// Useful when a level cannot start until its resources are ready.
+		BE_HL_API void Flush();
+
+		// Returns the number of loads that have been queued but not yet finished.
+		BE_HL_API unsigned GetPendingCount() const;
+
+		// Set the amount of time the main thread may spend finishing loads each frame.
+		// At least one load is always finished per frame so that loading makes progress.
+		// Params:
+		//   seconds = The time budget, in seconds.
+		BE_HL_API void SetUploadBudget(float seconds);
+
+		// Returns the amount of time the main thread may spend finishing loads each frame.
+		BE_HL_API float GetUploadBudget() const;
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		struct LoadRequest
+		{
+			LoadFunction load;
+			FinishFunction finish;
+			ResourceData* data;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		ResourceLoader(const ResourceLoader&) = delete;
+		ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+		// Takes requests off the queue and loads them until the loader is destroyed.
+		void WorkerLoop();
+
+		// Finish a single completed request on the main thread.
+		void Finish(LoadRequest& request);
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		// Requests waiting for a worker
+		std::deque<LoadRequest> queued;
+		// Requests that have been loaded and are waiting for the main thread
+		std::deque<LoadRequest> completed;
+
+		std::vector<std::thread> workers;
+		mutable std::mutex mutex;
+		std::condition_variable workAvailable;
+		std::condition_variable workCompleted;
+
+		// Number of requests queued but not yet finished. Only used on the main thread.
+		unsigned pending;
+		// Set when the worker threads should exit
+		bool stopping;
+		// Seconds the main thread may spend finishing loads each frame
+		float uploadBudget;
+	};
+}
+
+//------------------------------------------------------------------------------
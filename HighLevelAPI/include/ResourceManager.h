@@ -17,8 +17,11 @@
 
 #include <BetaObject.h>
 
-#include <EngineCore.h>		// GetFilePath
+#include <EngineCore.h>		// EngineGetModule
 #include <unordered_map>	// resources, creation functions
+#include <unordered_set>	// pending resources
+
+#include "ResourceLoader.h"	// QueueLoad
 
 //------------------------------------------------------------------------------
 
@@ -28,8 +31,81 @@ namespace Beta
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// Parts of a resource manager that don't depend on the resource type. Keeps
+	// a list of every manager, so that resources can be found and reloaded when
+	// the files they were loaded from change.
+	class ResourceManagerBase
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor
+		// Params:
+		//   relativePath = The assets subfolder where this resource type can be found.
+		//	 fileExtension = The file extension used by this resource type.
+		BE_HL_API ResourceManagerBase(const std::string& relativePath, const std::string& fileExtension);
+
+		// Destructor
+		BE_HL_API virtual ~ResourceManagerBase();
+
+		// Return the path to this resource type.
+		BE_HL_API std::string GetFilePath() const;
+
+		// Return the file extension used by this resource type.
+		// Ex: .txt, .png
+		BE_HL_API const std::string& GetFileExtension() const;
+
+		// Load a resource's file again, updating the resource in place.
+		// Params:
+		//   name = The name of the resource.
+		// Returns:
+		//   True if the resource is in use and will be reloaded, false otherwise.
+		virtual bool Reload(const std::string& name) = 0;
+
+		// Reload the resources loaded from a file, in every manager whose
+		// folder and extension match the file.
+		// Params:
+		//   path = The path of the file, relative to the assets folder.
+		//     Ex: Textures/Monkey.png
+		// Returns:
+		//   True if any resource was reloaded, false otherwise.
+		BE_HL_API static bool ReloadFile(const std::string& path);
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		ResourceManagerBase(const ResourceManagerBase&) = delete;
+		ResourceManagerBase& operator=(const ResourceManagerBase&) = delete;
+
+		// Get the name of the resource loaded from a file in this manager's folder.
+		// Params:
+		//   filename = The file name, relative to this manager's folder.
+		// Returns:
+		//   The file name without its extension.
+		virtual std::string GetResourceName(const std::string& filename) const;
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		// Path to resources
+		std::string relativePath;
+
+		// File extension for this resource type
+		std::string extension;
+
+		// All managers that exist, for ReloadFile
+		ResourceManagerBase* nextManager;
+		ResourceManagerBase* prevManager;
+	};
+
 	template <typename ResourceType>
-	class ResourceManager
+	class ResourceManager : public ResourceManagerBase
 	{
 	public:
 		//------------------------------------------------------------------------------
@@ -48,7 +124,7 @@ namespace Beta
 		//   relativePath = The assets subfolder where this resource type can be found.
 		//	 fileExtension = The file extension used by this resource type.
 		ResourceManager(const std::string& relativePath, const std::string& fileExtension = ".txt")
-			: relativePath(relativePath), extension(fileExtension)
+			: ResourceManagerBase(relativePath, fileExtension)
 		{
 		}
 
@@ -105,23 +181,121 @@ namespace Beta
 			return data;
 		}
 
-		// Remove all resources from the manager.
-		void Clear()
+		// Request a resource without waiting for it to load. If the resource type
+		// supports background loading, a placeholder is returned right away and is
+		// filled in on the main thread once the file has been read and decoded.
+		// Otherwise, or if there is no ResourceLoader module, the resource is
+		// loaded immediately as with GetResource.
+		// Params:
+		//   name = The name of the resource.
+		// Returns:
+		//   The resource, which may still be a placeholder.
+		ResourcePtr RequestResource(const std::string& name)
 		{
-			resources.clear();
+			ResourcePtr data = GetResource(name, false);
+			if (data != nullptr)
+				return data;
+
+			ResourceLoader* loader = EngineGetModule(ResourceLoader);
+			if (loader == nullptr)
+				return GetResource(name);
+
+			data = CreatePlaceholder(name);
+			if (data == nullptr)
+				return GetResource(name);
+
+			resources[name] = data;
+			pending.insert(name);
+
+			// Only fill in the placeholder if someone is still using it
+			WeakResourcePtr placeholder(data);
+			loader->QueueLoad(
+				[this, name]() { return LoadData(name); },
+				[this, name, placeholder](ResourceData* loaded)
+				{
+					pending.erase(name);
+
+					ResourcePtr resource = placeholder.lock();
+					if (resource != nullptr)
+						FinishLoad(*resource, loaded);
+
+					// The file changed after it was read
+					if (reloadAgain.erase(name) != 0)
+						Reload(name);
+				});
+
+			return data;
 		}
 
-		// Return the path to this resource type.
-		std::string GetFilePath() const
+		// Test whether a requested resource is still waiting to be loaded.
+		// Params:
+		//   name = The name of the resource.
+		bool IsPending(const std::string& name) const
 		{
-			return EngineCore::GetInstance().GetFilePath() + relativePath;
+			return pending.find(name) != pending.end();
 		}
 
-		// Return the file extension used by this resource type.
-		// Ex: .txt, .png
-		const std::string& GetFileExtension() const
+		// Load a resource's file again and update the resource in place, so that
+		// anything holding a pointer to it sees the new contents. Uses LoadData and
+		// FinishLoad, so resources are read on a worker thread and updated between
+		// frames by the ResourceLoader, or right away if there is no ResourceLoader
+		// module. If the file can't be loaded, the resource keeps its old contents.
+		// Params:
+		//   name = The name of the resource.
+		// Returns:
+		//   True if the resource is in use and will be reloaded, false otherwise.
+		bool Reload(const std::string& name) override
 		{
-			return extension;
+			if (!CanReload())
+				return false;
+
+			ResourcePtr resource = GetResource(name, false);
+			if (resource == nullptr)
+				return false;
+
+			// The pending load may already have read the old file, so load it
+			// again once that one finishes
+			if (IsPending(name))
+			{
+				reloadAgain.insert(name);
+				return true;
+			}
+
+			ResourceLoader* loader = EngineGetModule(ResourceLoader);
+			if (loader == nullptr)
+			{
+				ResourceData* data = LoadData(name);
+				FinishLoad(*resource, data);
+				delete data;
+				return true;
+			}
+
+			pending.insert(name);
+
+			// Holders of the resource keep it alive, so only update it if it is still used
+			WeakResourcePtr target(resource);
+			loader->QueueLoad(
+				[this, name]() { return LoadData(name); },
+				[this, name, target](ResourceData* loaded)
+				{
+					pending.erase(name);
+
+					ResourcePtr current = target.lock();
+					if (current != nullptr)
+						FinishLoad(*current, loaded);
+
+					// The file changed after it was read
+					if (reloadAgain.erase(name) != 0)
+						Reload(name);
+				});
+
+			return true;
+		}
+
+		// Remove all resources from the manager.
+		void Clear()
+		{
+			resources.clear();
 		}
 
 	private:
@@ -135,6 +309,40 @@ namespace Beta
 
 		virtual ResourcePtr Create(const std::string& name) = 0;
 
+		// Create a stand-in for a resource that is being loaded in the background.
+		// Returns nullptr if this resource type does not support background loading.
+		virtual ResourcePtr CreatePlaceholder(const std::string& name)
+		{
+			UNREFERENCED_PARAMETER(name);
+			return nullptr;
+		}
+
+		// Read and decode a resource. Called on a worker thread.
+		// Returns nullptr if the resource could not be loaded.
+		virtual ResourceData* LoadData(const std::string& name)
+		{
+			UNREFERENCED_PARAMETER(name);
+			return nullptr;
+		}
+
+		// Whether LoadData and FinishLoad can update a resource that is already
+		// loaded, so that it can be reloaded when its file changes.
+		virtual bool CanReload() const
+		{
+			return false;
+		}
+
+		// Fill in a placeholder with loaded data. Called on the main thread.
+		// Also used by Reload to update a resource that is already loaded.
+		// Params:
+		//   placeholder = The placeholder returned by CreatePlaceholder.
+		//   data = The result of LoadData, which may be nullptr.
+		virtual void FinishLoad(ResourceType& placeholder, ResourceData* data)
+		{
+			UNREFERENCED_PARAMETER(placeholder);
+			UNREFERENCED_PARAMETER(data);
+		}
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
@@ -142,11 +350,11 @@ namespace Beta
 		// Contains all resources
 		std::unordered_map<std::string, WeakResourcePtr> resources;
 
-		// Path to resources
-		std::string relativePath;
+		// Resources that have been requested but not yet loaded
+		std::unordered_set<std::string> pending;
 
-		// File extension for this resource type
-		std::string extension;
+		// Pending resources whose files changed while they were being loaded
+		std::unordered_set<std::string> reloadAgain;
 	};
 }
 
@@ -27,6 +27,7 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	class Transform;
+	class BodyStorage;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
@@ -43,6 +44,12 @@ namespace Beta
 		// Create a new physics component.
 		BE_HL_API RigidBody();
 
+		// Copy constructor - Copies the values of another rigid body into this one's own storage.
+		BE_HL_API RigidBody(const RigidBody& other);
+
+		// Destructor - Removes this body's data from the space's body storage.
+		BE_HL_API ~RigidBody();
+
 		// Get the acceleration of a physics component.
 		// Returns:
 		//	 A reference to the component's acceleration structure.
@@ -58,6 +65,11 @@ namespace Beta
 		//   A reference to the component's oldTranslation variable.
 		BE_HL_API const Vector2D& GetOldTranslation() const;
 
+		// Get the rotation of a physics component before the last fixed update.
+		// Returns: 
+		//   The component's old rotation, in radians.
+		BE_HL_API float GetOldRotation() const;
+
 		// Get the angular velocity of a physics component.
 		// Returns:
 		//	 A float representing the new angular velocity.
@@ -89,24 +101,45 @@ namespace Beta
 		BE_HL_API void SetAngularVelocity(float velocity);
 
 		// Moves an object to the specified location, syncing
-		// its old, current, and new translations to that position.
+		// its old, current, and new translations to that position
+		// (see Transform::Teleport).
 		// Params:
 		//   position = The position that the object should be in after this function call.
 		BE_HL_API void MovePosition(const Vector2D& position);
 
-		// Initialize data, grab component dependencies.
+		// Flag the object as fast-moving, so that its collisions are found along
+		// its whole path during each fixed update instead of only where it ends up.
+		// This costs extra time, so it should only be used for small, fast objects
+		// such as bullets. Defaults to false.
+		// Params:
+		//   fastMoving = Whether the object is fast-moving.
+		BE_HL_API void SetFastMoving(bool fastMoving);
+
+		// Is the object flagged as fast-moving?
+		BE_HL_API bool IsFastMoving() const;
+
+		// Initialize data, grab component dependencies. If the space uses body
+		// storage, the body's data is moved there along with its transform's.
 		BE_HL_API void Initialize() override;
 
 		// Reset acceleration.
+		// (NOTE: Bodies in body storage are updated in a batch by the object manager.)
 		// Params:
 		//	 dt = Change in time (in seconds) since the last game loop.
 		BE_HL_API void Update(float dt) override;
 
 		// Update velocity and translation.
+		// (NOTE: Bodies in body storage are updated in a batch by the object manager.)
 		// Params:
 		//	 dt = Change in time (in seconds) since the last fixed update.
 		BE_HL_API void FixedUpdate(float dt) override;
 
+		// Rigid bodies only change their own object's transform, so they can
+		// be updated in parallel during both Update and FixedUpdate.
+		// Params:
+		//   phase = The part of the game loop that is being run.
+		BE_HL_API bool IsThreadSafe(UpdatePhase phase) const override;
+
 		// Save object data to file.
 		// Params:
 		//   stream = The stream object used to save the object's data.
@@ -118,28 +151,61 @@ namespace Beta
 		BE_HL_API void Deserialize(FileStream& stream) override;
 
 	private:
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable assignment, since the data may live in body storage
+		RigidBody& operator=(const RigidBody&) = delete;
+
+		// Point the data pointers at this body's own variables.
+		void UseLocalData();
+
+		// Transform resets the previous state when teleporting
+		friend class Transform;
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
 
+		// Data used until the body is moved into body storage.
+		Vector2D localOldTranslation;
+		float localOldRotation;
+		Vector2D localAcceleration;
+		Vector2D localVelocity;
+		float localAngularVelocity;
+		float localInverseMass;
+		Vector2D localForcesSum;
+
 		// Previous position.  May be used for resolving collisions.
-		Vector2D	oldTranslation;
+		Vector2D*	oldTranslation;
+
+		// Previous rotation. Used with oldTranslation to interpolate between fixed updates.
+		float*	oldRotation;
 
 		// Acceleration = inverseMass * (sum of forces)
-		Vector2D	acceleration;
+		Vector2D*	acceleration;
 
 		// Goal velocity
-		Vector2D	velocity;
+		Vector2D*	velocity;
 
 		// Angular velocity, the speed and direction that the object rotates.
-		float	angularVelocity;
+		float*	angularVelocity;
 
 		// Used when calculating acceleration due to forces.
 		// Used when resolving collision between two dynamic objects.
-		float	inverseMass;
+		float*	inverseMass;
 
 		// The sum of all forces acting on an object
-		Vector2D	forcesSum;
+		Vector2D*	forcesSum;
+
+		// Whether collisions are found along the body's path.
+		bool fastMoving;
+
+		// Body storage that holds this body's data, if any. Uses the transform's slot,
+		// which is kept here in case the transform is destroyed first.
+		BodyStorage* storage;
+		unsigned storageSlot;
 
 		// Components
 		Transform* transform;
@@ -37,6 +37,37 @@ namespace Beta
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// Identifies a loaded sound so that it can be played without looking up its name.
+	// Handles to sounds that have been removed are ignored.
+	struct BE_HL_API SoundHandle
+	{
+		// Creates a handle that does not refer to any sound.
+		SoundHandle();
+
+		// Returns whether the handle was given to a sound.
+		bool IsValid() const;
+
+		unsigned index;		 // Slot in the sound manager.
+		unsigned generation; // Incremented each time the slot is reused.
+	};
+
+	// Counters describing the sound effects played by the sound manager.
+	struct BE_HL_API SoundStats
+	{
+		SoundStats();
+
+		// Number of sound effects currently playing.
+		unsigned activeVoices;
+		// Most sound effects that have played at the same time.
+		unsigned peakVoices;
+		// Number of sound effects started.
+		unsigned plays;
+		// Number of sound effects stopped early to make room for another.
+		unsigned voicesStolen;
+		// Number of sound effects not started because every voice was more important.
+		unsigned playsRejected;
+	};
+
 	class SoundManager : public BetaObject
 	{
 	public:
@@ -45,7 +76,10 @@ namespace Beta
 		//------------------------------------------------------------------------------
 
 		// Constructor - initializes FMOD.
-		BE_HL_API SoundManager();
+		// Params:
+		//   noSound = Whether to mix sounds without sending them to an audio device,
+		//     e.g. for headless runs and tests.
+		BE_HL_API SoundManager(bool noSound = false);
 
 		// Destructor
 		BE_HL_API ~SoundManager();
@@ -81,6 +115,44 @@ namespace Beta
 		//	 name = The name of the sound to be played.
 		BE_HL_API void PlaySound(const std::string& name);
 
+		// Plays a sound without looking up its name.
+		// Params:
+		//	 sound = The handle returned by GetSound.
+		BE_HL_API void PlaySound(SoundHandle sound);
+
+		// Finds a loaded sound, so that it can be played often without looking up its name.
+		// Params:
+		//	 name = The name of the sound.
+		// Returns:
+		//   A handle to the sound, or an invalid handle if no sound has that name.
+		BE_HL_API SoundHandle GetSound(const std::string& name) const;
+
+		// Set the number of copies of a sound effect that can play at the same time.
+		// When the limit is reached, the oldest copy is stopped to play a new one.
+		// Params:
+		//	 sound = The handle returned by GetSound.
+		//   maxVoices = The number of copies, or 0 for no limit.
+		BE_HL_API void SetVoiceLimit(SoundHandle sound, unsigned maxVoices);
+
+		// Set how important a sound effect is when all voices are in use.
+		// Params:
+		//	 sound = The handle returned by GetSound.
+		//   priority = From 0 (most important) to 256 (least important). Defaults to 128.
+		BE_HL_API void SetPriority(SoundHandle sound, int priority);
+
+		// Set the number of sound effects that can play at the same time. When
+		// the limit is reached, the least important and then oldest sound is
+		// stopped, unless the new sound is less important than all of them.
+		// Params:
+		//   maxVoices = The number of sound effects, or 0 for no limit. Defaults to 64.
+		BE_HL_API void SetMaxVoices(unsigned maxVoices);
+
+		// Returns the number of sound effects that can play at the same time.
+		BE_HL_API unsigned GetMaxVoices() const;
+
+		// Returns counters describing the sound effects that have been played.
+		BE_HL_API const SoundStats& GetStats() const;
+
 		// Starts an audio event with the given name.
 		// The event must be in one of the loaded banks.
 		// Params:
@@ -97,6 +97,14 @@ namespace Beta
 		// Get the camera used by this space.
 		BE_HL_API Camera& GetCamera() const;
 
+		// Set the time between physics updates for objects in this space.
+		// Params:
+		//   dt = The fixed timestep, in seconds.
+		BE_HL_API void SetFixedTimeStep(float dt);
+
+		// Returns the time between physics updates for objects in this space.
+		BE_HL_API float GetFixedTimeStep() const;
+
 	private:
 		//------------------------------------------------------------------------------
 		// Private Functions:
@@ -122,6 +122,12 @@ namespace Beta
 		// Set whether to flip the sprite vertically when drawing
 		BE_HL_API void SetFlipY(bool flipY);
 
+		// Returns whether the sprite is flipped horizontally when drawing
+		BE_HL_API bool GetFlipX() const;
+
+		// Returns whether the sprite is flipped vertically when drawing
+		BE_HL_API bool GetFlipY() const;
+
 		// Save object data to file.
 		// Params:
 		//   stream = The stream object used to save the object's data.
@@ -18,6 +18,9 @@
 #include "Serializable.h"
 #include "ResourceManager.h"
 
+#include <Vector2D.h>	// Atlas region
+#include <atomic>		// Atlas setting used by worker threads
+
 //------------------------------------------------------------------------------
 
 namespace Beta
@@ -26,13 +29,15 @@ namespace Beta
 	// Forward Declarations:
 	//------------------------------------------------------------------------------
 
-	class Vector2D;
 	class SpriteSource;
 	typedef std::shared_ptr<SpriteSource> SpriteSourcePtr;
 	typedef std::shared_ptr<const SpriteSource> ConstSpriteSourcePtr;
 	class Texture;
 	typedef std::shared_ptr<Texture> TexturePtr;
 	typedef std::shared_ptr<const Texture> ConstTexturePtr;
+	struct TextureImage;
+	class TextureAtlas;
+	struct AtlasStats;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
@@ -42,8 +47,45 @@ namespace Beta
 	{
 	public:
 		BE_HL_API SpriteSourceManager();
+		BE_HL_API ~SpriteSourceManager();
+
+		// Pack the textures of sprite sources loaded from now on into shared atlas
+		// pages, so that sprites using different sprite sources can be drawn without
+		// switching textures. Sprite sources that were already loaded are unchanged,
+		// and textures too large for a page keep their own texture.
+		// Params:
+		//   enabled = Whether to use the atlas.
+		//   pageSize = The width and height of each atlas page, in pixels. Only
+		//     used the first time the atlas is enabled.
+		BE_HL_API void SetAtlasEnabled(bool enabled, unsigned pageSize = 2048);
+
+		// Returns how well textures have been packed into the atlas.
+		BE_HL_API AtlasStats GetAtlasStats() const;
+
+		// Print the atlas's packing efficiency, along with the number of texture
+		// binds and draw calls made by the sprite batch during the last frame.
+		BE_HL_API void PrintAtlasReport() const;
+
 	private:
 		SpriteSourcePtr Create(const std::string& name) override;
+
+		// Background loading - The placeholder is a blank, single-frame sprite source.
+		// Once loaded, its texture is requested in the background as well.
+		SpriteSourcePtr CreatePlaceholder(const std::string& name) override;
+		ResourceData* LoadData(const std::string& name) override;
+		bool CanReload() const override;
+		void FinishLoad(SpriteSource& placeholder, ResourceData* data) override;
+
+		// Try to place a sprite source's texture in the atlas.
+		// Params:
+		//   spriteSource = The sprite source that will use the atlas.
+		//   image = The decoded texture, or nullptr to load it now.
+		// Returns:
+		//   True if the sprite source now uses the atlas, false otherwise.
+		bool UseAtlas(SpriteSource& spriteSource, const TextureImage* image);
+
+		TextureAtlas* atlas;
+		std::atomic<bool> atlasEnabled;
 	};
 
 	class TextureManager : public ResourceManager<Texture>
@@ -52,6 +94,16 @@ namespace Beta
 		BE_HL_API TextureManager();
 	private:
 		TexturePtr Create(const std::string& name) override;
+
+		// Background loading - The placeholder is a 1x1 white texture, and the
+		// decoded image is uploaded into it on the main thread.
+		TexturePtr CreatePlaceholder(const std::string& name) override;
+		ResourceData* LoadData(const std::string& name) override;
+		bool CanReload() const override;
+		void FinishLoad(Texture& placeholder, ResourceData* data) override;
+
+		// Textures are named by their file name, including the extension.
+		std::string GetResourceName(const std::string& filename) const override;
 	};
 
 	class SpriteSource : public Serializable
@@ -76,6 +128,15 @@ namespace Beta
 		//   flipY	    = Whether to flip the sprite vertically when rendering.
 		BE_HL_API void UseTexture(unsigned frameIndex, bool flipX = false, bool flipY = false) const;
 
+		// Retrieves the texture and texture coordinates needed to draw the given frame.
+		// Params:
+		//   frameIndex = The index of the frame of the texture that we want to use.
+		//   uvOffset   = (Out) The texture coordinate offset of the frame.
+		//   uvStride   = (Out) The size of a single frame in texture coordinates.
+		// Returns:
+		//   The texture that contains the frame.
+		BE_HL_API const Texture& GetFrameTexture(unsigned frameIndex, Vector2D& uvOffset, Vector2D& uvStride) const;
+
 		// Returns the maximum number of possible frames in the sprite source's texture (rows * cols).
 		BE_HL_API unsigned GetFrameCount() const;
 
@@ -124,6 +185,11 @@ namespace Beta
 		// Pointer to a texture created using the Low Level API.
 		ConstTexturePtr texture;
 
+		// Area of the texture that holds the sprite sheet, in texture coordinates.
+		// Covers the whole texture unless the sheet was packed into an atlas.
+		Vector2D uvOrigin;
+		Vector2D uvSize;
+
 		// Name of sprite source
 		std::string name;
 
@@ -136,6 +202,8 @@ namespace Beta
 
 	#define ResourceGetSpriteSource(s) SpriteSource::GetSpriteSourceManager().GetResource(s)
 	#define ResourceGetTexture(t) SpriteSource::GetTextureManager().GetResource(t)
+	#define ResourceRequestSpriteSource(s) SpriteSource::GetSpriteSourceManager().RequestResource(s)
+	#define ResourceRequestTexture(t) SpriteSource::GetTextureManager().RequestResource(t)
 }
 
 //----------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 //------------------------------------------------------------------------------
 
 #include "Sprite.h"
+#include <Array.h>
 
 //------------------------------------------------------------------------------
 
@@ -28,11 +29,27 @@ namespace Beta
 	class Tilemap;
 	typedef std::shared_ptr<const Tilemap> ConstTilemapPtr;
 	class Area;
+	class Texture;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// Counters describing the work done by a tilemap sprite during its last draw.
+	struct BE_HL_API SpriteTilemapStats
+	{
+		SpriteTilemapStats();
+
+		// Number of chunks that overlapped the screen.
+		unsigned chunksVisible;
+		// Number of chunks whose meshes had to be rebuilt.
+		unsigned chunksRebuilt;
+		// Number of tiles in the visible chunks.
+		unsigned tiles;
+		// Number of chunk meshes sent to the graphics engine.
+		unsigned drawCalls;
+	};
+
 	// You are free to change the contents of this structure as long as you do not
 	//   change the public interface declared in the header.
 	class SpriteTilemap : public Sprite
@@ -51,7 +68,8 @@ namespace Beta
 		// Update area data.
 		BE_HL_API void Update(float dt) override;
 
-		// Draw the tilemap
+		// Draw the chunks of the tilemap that are on screen. Each chunk's tiles are
+		// cached in a single mesh that is only rebuilt when the chunk changes.
 		BE_HL_API void Draw() override;
 
 		// Sets the tilemap data that will be used by the sprite.
@@ -69,7 +87,41 @@ namespace Beta
 		//   stream = The stream for the file we want to write to.
 		BE_HL_API virtual void Serialize(FileStream& stream) const;
 
+		// Returns counters for the most recent draw.
+		BE_HL_API const SpriteTilemapStats& GetStats() const;
+
 	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		// Tiles in a chunk that use the same texture
+		struct ChunkBatch
+		{
+			MeshPtr mesh;
+			const Texture* texture;
+			unsigned tiles;
+		};
+
+		struct Chunk
+		{
+			Chunk();
+
+			Array<ChunkBatch> batches;
+			unsigned revision; // Tilemap chunk revision the meshes were built from
+			bool built;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Discard all cached chunk meshes.
+		void ResetChunks();
+
+		// Create the meshes for the tiles in a chunk.
+		void BuildChunk(Chunk& chunk, unsigned chunkX, unsigned chunkY);
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
@@ -77,6 +129,19 @@ namespace Beta
 		// The tilemap
 		ConstTilemapPtr map;
 
+		// Cached chunk meshes, and the state they were built with
+		Array<Chunk> chunks;
+		unsigned chunkCountX;
+		unsigned chunkCountY;
+		const Tilemap* builtMap;
+		unsigned builtRevision;
+		ConstSpriteSourcePtr builtSpriteSource;
+		bool builtFlipX;
+		bool builtFlipY;
+
+		// Counters for the most recent draw
+		SpriteTilemapStats stats;
+
 		// Area component
 		Area* area;
 
@@ -30,6 +30,7 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	class GameObject;
+	class MappedFile;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
@@ -87,7 +88,7 @@ namespace Beta
 		//   width = The width of the map.
 		//   height = The height of the map.
 		//   name = The name of the map.
-		//   data = The array containing the map data.
+		//   data = The array containing the map data, indexed [column][row]. The map stores a copy.
 		BE_HL_API Tilemap(unsigned width = 0, unsigned height = 0, const std::string& name = "", int** data = nullptr);
 
 		// Destructor.
@@ -173,6 +174,60 @@ namespace Beta
 		//   stream = The stream for the file we want to write to.
 		BE_HL_API virtual void Serialize(FileStream& stream) const;
 
+		// Loads the map from a binary tilemap file. Uncompressed cell data is
+		// mapped into memory and used in place instead of being copied.
+		// Params:
+		//   filename = The path of the binary file.
+		// Returns:
+		//   True if the map was loaded, false otherwise.
+		BE_HL_API bool DeserializeBinary(const std::string& filename);
+
+		// Saves the map to a binary tilemap file.
+		// Params:
+		//   filename = The path of the binary file.
+		//   compress = Whether to run-length encode the cells. Compressed files are
+		//     smaller, but must be decoded when loaded instead of being used in place.
+		// Returns:
+		//   True if the map was saved, false otherwise.
+		BE_HL_API bool SerializeBinary(const std::string& filename, bool compress = false) const;
+
+		// Converts a tilemap from the text format to the binary format.
+		// Params:
+		//   textFilename = The path of the existing text file.
+		//   binaryFilename = The path of the binary file to create.
+		//   compress = Whether to run-length encode the cells.
+		// Returns:
+		//   True if the map was converted, false otherwise.
+		BE_HL_API static bool ConvertToBinary(const std::string& textFilename,
+			const std::string& binaryFilename, bool compress = false);
+
+		// Test whether the cells are used in place from a mapped binary file.
+		BE_HL_API bool IsMapped() const;
+
+		// Returns the cells of the map, stored row by row (GetWidth() cells per row).
+		BE_HL_API const int* GetCellData() const;
+
+		// Returns the width and height of the square chunks used to track changes (in tiles).
+		BE_HL_API static unsigned GetChunkSize();
+
+		// Gets the number of chunks needed to cover the width of the map.
+		BE_HL_API unsigned GetChunkCountX() const;
+
+		// Gets the number of chunks needed to cover the height of the map.
+		BE_HL_API unsigned GetChunkCountY() const;
+
+		// Returns a number that changes whenever a cell in the given chunk is set.
+		// Chunks start at the minimum indices of the map.
+		// Params:
+		//   chunkX = The column of the chunk.
+		//   chunkY = The row of the chunk.
+		BE_HL_API unsigned GetChunkRevision(unsigned chunkX, unsigned chunkY) const;
+
+		// Returns a number that changes whenever the whole map changes
+		// (when it is resized, cleared, or loaded). Chunk revisions are
+		// reset when this happens.
+		BE_HL_API unsigned GetRevision() const;
+
 		// Return the constant representing an invalid index for the tilemap.
 		BE_HL_API static const int InvalidIndex();
 
@@ -183,6 +238,16 @@ namespace Beta
 		BE_HL_API static TilemapManager& GetTilemapManager();
 
 	private:
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Free the cells, or unmap them if they came from a binary file.
+		void ReleaseData();
+
+		// Mark the whole map as changed and reset chunk revisions to match its size.
+		void ResetChunks();
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
@@ -195,8 +260,15 @@ namespace Beta
 		int offsetX;
 		int offsetY;
 
-		// The map data (a 2D array)
-		int** data;
+		// The map data (width * height cells, stored row by row)
+		int* data;
+
+		// Binary file that the cells are mapped from, if any
+		MappedFile* mappedFile;
+
+		// Change tracking
+		Array<unsigned> chunkRevisions;
+		unsigned revision;
 
 		// Objects in map
 		Array<ObjectInMap> objects;
@@ -206,6 +278,7 @@ namespace Beta
 
 		static TilemapManager tilemapManager;
 		static const int invalidIndex;
+		static const unsigned chunkSize;
 	};
 
 	//------------------------------------------------------------------------------
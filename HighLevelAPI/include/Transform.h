@@ -23,6 +23,12 @@
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Forward References:
+	//------------------------------------------------------------------------------
+
+	class BodyStorage;
+
 	//------------------------------------------------------------------------------
 	// Public Structures:
 	//------------------------------------------------------------------------------
@@ -50,6 +56,15 @@ namespace Beta
 		//   rotation	 = Rotation of the object about the z-axis.
 		BE_HL_API Transform(Vector2D translation = Vector2D(), Vector2D scale = Vector2D(1,1), float rotation = 0);
 
+		// Copy constructor - Copies the values of another transform into this one's own storage.
+		BE_HL_API Transform(const Transform& other);
+
+		// Destructor - Releases this transform's slot in the space's body storage.
+		BE_HL_API ~Transform();
+
+		// Moves this transform's data into the space's body storage, if it has one.
+		BE_HL_API void Initialize() override;
+
 		// Get the transform matrix, based upon translation, rotation and scale settings.
 		// Returns:
 		//	 A reference to the transform's matrix.
@@ -60,6 +75,18 @@ namespace Beta
 		//	 A reference to the transform's inverse matrix.
 		BE_HL_API const Matrix2D& GetInverseMatrix() const;
 
+		// Get the matrix that should be used to draw the object. Objects with rigid
+		// bodies are drawn between their previous and current fixed update states,
+		// using the space's interpolation alpha.
+		// Returns:
+		//	 The interpolated matrix, or the transform matrix if there is nothing to interpolate.
+		BE_HL_API Matrix2D GetDrawMatrix() const;
+
+		// Get the translation that should be used to draw the object (see GetDrawMatrix).
+		// Returns:
+		//	 The interpolated translation, or the translation if there is nothing to interpolate.
+		BE_HL_API Vector2D GetDrawTranslation() const;
+
 		// Set the translation of a transform component.
 		// Params:
 		//	 translation = Reference to a translation vector.
@@ -75,6 +102,14 @@ namespace Beta
 		//	 y = The new value for the translation's y-component.
 		BE_HL_API void SetTranslationY(float y);
 
+		// Move the object to a new translation without drawing it between its old
+		// and new positions. Objects with rigid bodies are drawn partway between
+		// fixed updates, so use this rather than SetTranslation when moving them
+		// outside of physics (e.g. wrapping around the screen or respawning).
+		// Params:
+		//	 translation = Reference to a translation vector.
+		BE_HL_API void Teleport(const Vector2D& translation);
+
 		// Get the translation of a transform component.
 		// Returns:
 		//	 A reference to the component's translation structure.
@@ -116,6 +151,16 @@ namespace Beta
 		// Tests whether the object is visible on screen.
 		BE_HL_API bool IsOnScreen() const;
 
+		// Calculates a transform matrix and its inverse.
+		// Params:
+		//   translation = World position of the object.
+		//   rotation = Rotation of the object about the z-axis.
+		//   scale = Width and height of the object.
+		//   matrix = (Out) The transform matrix.
+		//   inverseMatrix = (Out) The inverse of the transform matrix.
+		BE_HL_API static void ComputeMatrices(const Vector2D& translation, float rotation,
+			const Vector2D& scale, Matrix2D& matrix, Matrix2D& inverseMatrix);
+
 		// Save object data to file.
 		// Params:
 		//   stream = The stream object used to save the object's data.
@@ -131,33 +176,71 @@ namespace Beta
 		// Private Functions:
 		//------------------------------------------------------------------------------
 
+		// Disable assignment, since the data may live in body storage
+		Transform& operator=(const Transform&) = delete;
+
 		// Calculates the transform matrix and its inverse using translation, rotation, and scale.
 		void CalculateMatrices() const;
 
+		// Finds the translation and rotation to draw with, between the last two fixed updates.
+		// Params:
+		//   drawTranslation = (Out) The interpolated translation.
+		//   drawRotation = (Out) The interpolated rotation.
+		// Returns:
+		//   False if the object should be drawn using its current state.
+		bool GetInterpolatedState(Vector2D& drawTranslation, float& drawRotation) const;
+
+		// Moves this transform's data into the given storage. Does nothing if already moved.
+		void AttachStorage(BodyStorage& storage);
+
+		// Point the data pointers at this transform's own variables.
+		void UseLocalData();
+
+		// Tell the body storage whether the owner is updated, so that a stored
+		// rigid body only moves while its object is active and not destroyed.
+		void UpdateStorageActive();
+
+		// RigidBody shares this transform's storage slot
+		friend class RigidBody;
+		// GameObject reports changes to whether it is active
+		friend class GameObject;
+
 		//------------------------------------------------------------------------------
 		// Private Variables:
 		//------------------------------------------------------------------------------
 
+		// Data used until the transform is moved into body storage.
+		Vector2D localTranslation;
+		float localRotation;
+		Vector2D localScale;
+		Matrix2D localMatrix;
+		Matrix2D localInverseMatrix;
+		bool localIsDirty;
+
 		// The translation (or world position) of a game object.
-		Vector2D	translation;
+		Vector2D*	translation;
 
 		// The rotation (or orientation) of a game object.
-		float	rotation;
+		float*	rotation;
 
 		// The scale (or size) of a game object.
 		// This should be initialized to (1, 1).
-		Vector2D	scale;
+		Vector2D*	scale;
 
 		// The transformation matrix resulting from concatenating translation, 
 		// rotation, and scale matrices.
-		mutable Matrix2D matrix;
+		Matrix2D* matrix;
 
 		// The inverse of the transformation matrix. 
-		mutable Matrix2D inverseMatrix;
+		Matrix2D* inverseMatrix;
 
 		// True if the transformation matrix needs to be recalculated.
 		// This should be initialized to true.
-		mutable bool isDirty;
+		bool* isDirty;
+
+		// Body storage that holds this transform's data, if any, and its slot.
+		BodyStorage* storage;
+		unsigned storageSlot;
 
 		// RTTI
 		COMPONENT_SUBCLASS_DECLARATION(Transform)
@@ -0,0 +1,774 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	AABBTree.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "AABBTree.h"
+
+// STD
+#include <algorithm>        // sort
+
+// Math
+#include "Intersection2D.h" // RectangleRectangleIntersection
+
+// Systems
+#include <EngineCore.h>		// GetModule
+#include <DebugDraw.h>		// AddRectangle
+#include <GraphicsEngine.h>	// GetDefaultCamera
+#include "Quadtree.h"		// CastResult
+
+// Components
+#include "GameObject.h"		// GetComponent, GetName
+#include "Collider.h"		// IsIntersectingWith
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// How far ahead to extend bounds in the direction of movement, in steps
+		const float displacementMultiplier = 2.0f;
+
+		// Margin used for objects with no size
+		const float minimumMargin = 0.01f;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Declarations:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Creates a rectangle from its sides.
+		BoundingRectangle RectangleFromSides(float left, float right, float bottom, float top);
+
+		// Creates the smallest rectangle containing both rectangles.
+		BoundingRectangle Combine(const BoundingRectangle& first, const BoundingRectangle& second);
+
+		// Tests whether the first rectangle entirely contains the second.
+		bool Contains(const BoundingRectangle& outer, const BoundingRectangle& inner);
+
+		// Used as the cost of a node. (Perimeter is the 2D equivalent of surface area.)
+		float Perimeter(const BoundingRectangle& rect);
+
+		// Tests whether a segment passes through a rectangle, including when it starts inside.
+		bool SegmentOverlapsRectangle(const LineSegment& segment, const BoundingRectangle& rect);
+	}
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Pair constructors
+	BroadphasePair::BroadphasePair()
+		: proxyA(AABBTree::nullProxy), proxyB(AABBTree::nullProxy)
+	{
+	}
+
+	BroadphasePair::BroadphasePair(int proxyA, int proxyB)
+		: proxyA(std::min(proxyA, proxyB)), proxyB(std::max(proxyA, proxyB))
+	{
+	}
+
+	bool BroadphasePair::operator<(const BroadphasePair& other) const
+	{
+		if (proxyA != other.proxyA)
+			return proxyA < other.proxyA;
+		return proxyB < other.proxyB;
+	}
+
+	// Constructor
+	// Params:
+	//   margin = How much to enlarge stored bounds, as a fraction of their size.
+	AABBTree::AABBTree(float margin)
+		: root(nullProxy), freeList(nullProxy), objectCount(0), margin(margin)
+	{
+		nodes.Reserve(64);
+	}
+
+	// Draws the bounds of each object in the tree (for debug purposes only).
+	void AABBTree::Draw() const
+	{
+		DebugDraw& debugDraw = *EngineGetModule(DebugDraw);
+		debugDraw.SetCamera(EngineGetModule(GraphicsEngine)->GetDefaultCamera());
+
+		size_t numNodes = nodes.Size();
+		for (size_t i = 0; i < numNodes; ++i)
+		{
+			if (nodes[i].height == 0)
+				debugDraw.AddRectangle(nodes[i].bounds.center, nodes[i].bounds.extents);
+		}
+	}
+
+	// Adds an object to the tree.
+	// Params:
+	//   object = The game object being added to the tree.
+	//   bounds = The world-space bounds of the object.
+	// Returns:
+	//   The ID of the proxy that represents the object in the tree.
+	int AABBTree::AddObject(GameObject* object, const BoundingRectangle& bounds)
+	{
+		int proxy = AllocateNode();
+		Node& node = nodes[proxy];
+		node.bounds = Fatten(bounds, Vector2D());
+		node.object = object;
+		node.height = 0;
+		node.moved = true;
+
+		InsertLeaf(proxy);
+		moveBuffer.PushBack(proxy);
+		++objectCount;
+
+		return proxy;
+	}
+
+	// Removes an object from the tree.
+	// Params:
+	//   proxy = The ID returned when the object was added.
+	void AABBTree::RemoveObject(int proxy)
+	{
+		if (proxy < 0 || proxy >= static_cast<int>(nodes.Size()) || !nodes[proxy].IsLeaf())
+			return;
+
+		// Remove from pending moves
+		for (auto it = moveBuffer.Begin(); it != moveBuffer.End(); ++it)
+		{
+			if (*it == proxy)
+				*it = nullProxy;
+		}
+
+		// Remove any pairs using this proxy
+		size_t kept = 0;
+		size_t numPairs = pairs.Size();
+		for (size_t i = 0; i < numPairs; ++i)
+		{
+			if (pairs[i].proxyA != proxy && pairs[i].proxyB != proxy)
+				pairs[kept++] = pairs[i];
+		}
+		pairs.Resize(kept);
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		--objectCount;
+	}
+
+	// Updates the bounds of an object. The object is only reinserted if it has
+	// left its fattened bounds.
+	// Params:
+	//   proxy        = The ID returned when the object was added.
+	//   bounds       = The new world-space bounds of the object.
+	//   displacement = How far the object moved this step, used to predict its next position.
+	// Returns:
+	//   True if the object had to be reinserted, false otherwise.
+	bool AABBTree::UpdateObject(int proxy, const BoundingRectangle& bounds, const Vector2D& displacement)
+	{
+		// Still inside fat bounds - nothing to do
+		if (Contains(nodes[proxy].bounds, bounds))
+			return false;
+
+		RemoveLeaf(proxy);
+		nodes[proxy].bounds = Fatten(bounds, displacement);
+		InsertLeaf(proxy);
+
+		if (!nodes[proxy].moved)
+		{
+			nodes[proxy].moved = true;
+			moveBuffer.PushBack(proxy);
+		}
+
+		return true;
+	}
+
+	// Recomputes the list of overlapping pairs. Only objects that were added
+	// or reinserted since the last call are queried against the tree.
+	void AABBTree::UpdatePairs()
+	{
+		if (moveBuffer.IsEmpty())
+			return;
+
+		// Pairs involving moved proxies may no longer overlap
+		size_t kept = 0;
+		size_t numPairs = pairs.Size();
+		for (size_t i = 0; i < numPairs; ++i)
+		{
+			if (!nodes[pairs[i].proxyA].moved && !nodes[pairs[i].proxyB].moved)
+				pairs[kept++] = pairs[i];
+		}
+		pairs.Resize(kept);
+
+		// Query the tree with each moved proxy
+		for (auto it = moveBuffer.Begin(); it != moveBuffer.End(); ++it)
+		{
+			int proxy = *it;
+			if (proxy == nullProxy)
+				continue;
+
+			const BoundingRectangle& bounds = nodes[proxy].bounds;
+
+			stack.Clear();
+			stack.PushBack(root);
+			while (!stack.IsEmpty())
+			{
+				int current = stack.Back();
+				stack.PopBack();
+
+				if (current == nullProxy)
+					continue;
+
+				const Node& node = nodes[current];
+				if (!Intersection2D::RectangleRectangleIntersection(node.bounds, bounds))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					// When both moved, only the smaller ID adds the pair
+					if (current != proxy && !(node.moved && current < proxy))
+						AddPair(proxy, current);
+				}
+				else
+				{
+					stack.PushBack(node.child1);
+					stack.PushBack(node.child2);
+				}
+			}
+		}
+
+		// Reset move flags
+		for (auto it = moveBuffer.Begin(); it != moveBuffer.End(); ++it)
+		{
+			if (*it != nullProxy)
+				nodes[*it].moved = false;
+		}
+		moveBuffer.Clear();
+
+		// Keep pair order stable so collision events are sent in a consistent order
+		std::sort(pairs.Begin(), pairs.End());
+	}
+
+	// Returns the list of overlapping pairs as of the last call to UpdatePairs.
+	const Array<BroadphasePair>& AABBTree::GetPairs() const
+	{
+		return pairs;
+	}
+
+	// Returns the game object associated with a proxy.
+	GameObject* AABBTree::GetObject(int proxy) const
+	{
+		return nodes[proxy].object;
+	}
+
+	// Retrieve all objects whose bounds overlap the given area.
+	// Params:
+	//   bounds  = The area to search.
+	//   results = The list that stores the nearby objects.
+	void AABBTree::RetrieveNearbyObjects(const BoundingRectangle& bounds, Array<GameObject*>& results) const
+	{
+		stack.Clear();
+		stack.PushBack(root);
+		while (!stack.IsEmpty())
+		{
+			int current = stack.Back();
+			stack.PopBack();
+
+			if (current == nullProxy)
+				continue;
+
+			const Node& node = nodes[current];
+			if (!Intersection2D::RectangleRectangleIntersection(node.bounds, bounds))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				results.PushBack(node.object);
+			}
+			else
+			{
+				stack.PushBack(node.child1);
+				stack.PushBack(node.child2);
+			}
+		}
+	}
+
+	// Retrieve all objects from the tree that intersect with a given ray.
+	// Params:
+	//   ray     = The ray to test against.
+	//   results = Intersecting objects and their distance from the ray's origin.
+	//   filter  = Objects with this name are excluded.
+	void AABBTree::CastRay(const LineSegment& ray, Array<CastResult>& results, const std::string& filter) const
+	{
+		stack.Clear();
+		stack.PushBack(root);
+		while (!stack.IsEmpty())
+		{
+			int current = stack.Back();
+			stack.PopBack();
+
+			if (current == nullProxy)
+				continue;
+
+			const Node& node = nodes[current];
+			if (!SegmentOverlapsRectangle(ray, node.bounds))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				Collider* collider = node.object->GetComponent<Collider>();
+				float t = 0.0f;
+
+				// Ray intersection test
+				if (collider && node.object->GetName() != filter && collider->IsIntersectingWith(ray, t))
+				{
+					results.PushBack(CastResult(node.object, t));
+				}
+			}
+			else
+			{
+				stack.PushBack(node.child1);
+				stack.PushBack(node.child2);
+			}
+		}
+	}
+
+	// Remove all objects from the tree.
+	void AABBTree::Clear()
+	{
+		nodes.Clear();
+		moveBuffer.Clear();
+		pairs.Clear();
+		root = nullProxy;
+		freeList = nullProxy;
+		objectCount = 0;
+	}
+
+	// Returns the number of objects in the tree.
+	unsigned AABBTree::GetObjectCount() const
+	{
+		return objectCount;
+	}
+
+	// Returns the height of the tree (0 for an empty tree or a single leaf).
+	int AABBTree::GetHeight() const
+	{
+		if (root == nullProxy)
+			return 0;
+		return nodes[root].height;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	bool AABBTree::Node::IsLeaf() const
+	{
+		return child1 == nullProxy;
+	}
+
+	// Take a node from the free list, growing the pool if needed.
+	int AABBTree::AllocateNode()
+	{
+		int index;
+		if (freeList != nullProxy)
+		{
+			index = freeList;
+			freeList = nodes[index].parent;
+		}
+		else
+		{
+			index = static_cast<int>(nodes.Size());
+			nodes.PushBack(Node());
+		}
+
+		Node& node = nodes[index];
+		node.object = nullptr;
+		node.parent = nullProxy;
+		node.child1 = nullProxy;
+		node.child2 = nullProxy;
+		node.height = 0;
+		node.moved = false;
+
+		return index;
+	}
+
+	// Return a node to the free list.
+	void AABBTree::FreeNode(int node)
+	{
+		nodes[node].parent = freeList;
+		nodes[node].child1 = nullProxy;
+		nodes[node].child2 = nullProxy;
+		nodes[node].height = -1;
+		nodes[node].object = nullptr;
+		nodes[node].moved = false;
+		freeList = node;
+	}
+
+	// Attach a leaf to the tree, choosing the sibling that increases cost the least.
+	void AABBTree::InsertLeaf(int leaf)
+	{
+		if (root == nullProxy)
+		{
+			root = leaf;
+			nodes[root].parent = nullProxy;
+			return;
+		}
+
+		// Find the best sibling for this leaf
+		const BoundingRectangle leafBounds = nodes[leaf].bounds;
+		int index = root;
+		while (!nodes[index].IsLeaf())
+		{
+			int child1 = nodes[index].child1;
+			int child2 = nodes[index].child2;
+
+			float perimeter = Perimeter(nodes[index].bounds);
+			float combinedPerimeter = Perimeter(Combine(nodes[index].bounds, leafBounds));
+
+			// Cost of creating a new parent for this node and the new leaf
+			float cost = 2.0f * combinedPerimeter;
+
+			// Minimum cost of pushing the leaf further down the tree
+			float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+			// Cost of descending into each child
+			float cost1 = Perimeter(Combine(leafBounds, nodes[child1].bounds)) + inheritanceCost;
+			if (!nodes[child1].IsLeaf())
+				cost1 -= Perimeter(nodes[child1].bounds);
+
+			float cost2 = Perimeter(Combine(leafBounds, nodes[child2].bounds)) + inheritanceCost;
+			if (!nodes[child2].IsLeaf())
+				cost2 -= Perimeter(nodes[child2].bounds);
+
+			// Descend according to the minimum cost
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? child1 : child2;
+		}
+
+		int sibling = index;
+
+		// Create a new parent
+		int oldParent = nodes[sibling].parent;
+		int newParent = AllocateNode();
+		nodes[newParent].parent = oldParent;
+		nodes[newParent].bounds = Combine(leafBounds, nodes[sibling].bounds);
+		nodes[newParent].height = nodes[sibling].height + 1;
+		nodes[newParent].child1 = sibling;
+		nodes[newParent].child2 = leaf;
+		nodes[sibling].parent = newParent;
+		nodes[leaf].parent = newParent;
+
+		if (oldParent != nullProxy)
+		{
+			if (nodes[oldParent].child1 == sibling)
+				nodes[oldParent].child1 = newParent;
+			else
+				nodes[oldParent].child2 = newParent;
+		}
+		else
+		{
+			root = newParent;
+		}
+
+		// Walk back up the tree fixing heights and bounds
+		index = nodes[leaf].parent;
+		while (index != nullProxy)
+		{
+			index = Balance(index);
+
+			int child1 = nodes[index].child1;
+			int child2 = nodes[index].child2;
+
+			nodes[index].height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+			nodes[index].bounds = Combine(nodes[child1].bounds, nodes[child2].bounds);
+
+			index = nodes[index].parent;
+		}
+	}
+
+	// Detach a leaf from the tree.
+	void AABBTree::RemoveLeaf(int leaf)
+	{
+		if (leaf == root)
+		{
+			root = nullProxy;
+			return;
+		}
+
+		int parent = nodes[leaf].parent;
+		int grandParent = nodes[parent].parent;
+		int sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+		if (grandParent != nullProxy)
+		{
+			// Destroy parent and connect sibling to grandparent
+			if (nodes[grandParent].child1 == parent)
+				nodes[grandParent].child1 = sibling;
+			else
+				nodes[grandParent].child2 = sibling;
+			nodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			// Adjust ancestor bounds
+			int index = grandParent;
+			while (index != nullProxy)
+			{
+				index = Balance(index);
+
+				int child1 = nodes[index].child1;
+				int child2 = nodes[index].child2;
+
+				nodes[index].bounds = Combine(nodes[child1].bounds, nodes[child2].bounds);
+				nodes[index].height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+
+				index = nodes[index].parent;
+			}
+		}
+		else
+		{
+			root = sibling;
+			nodes[sibling].parent = nullProxy;
+			FreeNode(parent);
+		}
+
+		nodes[leaf].parent = nullProxy;
+	}
+
+	// Perform a rotation at the given node if it is unbalanced.
+	// Returns:
+	//   The index of the node that replaced the given node.
+	int AABBTree::Balance(int iA)
+	{
+		Node& A = nodes[iA];
+		if (A.IsLeaf() || A.height < 2)
+			return iA;
+
+		int iB = A.child1;
+		int iC = A.child2;
+		Node& B = nodes[iB];
+		Node& C = nodes[iC];
+
+		int balance = C.height - B.height;
+
+		// Rotate C up
+		if (balance > 1)
+		{
+			int iF = C.child1;
+			int iG = C.child2;
+			Node& F = nodes[iF];
+			Node& G = nodes[iG];
+
+			// Swap A and C
+			C.child1 = iA;
+			C.parent = A.parent;
+			A.parent = iC;
+
+			// A's old parent should point to C
+			if (C.parent != nullProxy)
+			{
+				if (nodes[C.parent].child1 == iA)
+					nodes[C.parent].child1 = iC;
+				else
+					nodes[C.parent].child2 = iC;
+			}
+			else
+			{
+				root = iC;
+			}
+
+			// Rotate
+			if (F.height > G.height)
+			{
+				C.child2 = iF;
+				A.child2 = iG;
+				G.parent = iA;
+				A.bounds = Combine(B.bounds, G.bounds);
+				C.bounds = Combine(A.bounds, F.bounds);
+
+				A.height = 1 + std::max(B.height, G.height);
+				C.height = 1 + std::max(A.height, F.height);
+			}
+			else
+			{
+				C.child2 = iG;
+				A.child2 = iF;
+				F.parent = iA;
+				A.bounds = Combine(B.bounds, F.bounds);
+				C.bounds = Combine(A.bounds, G.bounds);
+
+				A.height = 1 + std::max(B.height, F.height);
+				C.height = 1 + std::max(A.height, G.height);
+			}
+
+			return iC;
+		}
+
+		// Rotate B up
+		if (balance < -1)
+		{
+			int iD = B.child1;
+			int iE = B.child2;
+			Node& D = nodes[iD];
+			Node& E = nodes[iE];
+
+			// Swap A and B
+			B.child1 = iA;
+			B.parent = A.parent;
+			A.parent = iB;
+
+			// A's old parent should point to B
+			if (B.parent != nullProxy)
+			{
+				if (nodes[B.parent].child1 == iA)
+					nodes[B.parent].child1 = iB;
+				else
+					nodes[B.parent].child2 = iB;
+			}
+			else
+			{
+				root = iB;
+			}
+
+			// Rotate
+			if (D.height > E.height)
+			{
+				B.child2 = iD;
+				A.child1 = iE;
+				E.parent = iA;
+				A.bounds = Combine(C.bounds, E.bounds);
+				B.bounds = Combine(A.bounds, D.bounds);
+
+				A.height = 1 + std::max(C.height, E.height);
+				B.height = 1 + std::max(A.height, D.height);
+			}
+			else
+			{
+				B.child2 = iE;
+				A.child1 = iD;
+				D.parent = iA;
+				A.bounds = Combine(C.bounds, D.bounds);
+				B.bounds = Combine(A.bounds, E.bounds);
+
+				A.height = 1 + std::max(C.height, D.height);
+				B.height = 1 + std::max(A.height, E.height);
+			}
+
+			return iB;
+		}
+
+		return iA;
+	}
+
+	// Creates the fattened bounds that are stored for a leaf.
+	BoundingRectangle AABBTree::Fatten(const BoundingRectangle& bounds, const Vector2D& displacement) const
+	{
+		// Margin scales with object size so that it works at any world scale
+		float fat = std::max(margin * std::max(bounds.extents.x, bounds.extents.y), minimumMargin);
+
+		float left = bounds.left - fat;
+		float right = bounds.right + fat;
+		float bottom = bounds.bottom - fat;
+		float top = bounds.top + fat;
+
+		// Extend in the direction of movement
+		Vector2D ahead = displacement * displacementMultiplier;
+		if (ahead.x < 0.0f) left += ahead.x; else right += ahead.x;
+		if (ahead.y < 0.0f) bottom += ahead.y; else top += ahead.y;
+
+		return RectangleFromSides(left, right, bottom, top);
+	}
+
+	// Add a pair to the pair list for the given proxies.
+	void AABBTree::AddPair(int proxyA, int proxyB)
+	{
+		pairs.PushBack(BroadphasePair(proxyA, proxyB));
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Definitions:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Creates a rectangle from its sides.
+		BoundingRectangle RectangleFromSides(float left, float right, float bottom, float top)
+		{
+			return BoundingRectangle(Vector2D((left + right) * 0.5f, (bottom + top) * 0.5f),
+				Vector2D((right - left) * 0.5f, (top - bottom) * 0.5f));
+		}
+
+		// Creates the smallest rectangle containing both rectangles.
+		BoundingRectangle Combine(const BoundingRectangle& first, const BoundingRectangle& second)
+		{
+			return RectangleFromSides(std::min(first.left, second.left), std::max(first.right, second.right),
+				std::min(first.bottom, second.bottom), std::max(first.top, second.top));
+		}
+
+		// Tests whether the first rectangle entirely contains the second.
+		bool Contains(const BoundingRectangle& outer, const BoundingRectangle& inner)
+		{
+			return outer.left <= inner.left && outer.right >= inner.right
+				&& outer.bottom <= inner.bottom && outer.top >= inner.top;
+		}
+
+		// Used as the cost of a node. (Perimeter is the 2D equivalent of surface area.)
+		float Perimeter(const BoundingRectangle& rect)
+		{
+			return 4.0f * (rect.extents.x + rect.extents.y);
+		}
+
+		// Tests whether a segment passes through a rectangle, including when it starts inside.
+		bool SegmentOverlapsRectangle(const LineSegment& segment, const BoundingRectangle& rect)
+		{
+			// Slab test
+			float tMin = 0.0f;
+			float tMax = 1.0f;
+
+			const float start[2] = { segment.start.x, segment.start.y };
+			const float delta[2] = { segment.end.x - segment.start.x, segment.end.y - segment.start.y };
+			const float low[2] = { rect.left, rect.bottom };
+			const float high[2] = { rect.right, rect.top };
+
+			for (int axis = 0; axis < 2; ++axis)
+			{
+				if (delta[axis] == 0.0f)
+				{
+					// Parallel to this slab - must already be inside it
+					if (start[axis] < low[axis] || start[axis] > high[axis])
+						return false;
+					continue;
+				}
+
+				float inverse = 1.0f / delta[axis];
+				float t1 = (low[axis] - start[axis]) * inverse;
+				float t2 = (high[axis] - start[axis]) * inverse;
+				if (t1 > t2)
+					std::swap(t1, t2);
+
+				tMin = std::max(tMin, t1);
+				tMax = std::min(tMax, t2);
+				if (tMin > tMax)
+					return false;
+			}
+
+			return true;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -27,6 +27,19 @@
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Private Structures:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Animation read from a file on a worker thread
+		struct AnimationData : public ResourceData
+		{
+			Animation animation;
+		};
+	}
+
 	AnimationManager Animation::animationManager;
 
 	//------------------------------------------------------------------------------
@@ -62,6 +75,48 @@ namespace Beta
 		return animation;
 	}
 
+	ResourceData* AnimationManager::LoadData(const std::string& name)
+	{
+		AnimationData* data = new AnimationData();
+
+		std::string filename = GetFilePath() + name + GetFileExtension();
+		try
+		{
+			FileStream stream(filename, OM_Read);
+			data->animation.Deserialize(stream);
+		}
+		catch (const FileStreamException & e)
+		{
+			std::cout << "ERROR in AnimationManager: " << e.what() << std::endl;
+			delete data;
+			data = nullptr;
+		}
+
+		return data;
+	}
+
+	bool AnimationManager::CanReload() const
+	{
+		return true;
+	}
+
+	void AnimationManager::FinishLoad(Animation& animation, ResourceData* data)
+	{
+		// Keep the old animation if the file could not be read
+		if (data == nullptr)
+			return;
+
+		const Animation& loaded = static_cast<AnimationData*>(data)->animation;
+		animation.name = loaded.name;
+		animation.frameStart = loaded.frameStart;
+		animation.frameCount = loaded.frameCount;
+		animation.frameDuration = loaded.frameDuration;
+		animation.spriteSourceName = loaded.spriteSourceName;
+
+		// Get sprite source if it exists
+		animation.spriteSource = ResourceGetSpriteSource(animation.spriteSourceName);
+	}
+
 	Animation::Animation(const std::string& name, ConstSpriteSourcePtr spriteSource,
 		unsigned frameCount, unsigned frameStart, float frameDuration)
 		: name(name), spriteSource(spriteSource), frameCount(frameCount), frameStart(frameStart),
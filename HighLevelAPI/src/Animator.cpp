@@ -107,6 +107,8 @@ namespace Beta
 		// Accumulate time
 		if (currentFrameDuration != 0.0f)
 			accumulator += dt * playbackSpeed;
+
+		const Animation* animation = animationList[animationIndex].get();
 		while (accumulator >= currentFrameDuration)
 		{
 			// Advance to next frame
@@ -114,7 +116,6 @@ namespace Beta
 			++currentFrameIndex;
 
 			// Are we at the last frame of animation of animation?
-			ConstAnimationPtr animation = animationList[animationIndex];
 			if (currentFrameIndex == animation->GetFrameCount() - 1)
 			{
 				isDone = true;
@@ -139,6 +140,15 @@ namespace Beta
 		sprite->SetFrame(animation->GetActualFrameIndex(currentFrameIndex));
 	}
 
+	// Advancing frames only changes this object's sprite, so animators
+	// can be updated in parallel during Update.
+	// Params:
+	//   phase = The part of the game loop that is being run.
+	bool Animator::IsThreadSafe(UpdatePhase phase) const
+	{
+		return phase == PhaseUpdate;
+	}
+
 	size_t Animator::AddAnimation(ConstAnimationPtr animation)
 	{
 		animationList.PushBack(animation);
@@ -0,0 +1,332 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	BodyStorage.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "BodyStorage.h"
+
+// Systems
+#include <EngineCore.h>		// GetModule
+#include "JobSystem.h"		// ParallelFor
+
+// Components
+#include "Transform.h"		// ComputeMatrices
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor - Creates empty storage.
+	BodyStorage::BodyStorage()
+		: numTransforms(0), numBodies(0)
+	{
+	}
+
+	// Destructor - Frees all blocks.
+	BodyStorage::~BodyStorage()
+	{
+		for (auto it = blocks.Begin(); it != blocks.End(); ++it)
+			delete *it;
+	}
+
+	// Reserve a slot for a transform.
+	// Params:
+	//   translation = The starting translation.
+	//   rotation = The starting rotation.
+	//   scale = The starting scale.
+	// Returns:
+	//   The index of the slot.
+	unsigned BodyStorage::AddTransform(const Vector2D& translation, float rotation, const Vector2D& scale)
+	{
+		unsigned slot;
+		if (!freeSlots.IsEmpty())
+		{
+			slot = freeSlots.Back();
+			freeSlots.PopBack();
+		}
+		else
+		{
+			// Fill the last block before starting another
+			if (blocks.IsEmpty() || blocks.Back()->end == blockSize)
+				blocks.PushBack(new Block());
+
+			Block& last = *blocks.Back();
+			slot = static_cast<unsigned>(blocks.Size() - 1) * blockSize + last.end;
+			++last.end;
+		}
+
+		Block& block = *blocks[slot / blockSize];
+		unsigned index = slot % blockSize;
+
+		block.translation[index] = translation;
+		block.rotation[index] = rotation;
+		block.scale[index] = scale;
+		block.isDirty[index] = true;
+		block.flags[index] = SlotUsed;
+
+		++numTransforms;
+		return slot;
+	}
+
+	// Free a transform's slot, along with its rigid body if it has one.
+	// Params:
+	//   slot = The slot returned by AddTransform.
+	void BodyStorage::RemoveTransform(unsigned slot)
+	{
+		RemoveBody(slot);
+
+		Block& block = *blocks[slot / blockSize];
+		block.flags[slot % blockSize] = 0;
+
+		freeSlots.PushBack(slot);
+		--numTransforms;
+	}
+
+	// Add rigid body data to a transform's slot.
+	// Params:
+	//   slot = The slot of the transform moved by the rigid body.
+	//   velocity = The starting velocity.
+	//   angularVelocity = The starting angular velocity.
+	//   inverseMass = The inverse of the body's mass.
+	void BodyStorage::AddBody(unsigned slot, const Vector2D& velocity, float angularVelocity, float inverseMass)
+	{
+		Block& block = *blocks[slot / blockSize];
+		unsigned index = slot % blockSize;
+
+		if (block.flags[index] & SlotHasBody)
+			return;
+
+		block.velocity[index] = velocity;
+		block.acceleration[index] = Vector2D();
+		block.forcesSum[index] = Vector2D();
+		block.oldTranslation[index] = block.translation[index];
+		block.oldRotation[index] = block.rotation[index];
+		block.angularVelocity[index] = angularVelocity;
+		block.inverseMass[index] = inverseMass;
+		block.flags[index] |= SlotHasBody;
+
+		++numBodies;
+	}
+
+	// Remove rigid body data from a slot.
+	// Params:
+	//   slot = The slot of the transform moved by the rigid body.
+	void BodyStorage::RemoveBody(unsigned slot)
+	{
+		Block& block = *blocks[slot / blockSize];
+		unsigned index = slot % blockSize;
+
+		if ((block.flags[index] & SlotHasBody) == 0)
+			return;
+
+		block.flags[index] &= ~SlotHasBody;
+		--numBodies;
+	}
+
+	// Set whether a slot's rigid body is moved.
+	// Params:
+	//   slot = The slot returned by AddTransform.
+	//   active = Whether the slot's object is being updated.
+	void BodyStorage::SetActive(unsigned slot, bool active)
+	{
+		Block& block = *blocks[slot / blockSize];
+		unsigned index = slot % blockSize;
+
+		if (active)
+			block.flags[index] &= ~SlotInactive;
+		else
+			block.flags[index] |= SlotInactive;
+	}
+
+	// Calculate every rigid body's acceleration from its forces, then reset the forces.
+	void BodyStorage::ApplyForces()
+	{
+		ForEachBlock([](Block& block)
+		{
+			for (unsigned i = 0; i < block.end; ++i)
+			{
+				if ((block.flags[i] & SlotMoves) != SlotHasBody)
+					continue;
+
+				block.acceleration[i] = block.inverseMass[i] * block.forcesSum[i];
+				block.forcesSum[i] = Vector2D();
+			}
+		});
+	}
+
+	// Update velocities, translations, and rotations of all rigid bodies.
+	// Params:
+	//   dt = Change in time (in seconds) since the last fixed update.
+	void BodyStorage::Integrate(float dt)
+	{
+		ForEachBlock([dt](Block& block) { IntegrateBlock(block, dt); });
+	}
+
+	// Recalculate the matrices of all transforms that have changed.
+	void BodyStorage::UpdateMatrices()
+	{
+		ForEachBlock([](Block& block) { UpdateBlockMatrices(block); });
+	}
+
+	// Returns the number of transforms in the storage.
+	unsigned BodyStorage::GetTransformCount() const
+	{
+		return numTransforms;
+	}
+
+	// Returns the number of rigid bodies in the storage.
+	unsigned BodyStorage::GetBodyCount() const
+	{
+		return numBodies;
+	}
+
+	Vector2D& BodyStorage::GetTranslation(unsigned slot)
+	{
+		return blocks[slot / blockSize]->translation[slot % blockSize];
+	}
+
+	float& BodyStorage::GetRotation(unsigned slot)
+	{
+		return blocks[slot / blockSize]->rotation[slot % blockSize];
+	}
+
+	Vector2D& BodyStorage::GetScale(unsigned slot)
+	{
+		return blocks[slot / blockSize]->scale[slot % blockSize];
+	}
+
+	Matrix2D& BodyStorage::GetMatrix(unsigned slot)
+	{
+		return blocks[slot / blockSize]->matrix[slot % blockSize];
+	}
+
+	Matrix2D& BodyStorage::GetInverseMatrix(unsigned slot)
+	{
+		return blocks[slot / blockSize]->inverseMatrix[slot % blockSize];
+	}
+
+	bool& BodyStorage::GetIsDirty(unsigned slot)
+	{
+		return blocks[slot / blockSize]->isDirty[slot % blockSize];
+	}
+
+	Vector2D& BodyStorage::GetVelocity(unsigned slot)
+	{
+		return blocks[slot / blockSize]->velocity[slot % blockSize];
+	}
+
+	Vector2D& BodyStorage::GetAcceleration(unsigned slot)
+	{
+		return blocks[slot / blockSize]->acceleration[slot % blockSize];
+	}
+
+	Vector2D& BodyStorage::GetForcesSum(unsigned slot)
+	{
+		return blocks[slot / blockSize]->forcesSum[slot % blockSize];
+	}
+
+	Vector2D& BodyStorage::GetOldTranslation(unsigned slot)
+	{
+		return blocks[slot / blockSize]->oldTranslation[slot % blockSize];
+	}
+
+	float& BodyStorage::GetOldRotation(unsigned slot)
+	{
+		return blocks[slot / blockSize]->oldRotation[slot % blockSize];
+	}
+
+	float& BodyStorage::GetAngularVelocity(unsigned slot)
+	{
+		return blocks[slot / blockSize]->angularVelocity[slot % blockSize];
+	}
+
+	float& BodyStorage::GetInverseMass(unsigned slot)
+	{
+		return blocks[slot / blockSize]->inverseMass[slot % blockSize];
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	BodyStorage::Block::Block()
+		: flags(), end(0)
+	{
+	}
+
+	// Run a function on every block, using the job system if there is one.
+	template <typename Function>
+	void BodyStorage::ForEachBlock(const Function& function)
+	{
+		unsigned numBlocks = static_cast<unsigned>(blocks.Size());
+
+		JobSystem* jobSystem = EngineGetModule(JobSystem);
+		if (jobSystem == nullptr || numBlocks < 2)
+		{
+			for (unsigned b = 0; b < numBlocks; ++b)
+				function(*blocks[b]);
+			return;
+		}
+
+		jobSystem->ParallelFor(numBlocks, 1, [this, &function](unsigned begin, unsigned end)
+		{
+			for (unsigned b = begin; b < end; ++b)
+				function(*blocks[b]);
+		});
+	}
+
+	// Integrate the rigid bodies in a single block.
+	void BodyStorage::IntegrateBlock(Block& block, float dt)
+	{
+		for (unsigned i = 0; i < block.end; ++i)
+		{
+			if ((block.flags[i] & SlotMoves) != SlotHasBody)
+				continue;
+
+			// Calculate new velocity from old velocity and acceleration
+			block.velocity[i] += block.acceleration[i] * dt;
+
+			// Save old translation and rotation, then move
+			Vector2D oldTranslation = block.translation[i];
+			float oldRotation = block.rotation[i];
+			block.oldTranslation[i] = oldTranslation;
+			block.oldRotation[i] = oldRotation;
+			block.translation[i] = oldTranslation + block.velocity[i] * dt;
+			block.rotation[i] = oldRotation + block.angularVelocity[i] * dt;
+
+			if (!AlmostEqual(oldTranslation, block.translation[i]) || !AlmostEqual(oldRotation, block.rotation[i]))
+				block.isDirty[i] = true;
+		}
+	}
+
+	// Recalculate the changed matrices in a single block.
+	void BodyStorage::UpdateBlockMatrices(Block& block)
+	{
+		for (unsigned i = 0; i < block.end; ++i)
+		{
+			if ((block.flags[i] & SlotUsed) == 0 || !block.isDirty[i])
+				continue;
+
+			Transform::ComputeMatrices(block.translation[i], block.rotation[i], block.scale[i],
+				block.matrix[i], block.inverseMatrix[i]);
+			block.isDirty[i] = false;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -16,9 +16,14 @@
 #include "stdafx.h"
 #include "Collider.h"
 
+#include <algorithm>	// lower_bound, rotate
+#include <limits>		// numeric_limits
+#include <ObjectPool.h>	// Allocate
+
 // Math
 #include "Vector2D.h" // Vector2DSquareDistance
 #include "Intersection2D.h" // CircleCircleIntersection
+#include "Shapes2D.h" // BoundingRectangle
 
 // Systems
 #include "EngineCore.h" // GetModule
@@ -33,6 +38,110 @@
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Collision events are sent every step, so look up their types once
+		const EventTypeID collisionStartedID = GetEventTypeID("CollisionStarted");
+		const EventTypeID collisionPersistedID = GetEventTypeID("CollisionPersisted");
+		const EventTypeID collisionEndedID = GetEventTypeID("CollisionEnded");
+		const EventTypeID collisionsPersistedID = GetEventTypeID("CollisionsPersisted");
+
+		// How far past the time of impact to move fast objects, so that
+		// their shapes overlap enough to be found by IsCollidingWith
+		const float timeOfImpactSkin = 0.001f;
+
+		// Time of impact for colliders that have not hit anything
+		const float noImpact = std::numeric_limits<float>::max();
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// The collider whose object is being moved through the rest of a step by
+		// StepToImpact, where that part of the step started, and how long it is.
+		// Every other object has finished moving by then, so it is treated as
+		// staying where it is.
+		const Collider* steppingCollider = nullptr;
+		Vector2D stepStart;
+		float stepTimeLeft = 0.0f;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Memory for collision events, large enough for either kind of event.
+		ObjectPool& GetEventPool()
+		{
+			static ObjectPool pool("CollisionEvent",
+				std::max(sizeof(CollisionEvent), sizeof(CollisionListEvent)), 256);
+			return pool;
+		}
+
+		// Get memory for an event from the pool, unless it is too large.
+		void* AllocateEvent(size_t size)
+		{
+			ObjectPool& pool = GetEventPool();
+			if (size > pool.GetObjectSize())
+				return ::operator new(size);
+
+			return pool.Allocate();
+		}
+
+		// Return an event's memory to wherever it came from.
+		void FreeEvent(void* memory, size_t size)
+		{
+			ObjectPool& pool = GetEventPool();
+			if (size > pool.GetObjectSize())
+				::operator delete(memory);
+			else
+				pool.Free(memory);
+		}
+
+		// Return an event's memory when its size is not known.
+		void FreeEvent(void* memory)
+		{
+			ObjectPool& pool = GetEventPool();
+			if (pool.Owns(memory))
+				pool.Free(memory);
+			else
+				::operator delete(memory);
+		}
+
+		// Is the ID in a sorted array?
+		template <size_t InlineCapacity>
+		bool ContainsSorted(const Array<BetaObject::IDType, InlineCapacity>& ids, BetaObject::IDType id)
+		{
+			return std::binary_search(ids.Begin(), ids.End(), id);
+		}
+
+		// Add an ID to a sorted array, unless it is already there.
+		// Returns:
+		//   False if the array already contained the ID.
+		template <size_t InlineCapacity>
+		bool InsertSorted(Array<BetaObject::IDType, InlineCapacity>& ids, BetaObject::IDType id)
+		{
+			auto location = std::lower_bound(ids.Begin(), ids.End(), id);
+			if (location != ids.End() && *location == id)
+				return false;
+
+			// Add to the end, then move into place
+			size_t index = location - ids.Begin();
+			ids.PushBack(id);
+			std::rotate(ids.Begin() + index, ids.End() - 1, ids.End());
+			return true;
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
@@ -43,12 +152,97 @@ namespace Beta
 	{
 	}
 
+	// Constructor for CollisionEvent - Avoids looking up the type name.
+	CollisionEvent::CollisionEvent(GameObject& otherObject, EventTypeID typeID)
+		: Event(typeID), otherObject(otherObject)
+	{
+	}
+
+#pragma push_macro("new")
+#undef new
+
+	// Get memory for a collision event from the pool.
+	void* CollisionEvent::operator new(size_t size)
+	{
+		return AllocateEvent(size);
+	}
+
+	// Called by the debug version of new in stdafx.h.
+	void* CollisionEvent::operator new(size_t size, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+		return AllocateEvent(size);
+	}
+
+	// Return a collision event's memory to the pool.
+	void CollisionEvent::operator delete(void* memory, size_t size)
+	{
+		FreeEvent(memory, size);
+	}
+
+	// Only called if a constructor throws after the debug version of new.
+	void CollisionEvent::operator delete(void* memory, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+		FreeEvent(memory);
+	}
+
+#pragma pop_macro("new")
+
+	// Constructor for CollisionListEvent
+	// Params:
+	//   otherObjects = The objects that are still colliding with the receiver.
+	CollisionListEvent::CollisionListEvent(const Array<GameObject*>& otherObjects)
+		: Event(collisionsPersistedID), otherObjects(otherObjects)
+	{
+	}
+
+#pragma push_macro("new")
+#undef new
+
+	// Get memory for a collision list event from the pool.
+	void* CollisionListEvent::operator new(size_t size)
+	{
+		return AllocateEvent(size);
+	}
+
+	// Called by the debug version of new in stdafx.h.
+	void* CollisionListEvent::operator new(size_t size, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+		return AllocateEvent(size);
+	}
+
+	// Return a collision list event's memory to the pool.
+	void CollisionListEvent::operator delete(void* memory, size_t size)
+	{
+		FreeEvent(memory, size);
+	}
+
+	// Only called if a constructor throws after the debug version of new.
+	void CollisionListEvent::operator delete(void* memory, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+		FreeEvent(memory);
+	}
+
+#pragma pop_macro("new")
+
 	// Allocate a new collider component.
 	// Params:
 	//   type = The type of collider (circle, line, etc.).
 	Collider::Collider(ColliderType cType)
 		: Component("Collider"), transform(nullptr), physics(nullptr), sprite(nullptr), cType(cType),
-		processed(false)
+		processed(false), broadphaseProxy(-1), batchPersisted(false), timeOfImpact(noImpact), impactID(0),
+		eventManager(nullptr)
 	{
 	}
 
@@ -67,11 +261,17 @@ namespace Beta
 		UNREFERENCED_PARAMETER(dt);
 		processed = false;
 
-		// For all previous colliders
-		for (auto it = collidersPrevious.begin(); it != collidersPrevious.end(); ++it)
+		SendPersistedContacts();
+
+		// Both lists are sorted, so they can be compared in a single pass
+		auto current = collidersCurrent.Begin();
+		for (auto it = collidersPrevious.Begin(); it != collidersPrevious.End(); ++it)
 		{
+			while (current != collidersCurrent.End() && *current < *it)
+				++current;
+
 			// If it is also in current, it has not stopped colliding
-			if (collidersCurrent.find(*it) != collidersCurrent.end())
+			if (current != collidersCurrent.End() && *current == *it)
 				continue;
 
 			Collider * other = static_cast<Collider*>(BetaObject::GetObjectByID(*it));
@@ -80,14 +280,14 @@ namespace Beta
 			if (other != nullptr)
 			{
 				eventManager->SendEvent(
-					new CollisionEvent(*other->GetOwner(), "CollisionEnded"), GetOwner());
+					new CollisionEvent(*other->GetOwner(), collisionEndedID), GetOwner());
 				eventManager->SendEvent(
-					new CollisionEvent(*GetOwner(), "CollisionEnded"), other->GetOwner());
+					new CollisionEvent(*GetOwner(), collisionEndedID), other->GetOwner());
 			}
 		}
 
 		// Clear previous colliders
-		collidersPrevious.clear();
+		collidersPrevious.Clear();
 
 		// Store current colliders in previous
 		std::swap(collidersCurrent, collidersPrevious);
@@ -98,40 +298,215 @@ namespace Beta
 	//	 other = Pointer to the second collider component.
 	void Collider::CheckCollision(const Collider& other)
 	{
-		bool colliding = false;
-
 		// Perform the actual collision math for collisions between objects
-		colliding = IsCollidingWith(other);
+		CheckCollision(other, IsCollidingWith(other));
+	}
+
+	// Send collision events using the result of a shape test that has already
+	// been done, such as a batch test from Intersection2D.
+	// Params:
+	//	 other = Reference to the second collider component.
+	//   colliding = Whether the shapes are colliding.
+	void Collider::CheckCollision(const Collider& other, bool colliding)
+	{
+		// Fast objects may have passed through each other during the step. Events
+		// are sent once every pair has been tested, when the objects are moved back
+		// to their earliest impacts (see StepToImpact).
+		if (!colliding && (IsFastMoving() || other.IsFastMoving()))
+		{
+			float t;
+			if (IsSweptCollidingWith(other, t))
+			{
+				RecordImpact(other, t);
+				other.RecordImpact(*this, t);
+			}
+		}
 
 		// If they collide, call respective handlers
 		if (colliding)
 		{
 			// Look for collider in previous colliders
-			auto locPrev = collidersPrevious.find(other.GetID());
-			auto locCurrent = collidersCurrent.find(other.GetID());
+			bool wasColliding = ContainsSorted(collidersPrevious, other.GetID());
 
 			// Add to current
-			collidersCurrent.insert(other.GetID());
+			bool isNew = InsertSorted(collidersCurrent, other.GetID());
 
 			// Collided during last frame
-			if (locPrev != collidersPrevious.end())
+			if (wasColliding)
 			{
-				eventManager->SendEvent(
-					new CollisionEvent(*other.GetOwner(), "CollisionPersisted"), GetOwner());
-				eventManager->SendEvent(
-					new CollisionEvent(*GetOwner(), "CollisionPersisted"), other.GetOwner());
+				if (batchPersisted)
+					persistedContacts.PushBack(other.GetID());
+				else
+					eventManager->SendEvent(
+						new CollisionEvent(*other.GetOwner(), collisionPersistedID), GetOwner());
+
+				if (other.batchPersisted)
+					other.persistedContacts.PushBack(GetID());
+				else
+					eventManager->SendEvent(
+						new CollisionEvent(*GetOwner(), collisionPersistedID), other.GetOwner());
 			}
 			// Collision started
-			else if (locCurrent == collidersCurrent.end())
+			else if (isNew)
 			{
 				eventManager->SendEvent(
-					new CollisionEvent(*other.GetOwner(), "CollisionStarted"), GetOwner());
+					new CollisionEvent(*other.GetOwner(), collisionStartedID), GetOwner());
 				eventManager->SendEvent(
-					new CollisionEvent(*GetOwner(), "CollisionStarted"), other.GetOwner());
+					new CollisionEvent(*GetOwner(), collisionStartedID), other.GetOwner());
 			}
 		}
 	}
 
+	// Did this fast-moving collider's object hit anything along its path that
+	// it has not been moved back to yet? Impacts are found by CheckCollision.
+	bool Collider::HasImpact() const
+	{
+		return timeOfImpact != noImpact;
+	}
+
+	// Get the time of the earliest impact found for this collider.
+	// Returns:
+	//   The time of impact, from 0 (start of the step) to 1 (end of the step).
+	float Collider::GetTimeOfImpact() const
+	{
+		return timeOfImpact;
+	}
+
+	// Move this collider's object back to its earliest impact and send collision
+	// events for it, then move the object through the rest of the step with the
+	// velocity it has after the events. Use FindImpact to look for anything else
+	// in its way. Does nothing if the object has no impact.
+	// Params:
+	//   dt = The length of the fixed update.
+	//   continueStep = False to leave the object at the impact.
+	// Returns:
+	//   True if the object moved through the rest of the step, false if it stopped
+	//   (e.g. it was destroyed or moved by an event handler).
+	bool Collider::StepToImpact(float dt, bool continueStep)
+	{
+		if (!HasImpact())
+			return false;
+
+		float t = timeOfImpact;
+		Collider* other = static_cast<Collider*>(BetaObject::GetObjectByID(impactID));
+		timeOfImpact = noImpact;
+
+		// Go slightly past the time of impact so that the shapes overlap
+		if (other != nullptr)
+		{
+			LineSegment path = GetPathRelativeTo(*other);
+			t = std::min(t + timeOfImpactSkin / path.start.Distance(path.end), 1.0f);
+		}
+
+		// The rest of the step starts at the impact
+		if (steppingCollider != this)
+			stepTimeLeft = dt;
+		stepTimeLeft *= 1.0f - t;
+		Vector2D impact = MoveAlongPath(t);
+		steppingCollider = this;
+		stepStart = impact;
+
+		// The other object may have been destroyed by an earlier impact
+		if (other != nullptr && other->GetOwner()->IsActive() && !other->GetOwner()->IsDestroyed())
+			CheckCollision(*other, true);
+
+		// Handlers may destroy the object or move it somewhere else
+		if (!continueStep || t >= 1.0f || !GetOwner()->IsActive() || GetOwner()->IsDestroyed()
+			|| !AlmostEqual(transform->GetTranslation(), impact))
+			return false;
+
+		transform->SetTranslation(impact + physics->GetVelocity() * stepTimeLeft);
+		return true;
+	}
+
+	// Look for an impact with another collider during the part of the step that
+	// StepToImpact last moved this collider's object through.
+	// Params:
+	//	 other = Reference to the second collider component.
+	void Collider::FindImpact(const Collider& other)
+	{
+		float t;
+		if (&other != this && IsSweptCollidingWith(other, t))
+			RecordImpact(other, t);
+	}
+
+	// Finish moving this collider's object with StepToImpact, forgetting any
+	// impact that was not stepped to.
+	void Collider::EndImpactSteps()
+	{
+		timeOfImpact = noImpact;
+		if (steppingCollider == this)
+			steppingCollider = nullptr;
+	}
+
+	// Find when this collider first touched another during the last fixed update,
+	// using the old and current translations of both objects. Used to catch
+	// fast-moving objects that passed through others. Defaults to no collision.
+	// Params:
+	//	 other = Reference to the second collider component.
+	//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+	// Returns:
+	//   True if the colliders touched during the step, but were not touching at its start.
+	bool Collider::IsSweptCollidingWith(const Collider& other, float& t) const
+	{
+		UNREFERENCED_PARAMETER(other);
+		UNREFERENCED_PARAMETER(t);
+		return false;
+	}
+
+	// Get the world-space bounds of this collider's shape (used by the broadphase).
+	// Returns:
+	//   A rectangle containing the entire collision shape.
+	BoundingRectangle Collider::GetBounds() const
+	{
+		return transform->GetBounds();
+	}
+
+	// Get the world-space bounds of the area this collider moved through during the
+	// last fixed update (used by the broadphase). Same as GetBounds unless fast-moving.
+	BoundingRectangle Collider::GetSweptBounds() const
+	{
+		BoundingRectangle bounds = GetBounds();
+		if (!IsFastMoving())
+			return bounds;
+
+		// Cover the bounds at both the start and the end of the move
+		Vector2D displacement = transform->GetTranslation() - GetOldTranslation();
+		return BoundingRectangle(bounds.center - displacement * 0.5f,
+			bounds.extents + Vector2D(fabsf(displacement.x), fabsf(displacement.y)) * 0.5f);
+	}
+
+	// Does this collider's object have a rigid body that is flagged as fast-moving?
+	bool Collider::IsFastMoving() const
+	{
+		return physics != nullptr && physics->IsFastMoving();
+	}
+
+	// Get the translation of this collider's object before the last fixed update.
+	// Objects without rigid bodies do not move, so their current translation is used.
+	Vector2D Collider::GetOldTranslation() const
+	{
+		// While an object is stepped through the rest of a step, only its own
+		// path from the last impact is used
+		if (steppingCollider != nullptr)
+			return steppingCollider == this ? stepStart : transform->GetTranslation();
+
+		if (physics == nullptr)
+			return transform->GetTranslation();
+
+		return physics->GetOldTranslation();
+	}
+
+	// Get the path of this collider's object during the last fixed update, as seen by
+	// another collider's object that stays at its old translation.
+	// Params:
+	//	 other = Reference to the second collider component.
+	LineSegment Collider::GetPathRelativeTo(const Collider& other) const
+	{
+		Vector2D otherDisplacement = other.transform->GetTranslation() - other.GetOldTranslation();
+		return LineSegment(GetOldTranslation(), transform->GetTranslation() - otherDisplacement);
+	}
+
 	// Get the type of this component.
 	ColliderType Collider::GetColliderType() const
 	{
@@ -150,6 +525,93 @@ namespace Beta
 		processed = value;
 	}
 
+	// Get the ID of this collider's proxy in the broadphase (-1 if it has none).
+	int Collider::GetBroadphaseProxy() const
+	{
+		return broadphaseProxy;
+	}
+
+	// Set the ID of this collider's proxy in the broadphase.
+	void Collider::SetBroadphaseProxy(int proxy)
+	{
+		broadphaseProxy = proxy;
+	}
+
+	// Choose how this object is told about collisions that continue from the
+	// previous step. When batched, a single "CollisionsPersisted" event
+	// (CollisionListEvent) is sent at the start of each fixed step, listing
+	// every object it was still colliding with during the previous step.
+	// Otherwise, a "CollisionPersisted" event is sent for each contact as it
+	// is found. Started and ended events are not affected. Defaults to false.
+	// Params:
+	//   batched = Whether to batch persisted contacts.
+	void Collider::SetPersistedContactsBatched(bool batched)
+	{
+		batchPersisted = batched;
+	}
+
+	// Are persisted contacts sent as a single event?
+	bool Collider::ArePersistedContactsBatched() const
+	{
+		return batchPersisted;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Remember an impact if it is the earliest one found for this fast-moving collider.
+	// Params:
+	//	 other = Reference to the collider that was hit.
+	//   t     = The time of impact, from 0 (start of the step) to 1 (end of the step).
+	void Collider::RecordImpact(const Collider& other, float t) const
+	{
+		if (!IsFastMoving())
+			return;
+
+		// Ties go to the lower ID, so the order in which pairs are tested doesn't matter
+		if (t < timeOfImpact || (t == timeOfImpact && other.GetID() < impactID))
+		{
+			timeOfImpact = t;
+			impactID = other.GetID();
+		}
+	}
+
+	// Move this collider's object back along its path during the last fixed update.
+	// Params:
+	//   t = Where to move the object, from 0 (start of the step) to 1 (end of the step).
+	// Returns:
+	//   The object's new translation.
+	Vector2D Collider::MoveAlongPath(float t)
+	{
+		// The old translation is kept for drawing, so the object is drawn along
+		// the whole step rather than only the part after its last impact
+		Vector2D start = GetOldTranslation();
+		transform->SetTranslation(start + (transform->GetTranslation() - start) * t);
+		return transform->GetTranslation();
+	}
+
+	// Send the contacts that persisted during the last step as a single event.
+	void Collider::SendPersistedContacts()
+	{
+		if (persistedContacts.IsEmpty())
+			return;
+
+		// Skip colliders that were destroyed since they were found
+		for (auto it = persistedContacts.Begin(); it != persistedContacts.End(); ++it)
+		{
+			Collider* other = static_cast<Collider*>(BetaObject::GetObjectByID(*it));
+			if (other != nullptr)
+				persistedObjects.PushBack(other->GetOwner());
+		}
+		persistedContacts.Clear();
+
+		// The event refers to the list, so it is only cleared after the event is sent
+		if (!persistedObjects.IsEmpty())
+			eventManager->SendEvent(new CollisionListEvent(persistedObjects), GetOwner());
+		persistedObjects.Clear();
+	}
+
 	// RTTI
 	COMPONENT_ABSTRACT_DEFINITION(Collider)
 }
@@ -30,6 +30,7 @@
 #include "Transform.h"  // GetTranslation
 #include "RigidBody.h"	// GetOldTranslation
 #include "Sprite.h"		// GetZDepth
+#include "ColliderRectangle.h"	// GetExtents
 
 //------------------------------------------------------------------------------
 namespace Beta
@@ -110,6 +111,44 @@ namespace Beta
 		return Intersection2D::StaticCircleLineIntersection(ray, Circle(transform->GetTranslation(), radius), t);
 	}
 
+	// Find when this circle first touched another collider during the last fixed update.
+	// Params:
+	//	 other = Reference to the second collider component.
+	//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+	bool ColliderCircle::IsSweptCollidingWith(const Collider& other, float& t) const
+	{
+		using namespace Intersection2D;
+
+		switch (other.GetColliderType())
+		{
+		case ColliderTypeCircle:
+		{
+			float radiusOther = static_cast<const ColliderCircle&>(other).radius;
+			return MovingCircleCircleIntersection(GetPathRelativeTo(other), radius,
+				Circle(other.GetOldTranslation(), radiusOther), t);
+			break;
+		}
+		case ColliderTypeRectangle:
+		{
+			const Vector2D& extentsOther = static_cast<const ColliderRectangle&>(other).GetExtents();
+			return MovingCircleRectangleIntersection(GetPathRelativeTo(other), radius,
+				BoundingRectangle(other.GetOldTranslation(), extentsOther), t);
+			break;
+		}
+		default:
+			return other.IsSweptCollidingWith(*this, t);
+			break;
+		}
+	}
+
+	// Get the world-space bounds of this collider's shape (used by the broadphase).
+	// Returns:
+	//   A rectangle containing the entire collision shape.
+	BoundingRectangle ColliderCircle::GetBounds() const
+	{
+		return BoundingRectangle(transform->GetTranslation(), Vector2D(radius, radius));
+	}
+
 	// Save object data to file.
 	// Params:
 	//   stream = The stream object used to save the object's data.
@@ -37,6 +37,85 @@
 
 namespace Beta
 {
+	// Defined with line colliders, its only user, rather than in Intersection2D.cpp,
+	// so that the shape tests do not depend on any components.
+	namespace Intersection2D
+	{
+		// Reflects a point over a line.
+		// Params:
+		//   point = The point being reflected.
+		//   line = The line the point will be reflected over.
+		// Returns:
+		//   The reflected point.
+		Vector2D ReflectPointOverLine(const Vector2D & point, const LineSegment & line, float radius)
+		{
+			// 1. Pretend everything is at the origin by subtracting one of the line's 
+			// points from the point we are reflecting.
+			// translated point p = point - line.start
+			Vector2D translated = point - line.start;
+
+			//////////////////////////////////////////////////////////////////////////////
+			//																			//
+			// Equation for reflected point R is as follows, given point P,				//
+			// and a line with normal n:												//
+			//		R = P - 2 * projection of P onto n									//
+			//																			//
+			// Equation for projected point J (projection of P onto N) is as follows:	//
+			//																			//
+			//		J = (P dot n) / (magnitude(n) squared) * n							//
+			//																			//
+			// However, since our normal is normalized (magnitude = 1), this simplifies //
+			// the projection (and hence the reflection) significantly:					//
+			//																			//
+			//		J = (P dot n) * n													//
+			//																			//
+			//////////////////////////////////////////////////////////////////////////////
+
+			// 2. Calculate the reflected point and store it in a variable.
+			// reflected point = P - 2 * (P dot n) * n
+			Vector2D reflected = translated - (2.0f * (line.normal.DotProduct(translated) - radius)) * line.normal;
+
+			// 3. We need to remember to move things back away from the origin before returning.
+			// Return the reflected point + line.start
+			return reflected + line.start;
+		}
+
+		// Modifies object's position, velocity, and rotation using simple point-line reflection.
+		// Params:
+		//  transform = Transform of the object that is being reflected.
+		//  physics   = Physics of the object being reflected.
+		//  staticLine   = Start and end of first line segment.
+		//  movingCircle = Start and end of second line segment (can be moving point or circle).
+		//  radius		 = Radius of the circle. (Use 0 for points.)
+		//  intersection = Intersection point of the line and circle. 
+		void MovingCircleLineReflection(Transform & transform, RigidBody & physics, const LineSegment & staticLine, const LineSegment & movingCircle, float radius, const Vector2D & intersection)
+		{
+			// 0. Figure out which side of the line the circle is on...
+			bool inside = staticLine.normal.DotProduct((movingCircle.end - staticLine.start).Normalized()) > 0.0f;
+			// If inside, use radius, if outside use -radius
+			float distance = inside ? radius : -radius;
+
+			// 1. Find correct position of object by reflecting its end point over the line.
+			// (Use the ReflectPointOverLine function!)
+			// Once found, set the object's translation to this reflected point.
+			Vector2D reflectedPosition = ReflectPointOverLine(movingCircle.end, staticLine, distance);
+			transform.SetTranslation(reflectedPosition);
+
+			// 2. Use the reflected position and intersection point to find the
+			// direction of the reflected velocity. Make sure to normalize this vector!
+			Vector2D reflectedDirection = (reflectedPosition - intersection).Normalized();
+
+			// 3. Set the velocity of the object to this direction times
+			// the magnitude of the current velocity.
+			physics.SetVelocity(reflectedDirection * physics.GetVelocity().Magnitude());
+
+			// 4. Find the object's new rotation by using atan2 with the reflected direction.
+			// Once found, set the rotation of the object to this angle.
+			float reflectedAngle = atan2f(reflectedDirection.y, reflectedDirection.x);
+			transform.SetRotation(reflectedAngle);
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
@@ -204,6 +283,76 @@ namespace Beta
 		return result;
 	}
 
+	// Find when a circle or rectangle first touched these lines during the last fixed update.
+	// (NOTE: IsCollidingWith already tests circles along their paths, but this is
+	// also used for the rest of a step after a fast circle's impact.)
+	// Params:
+	//	 other = Reference to the second collider component.
+	//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+	bool ColliderLine::IsSweptCollidingWith(const Collider& other, float& t) const
+	{
+		ColliderType typeOther = other.GetColliderType();
+		if (typeOther != ColliderTypeCircle && typeOther != ColliderTypeRectangle)
+			return false;
+
+		LineSegment path = other.GetPathRelativeTo(*this);
+		size_t numLines = lineSegments.Size();
+		float minT = std::numeric_limits<float>::max();
+		bool result = false;
+
+		// Use the first line segment the shape hits
+		for (size_t i = 0; i < numLines; ++i)
+		{
+			LineSegment transformedSegment = GetLineWithTransform(static_cast<unsigned>(i));
+
+			bool hit;
+			if (typeOther == ColliderTypeCircle)
+			{
+				Vector2D intersection;
+				hit = Intersection2D::MovingCircleLineIntersection(transformedSegment, path,
+					static_cast<const ColliderCircle&>(other).GetRadius(), intersection, t);
+			}
+			else
+			{
+				hit = Intersection2D::MovingRectangleLineIntersection(path,
+					static_cast<const ColliderRectangle&>(other).GetExtents(), transformedSegment, t);
+			}
+
+			if (hit)
+			{
+				minT = std::min(t, minT);
+				result = true;
+			}
+		}
+		t = minT;
+		return result;
+	}
+
+	// Get the world-space bounds of this collider's shape (used by the broadphase).
+	// Returns:
+	//   A rectangle containing the entire collision shape.
+	BoundingRectangle ColliderLine::GetBounds() const
+	{
+		size_t numLines = lineSegments.Size();
+		if (numLines == 0)
+			return BoundingRectangle(transform->GetTranslation(), Vector2D());
+
+		LineSegment segment = GetLineWithTransform(0);
+		Vector2D minimum(std::min(segment.start.x, segment.end.x), std::min(segment.start.y, segment.end.y));
+		Vector2D maximum(std::max(segment.start.x, segment.end.x), std::max(segment.start.y, segment.end.y));
+
+		for (size_t i = 1; i < numLines; ++i)
+		{
+			segment = GetLineWithTransform(static_cast<unsigned>(i));
+			minimum.x = std::min(minimum.x, std::min(segment.start.x, segment.end.x));
+			minimum.y = std::min(minimum.y, std::min(segment.start.y, segment.end.y));
+			maximum.x = std::max(maximum.x, std::max(segment.start.x, segment.end.x));
+			maximum.y = std::max(maximum.y, std::max(segment.start.y, segment.end.y));
+		}
+
+		return BoundingRectangle((minimum + maximum) * 0.5f, (maximum - minimum) * 0.5f);
+	}
+
 	// Save object data to file.
 	// Params:
 	//   stream = The stream object used to save the object's data.
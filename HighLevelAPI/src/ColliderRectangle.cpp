@@ -116,6 +116,36 @@ namespace Beta
 		return Intersection2D::RectangleLineIntersection(BoundingRectangle(transform->GetTranslation(), extents), ray, t);
 	}
 
+	// Find when this rectangle first touched another collider during the last fixed update.
+	// Params:
+	//	 other = Reference to the second collider component.
+	//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+	bool ColliderRectangle::IsSweptCollidingWith(const Collider& other, float& t) const
+	{
+		switch (other.GetColliderType())
+		{
+		case ColliderTypeRectangle:
+		{
+			const Vector2D& extentsOther = static_cast<const ColliderRectangle&>(other).extents;
+			return Intersection2D::MovingRectangleRectangleIntersection(GetPathRelativeTo(other), extents,
+				BoundingRectangle(other.GetOldTranslation(), extentsOther), t);
+			break;
+		}
+		default:
+			// Circles, lines, and tilemaps test rectangles themselves
+			return other.IsSweptCollidingWith(*this, t);
+			break;
+		}
+	}
+
+	// Get the world-space bounds of this collider's shape (used by the broadphase).
+	// Returns:
+	//   A rectangle containing the entire collision shape.
+	BoundingRectangle ColliderRectangle::GetBounds() const
+	{
+		return BoundingRectangle(transform->GetTranslation(), extents);
+	}
+
 	// Save object data to file.
 	// Params:
 	//   stream = The stream object used to save the object's data.
@@ -29,6 +29,10 @@
 // Systems
 #include <FileStream.h> // Read/Write Variable
 #include <Space.h>	// GetResourceManager
+#include "JobSystem.h"	// ParallelFor
+
+// STD
+#include <limits>	// infinity
 
 // Resources
 #include "Tilemap.h"
@@ -54,6 +58,36 @@ namespace Beta
 	// Amount to nudge objects if they are stuck
 	const float nudgeTolerance = 0.1f;
 
+	// Number of rays given to a thread at a time by CastRays
+	const unsigned rayGrainSize = 64;
+
+	namespace
+	{
+		// Shrinks the range [tEnter, tExit] of a ray to the part that is within [0, size) on one axis.
+		// Params:
+		//   origin = The start of the ray on this axis.
+		//   delta = The change from the start to the end of the ray on this axis.
+		//   size = The number of cells on this axis.
+		//   tEnter = (In/Out) Where the ray enters the map.
+		//   tExit = (In/Out) Where the ray leaves the map.
+		// Returns:
+		//   False if no part of the range is within the map.
+		bool ClipToRange(float origin, float delta, float size, float& tEnter, float& tExit)
+		{
+			if (delta == 0.0f)
+				return origin >= 0.0f && origin < size;
+
+			float t0 = -origin / delta;
+			float t1 = (size - origin) / delta;
+			if (t0 > t1)
+				std::swap(t0, t1);
+
+			tEnter = std::max(tEnter, t0);
+			tExit = std::min(tExit, t1);
+			return tEnter <= tExit;
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
@@ -64,6 +98,12 @@ namespace Beta
 	{
 	}
 
+	// Result of a ray cast against the cells of a tilemap.
+	TilemapRayHit::TilemapRayHit()
+		: hit(false), t(0.0f), column(0), row(0)
+	{
+	}
+
 	// Constructor for circle collider.
 	ColliderTilemap::ColliderTilemap()
 		: Collider(ColliderTypeTilemap), map(nullptr), eventManager(nullptr)
@@ -92,21 +132,7 @@ namespace Beta
 		// Create bounding rectangle for object
 		Transform* transformOther = static_cast<const ColliderTilemap&>(other).transform;
 		BoundingRectangle rectangle = BoundingRectangle(transformOther->GetTranslation(),
-			transformOther->GetScale() / 2.0f);
-
-		switch (other.GetColliderType())
-		{
-		case ColliderTypeRectangle:
-		{
-			// Create rectangle using custom extents if the object is an actual rectangle
-			const ColliderRectangle& colliderRectangle = static_cast<const ColliderRectangle&>(other);
-			rectangle = BoundingRectangle(transformOther->GetTranslation(),
-				colliderRectangle.GetExtents());
-			break;
-		}
-		default:
-			break;
-		}
+			GetObjectExtents(other));
 
 		// Check for collisions
 		MapCollision collisions = MapCollision(
@@ -133,15 +159,136 @@ namespace Beta
 		return false;
 	}
 
-	// Perform intersection test with ray.
+	// Perform intersection test with ray. Walks the cells crossed by the ray
+	// in order, stopping at the first tile.
 	// Params:
 	//   ray = The ray with which to test intersection.
 	//   t   = The t value for the intersection.
 	bool ColliderTilemap::IsIntersectingWith(const LineSegment& ray, float& t) const
 	{
-		UNREFERENCED_PARAMETER(ray);
-		UNREFERENCED_PARAMETER(t);
-		return false;
+		TilemapRayHit result = CastRay(ray);
+		if (!result.hit)
+			return false;
+
+		t = result.t;
+		return true;
+	}
+
+	// Find the first tile hit by a ray.
+	// Params:
+	//   ray = The ray, in world coordinates.
+	// Returns:
+	//   Where the ray hit the map, if it did.
+	TilemapRayHit ColliderTilemap::CastRay(const LineSegment& ray) const
+	{
+		// Points along the ray keep their t values in tile space
+		const Matrix2D& inverseMatrix = transform->GetInverseMatrix();
+		return CastRayTileSpace(inverseMatrix * ray.start, inverseMatrix * ray.end);
+	}
+
+	// Cast many rays at once, e.g. for line of sight or lighting queries.
+	// Uses all threads if there is a job system.
+	// Params:
+	//   rays = The rays, in world coordinates.
+	//   results = (Out) The result for each ray, in the same order.
+	void ColliderTilemap::CastRays(const Array<LineSegment>& rays, Array<TilemapRayHit>& results) const
+	{
+		unsigned numRays = static_cast<unsigned>(rays.Size());
+		results.Resize(numRays);
+		if (numRays == 0)
+			return;
+
+		// Get the matrix before any threads start, since it may need to be recalculated
+		const Matrix2D& inverseMatrix = transform->GetInverseMatrix();
+		auto castRange = [this, &rays, &results, &inverseMatrix](unsigned begin, unsigned end)
+		{
+			for (unsigned i = begin; i < end; ++i)
+				results[i] = CastRayTileSpace(inverseMatrix * rays[i].start, inverseMatrix * rays[i].end);
+		};
+
+		JobSystem* jobSystem = EngineGetModule(JobSystem);
+		if (jobSystem == nullptr || numRays <= rayGrainSize)
+			castRange(0, numRays);
+		else
+			jobSystem->ParallelFor(numRays, rayGrainSize, castRange);
+	}
+
+	// Find when a circle or rectangle first touched a tile during the last fixed update,
+	// by casting rays from the points on its leading sides that IsCollidingWith tests.
+	// Params:
+	//	 other = Reference to the second collider component.
+	//   t     = (Out) The time of impact, from 0 (start of the step) to 1 (end of the step).
+	bool ColliderTilemap::IsSweptCollidingWith(const Collider& other, float& t) const
+	{
+		if (map == nullptr || (other.GetColliderType() != ColliderTypeCircle
+			&& other.GetColliderType() != ColliderTypeRectangle))
+			return false;
+
+		LineSegment path = other.GetPathRelativeTo(*this);
+		Vector2D displacement = path.end - path.start;
+		BoundingRectangle rectangle(path.start, GetObjectExtents(other));
+
+		float minT = std::numeric_limits<float>::max();
+		bool result = false;
+
+		for (unsigned side = 0; side < SideCount; ++side)
+		{
+			// Only sides facing the direction of movement can hit a tile first
+			if ((side == SideBottom && displacement.y >= 0.0f) || (side == SideTop && displacement.y <= 0.0f)
+				|| (side == SideLeft && displacement.x >= 0.0f) || (side == SideRight && displacement.x <= 0.0f))
+				continue;
+
+			Vector2D hotspots[2];
+			GetHotspots(rectangle, static_cast<RectangleSide>(side), hotspots);
+
+			for (unsigned i = 0; i < 2; ++i)
+			{
+				// Points that start inside a tile are already handled by IsCollidingWith
+				TilemapRayHit hit = CastRay(LineSegment(hotspots[i], hotspots[i] + displacement));
+				if (hit.hit && hit.t > 0.0f)
+				{
+					minT = std::min(minT, hit.t);
+					result = true;
+				}
+			}
+		}
+
+		t = minT;
+		return result;
+	}
+
+	// Get the world-space bounds of this collider's shape (used by the broadphase).
+	// Returns:
+	//   A rectangle containing the entire collision shape.
+	BoundingRectangle ColliderTilemap::GetBounds() const
+	{
+		if (map == nullptr)
+			return Collider::GetBounds();
+
+		// Corners of the map in tile space (cells are centered on their indices, rows go down)
+		const float left = map->GetMinIndexX() - 0.5f;
+		const float right = map->GetMaxIndexX() - 0.5f;
+		const float top = -(map->GetMinIndexY() - 0.5f);
+		const float bottom = -(map->GetMaxIndexY() - 0.5f);
+
+		const Matrix2D& matrix = transform->GetMatrix();
+		Vector2D corners[4] =
+		{
+			matrix * Vector2D(left, top), matrix * Vector2D(right, top),
+			matrix * Vector2D(left, bottom), matrix * Vector2D(right, bottom),
+		};
+
+		Vector2D minimum = corners[0];
+		Vector2D maximum = corners[0];
+		for (unsigned i = 1; i < 4; ++i)
+		{
+			minimum.x = std::min(minimum.x, corners[i].x);
+			minimum.y = std::min(minimum.y, corners[i].y);
+			maximum.x = std::max(maximum.x, corners[i].x);
+			maximum.y = std::max(maximum.y, corners[i].y);
+		}
+
+		return BoundingRectangle((minimum + maximum) * 0.5f, (maximum - minimum) * 0.5f);
 	}
 
 	// Sets the tilemap to use for this collider.
@@ -184,6 +331,26 @@ namespace Beta
 	// Returns:
 	//   True if there is a collision, false otherwise.
 	bool ColliderTilemap::IsSideColliding(const BoundingRectangle& rectangle, RectangleSide side) const
+	{
+		const unsigned numHotspots = 2;
+		Vector2D hotspots[numHotspots];
+		GetHotspots(rectangle, side, hotspots);
+
+		for (unsigned i = 0; i < numHotspots; ++i)
+		{
+			if (IsCollidingAtPosition(hotspots[i].x, hotspots[i].y))
+				return true;
+		}
+
+		return false;
+	}
+
+	// Gets the points on a side of a rectangle that are tested for collision.
+	// Params:
+	//   rectangle = The bounding rectangle for an object.
+	//   side = The side of the rectangle.
+	//   hotspots = (Out) The points on that side.
+	void ColliderTilemap::GetHotspots(const BoundingRectangle& rectangle, RectangleSide side, Vector2D hotspots[2])
 	{
 		// Create hot spots based on rectangle
 		float x1 = rectangle.center.x - rectangle.extents.x * (2.0f / 3.0f);
@@ -191,9 +358,6 @@ namespace Beta
 		float y1 = rectangle.center.y - rectangle.extents.y * (2.0f / 3.0f);
 		float y2 = rectangle.center.y + rectangle.extents.y * (2.0f / 3.0f);
 
-		const unsigned numHotspots = 2;
-		Vector2D hotspots[numHotspots];
-
 		switch (side)
 		{
 		case SideBottom:
@@ -215,14 +379,20 @@ namespace Beta
 		default:
 			break;
 		}
+	}
 
-		for (unsigned i = 0; i < numHotspots; ++i)
-		{
-			if (IsCollidingAtPosition(hotspots[i].x, hotspots[i].y))
-				return true;
-		}
+	// Gets the extents of the rectangle used to test an object against the tilemap.
+	// Params:
+	//   other = The object's collider.
+	// Returns:
+	//   The rectangle's extents.
+	Vector2D ColliderTilemap::GetObjectExtents(const Collider& other)
+	{
+		// Use custom extents if the object is an actual rectangle
+		if (other.GetColliderType() == ColliderTypeRectangle)
+			return static_cast<const ColliderRectangle&>(other).GetExtents();
 
-		return false;
+		return static_cast<const ColliderTilemap&>(other).transform->GetScale() / 2.0f;
 	}
 
 	// Determines whether a point is within a collidable cell in the tilemap.
@@ -245,6 +415,81 @@ namespace Beta
 		return map->GetCellValue(column, row) > 0;
 	}
 
+	// Walks the cells crossed by a ray (Amanatides-Woo), stopping at the first tile.
+	// Params:
+	//   start = The start of the ray, in tile space.
+	//   end = The end of the ray, in tile space.
+	// Returns:
+	//   Where the ray hit the map, if it did.
+	TilemapRayHit ColliderTilemap::CastRayTileSpace(const Vector2D& start, const Vector2D& end) const
+	{
+		TilemapRayHit result;
+		if (map == nullptr || map->GetCellData() == nullptr)
+			return result;
+
+		const int* cells = map->GetCellData();
+		const int width = static_cast<int>(map->GetWidth());
+		const int height = static_cast<int>(map->GetHeight());
+		const int minX = map->GetMinIndexX();
+		const int minY = map->GetMinIndexY();
+
+		// Move to grid space, where cell (x, y) of the data covers [x, x + 1) x [y, y + 1).
+		// Cells are centered on their indices in tile space, and rows go down.
+		Vector2D origin(start.x + 0.5f - minX, -start.y + 0.5f - minY);
+		Vector2D delta(end.x - start.x, start.y - end.y);
+
+		// Only walk the part of the ray that is inside the map
+		float tEnter = 0.0f;
+		float tExit = 1.0f;
+		if (!ClipToRange(origin.x, delta.x, static_cast<float>(width), tEnter, tExit)
+			|| !ClipToRange(origin.y, delta.y, static_cast<float>(height), tEnter, tExit))
+			return result;
+
+		Vector2D entry = origin + delta * tEnter;
+		int x = std::min(std::max(static_cast<int>(std::floor(entry.x)), 0), width - 1);
+		int y = std::min(std::max(static_cast<int>(std::floor(entry.y)), 0), height - 1);
+
+		// Distance along the ray to the next cell boundary on each axis,
+		// and between boundaries on each axis
+		const float infinity = std::numeric_limits<float>::infinity();
+		int stepX = delta.x > 0.0f ? 1 : -1;
+		int stepY = delta.y > 0.0f ? 1 : -1;
+		float tDeltaX = delta.x != 0.0f ? std::fabs(1.0f / delta.x) : infinity;
+		float tDeltaY = delta.y != 0.0f ? std::fabs(1.0f / delta.y) : infinity;
+		float tMaxX = delta.x != 0.0f ? (x + (stepX > 0 ? 1 : 0) - origin.x) / delta.x : infinity;
+		float tMaxY = delta.y != 0.0f ? (y + (stepY > 0 ? 1 : 0) - origin.y) / delta.y : infinity;
+
+		float t = tEnter;
+		for (;;)
+		{
+			if (cells[y * width + x] > 0)
+			{
+				result.hit = true;
+				result.t = t;
+				result.column = x + minX;
+				result.row = y + minY;
+				return result;
+			}
+
+			// Step into whichever neighboring cell the ray reaches first
+			if (tMaxX < tMaxY)
+			{
+				t = tMaxX;
+				x += stepX;
+				tMaxX += tDeltaX;
+			}
+			else
+			{
+				t = tMaxY;
+				y += stepY;
+				tMaxY += tDeltaY;
+			}
+
+			if (t > tExit || x < 0 || x >= width || y < 0 || y >= height)
+				return result;
+		}
+	}
+
 	// Moves an object and sets its velocity based on where it collided with the tilemap.
 	// Params:
 	//   objectRectangle = A bounding rectangle that encompasses the object.
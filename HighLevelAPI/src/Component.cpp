@@ -24,6 +24,55 @@
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Number of component type IDs handed out. Zero-initialized before any
+		// static constructors run, so registration order does not matter.
+		size_t componentTypeCount = 0;
+
+		// Component sizes are rounded up to a multiple of this
+		const size_t poolGranularity = 16;
+		// Larger components are rare enough to use the system heap
+		const size_t maxPooledSize = 1024;
+		const unsigned numPools = maxPooledSize / poolGranularity;
+		// Aim for slabs of about this many bytes
+		const size_t slabBytes = 16 * 1024;
+
+		// One pool per size class
+		struct ComponentPools
+		{
+			ComponentPools()
+			{
+				for (unsigned i = 0; i < numPools; ++i)
+				{
+					size_t size = (i + 1) * poolGranularity;
+					unsigned perSlab = static_cast<unsigned>(slabBytes / size);
+					pools[i] = new ObjectPool("Component (" + std::to_string(size) + " bytes)",
+						size, perSlab < 16 ? 16 : perSlab);
+				}
+			}
+
+			~ComponentPools()
+			{
+				for (unsigned i = 0; i < numPools; ++i)
+					delete pools[i];
+			}
+
+			ObjectPool* pools[numPools];
+		};
+
+		// Created on first use, since components may be allocated by static constructors
+		ComponentPools& GetComponentPools()
+		{
+			static ComponentPools componentPools;
+			return componentPools;
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
@@ -45,4 +94,95 @@ namespace Beta
 	{
 		return GetOwner()->GetSpace();
 	}
+
+	// Assigns the next type ID to a component class. IDs start at zero and
+	// are dense, so objects can use them to index their components directly.
+	size_t Component::RegisterType()
+	{
+		return componentTypeCount++;
+	}
+
+	// Returns the number of component classes that have been assigned type IDs.
+	size_t Component::GetTypeCount()
+	{
+		return componentTypeCount;
+	}
+
+	// Whether this component can be updated at the same time as other objects
+	// during the given phase.
+	// Params:
+	//   phase = The part of the game loop that is being run.
+	bool Component::IsThreadSafe(UpdatePhase phase) const
+	{
+		UNREFERENCED_PARAMETER(phase);
+		return false;
+	}
+
+#pragma push_macro("new")
+#undef new
+
+	// Allocate memory for a component from the pool for its size.
+	void* Component::operator new(size_t size)
+	{
+		ObjectPool* pool = GetPool(size);
+		if (pool == nullptr)
+			return ::operator new(size);
+
+		return pool->Allocate();
+	}
+
+	// Called by the debug version of new in stdafx.h.
+	void* Component::operator new(size_t size, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+		return operator new(size);
+	}
+
+	// Return a component's memory to the pool for its size.
+	void Component::operator delete(void* memory, size_t size)
+	{
+		ObjectPool* pool = GetPool(size);
+		if (pool == nullptr)
+			::operator delete(memory);
+		else
+			pool->Free(memory);
+	}
+
+	// Only called if a constructor throws after the debug version of new,
+	// in which case the size is not known, so the pools are searched.
+	void Component::operator delete(void* memory, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+
+		ComponentPools& componentPools = GetComponentPools();
+		for (unsigned i = 0; i < numPools; ++i)
+		{
+			if (componentPools.pools[i]->Owns(memory))
+			{
+				componentPools.pools[i]->Free(memory);
+				return;
+			}
+		}
+
+		::operator delete(memory);
+	}
+
+#pragma pop_macro("new")
+
+	// Get the pool used for components of the given size.
+	// Params:
+	//   size = The size of the component class, in bytes.
+	// Returns:
+	//   The pool, or nullptr if components that large use the system heap.
+	ObjectPool* Component::GetPool(size_t size)
+	{
+		if (size == 0 || size > maxPooledSize)
+			return nullptr;
+
+		return GetComponentPools().pools[(size - 1) / poolGranularity];
+	}
 }
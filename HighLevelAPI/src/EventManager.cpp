@@ -20,15 +20,73 @@
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Slot value for listeners that have not been registered
+		const unsigned noSlot = static_cast<unsigned>(-1);
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Declarations:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Names of all event types, indexed by ID.
+		Array<const std::string*>& GetEventTypeNames();
+
+		// IDs of all event types, indexed by name.
+		std::unordered_map<std::string, EventTypeID>& GetEventTypeIDs();
+	}
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
 
+	// Get the ID for an event type name, assigning a new ID if needed.
+	// Params:
+	//   type = The name of the event type, e.g. "CollisionStarted".
+	EventTypeID GetEventTypeID(const std::string& type)
+	{
+		std::unordered_map<std::string, EventTypeID>& ids = GetEventTypeIDs();
+
+		auto location = ids.find(type);
+		if (location != ids.end())
+			return location->second;
+
+		// Map keys never move, so names can be referenced directly
+		Array<const std::string*>& names = GetEventTypeNames();
+		EventTypeID id = static_cast<EventTypeID>(names.Size());
+		location = ids.emplace(type, id).first;
+		names.PushBack(&location->first);
+		return id;
+	}
+
+	// Get the name of an event type from its ID.
+	// Params:
+	//   typeID = An ID returned by GetEventTypeID.
+	const std::string& GetEventTypeName(EventTypeID typeID)
+	{
+		return *GetEventTypeNames()[typeID];
+	}
+
 	// Constructor for Event
 	// Params:
 	//   type = The type of event that for which we are listening.
 	Event::Event(const std::string& type)
-		: type(type)
+		: typeID(GetEventTypeID(type)), type(GetEventTypeName(typeID))
+	{
+	}
+
+	// Constructor for Event - Avoids looking up the type name.
+	// Params:
+	//   typeID = The ID of the event type, from GetEventTypeID.
+	Event::Event(EventTypeID typeID)
+		: typeID(typeID), type(GetEventTypeName(typeID))
 	{
 	}
 
@@ -41,13 +99,20 @@ namespace Beta
 	//   source = The source of the event, typically a game object component.
 	//   type   = The type of event that for which we are listening.
 	ListenerBase::ListenerBase(const BetaObject* source, const std::string& type)
-		: source(source), type(type)
+		: source(source), typeID(GetEventTypeID(type)), type(GetEventTypeName(typeID)),
+		slot(noSlot), bucketIndex(0)
+	{
+	}
+
+	// Creates a handle that does not refer to any listener.
+	ListenerHandle::ListenerHandle()
+		: index(noSlot), generation(0)
 	{
 	}
 
 	// EventManager Constructor
 	EventManager::EventManager()
-		: BetaObject("Module:EventManager")
+		: BetaObject("Module:EventManager"), dispatchDepth(0)
 	{
 	}
 
@@ -94,13 +159,23 @@ namespace Beta
 		delayedEvents.Clear();
 
 		// Destroy all listeners
-		size_t numListeners = listeners.Size();
-		for (unsigned i = 0; i < numListeners; ++i)
+		size_t numSlots = slots.Size();
+		for (unsigned i = 0; i < numSlots; ++i)
+		{
+			delete slots[i].listener;
+			slots[i].listener = nullptr;
+		}
+		slots.Clear();
+		freeSlots.Clear();
+
+		// Destroy dispatch table
+		size_t numTypes = dispatchTable.Size();
+		for (unsigned i = 0; i < numTypes; ++i)
 		{
-			delete listeners[i];
-			listeners[i] = nullptr;
+			delete dispatchTable[i];
+			dispatchTable[i] = nullptr;
 		}
-		listeners.Clear();
+		dispatchTable.Clear();
 	}
 
 	// Sends an event to all registered listeners.
@@ -118,24 +193,179 @@ namespace Beta
 		// Else, send immediately
 		else
 		{
-			size_t numListeners = listeners.Size();
-			for (size_t i = 0; i < numListeners; ++i)
-			{
-				ListenerBase* listener = listeners[i];
-
-				// If source and type match
-				if (listener->source == source && listener->type == event->type)
-				{
-					// Call handler on destination object with event as argument
-					listener->CallHandler(event);
-				}
-			}
+			Dispatch(event, source);
 
 			// Dispose of event
 			delete event;
 		}
 	}
 
+	// Removes a registered event handler from the list of listeners in the event manager.
+	// Params:
+	//   handle = The handle returned when the handler was registered.
+	void EventManager::UnregisterEventHandler(ListenerHandle handle)
+	{
+		// Ignore handles for listeners that were already removed
+		if (handle.index >= slots.Size() || slots[handle.index].generation != handle.generation
+			|| slots[handle.index].listener == nullptr)
+			return;
+
+		RemoveListener(*slots[handle.index].listener);
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Add a listener to the dispatch table. The event manager takes ownership of the listener.
+	ListenerHandle EventManager::AddListener(ListenerBase* listener)
+	{
+		// Find a slot for the handle
+		unsigned slot;
+		if (!freeSlots.IsEmpty())
+		{
+			slot = freeSlots.Back();
+			freeSlots.PopBack();
+		}
+		else
+		{
+			slot = static_cast<unsigned>(slots.Size());
+			ListenerSlot newSlot = { nullptr, 0 };
+			slots.PushBack(newSlot);
+		}
+		slots[slot].listener = listener;
+
+		// Add to table
+		while (listener->typeID >= dispatchTable.Size())
+			dispatchTable.PushBack(nullptr);
+		if (dispatchTable[listener->typeID] == nullptr)
+			dispatchTable[listener->typeID] = new SourceTable();
+
+		Array<ListenerBase*>& bucket = (*dispatchTable[listener->typeID])[listener->source].listeners;
+		listener->slot = slot;
+		listener->bucketIndex = static_cast<unsigned>(bucket.Size());
+		bucket.PushBack(listener);
+
+		ListenerHandle handle;
+		handle.index = slot;
+		handle.generation = slots[slot].generation;
+		return handle;
+	}
+
+	// Remove a listener if it is the instance that was registered.
+	// Returns:
+	//   True if the listener was removed, false if it is not registered.
+	bool EventManager::RemoveListener(const ListenerBase& listener)
+	{
+		if (listener.slot >= slots.Size() || slots[listener.slot].listener != &listener)
+			return false;
+
+		// Free the handle
+		ListenerBase* registered = slots[listener.slot].listener;
+		slots[listener.slot].listener = nullptr;
+		++slots[listener.slot].generation;
+		freeSlots.PushBack(listener.slot);
+
+		// Leave a hole so that dispatches in progress are not disturbed
+		SourceTable& table = *dispatchTable[registered->typeID];
+		ListenerBucket& bucket = table.find(registered->source)->second;
+		bucket.listeners[registered->bucketIndex] = nullptr;
+		++bucket.removed;
+
+		// Compact once at least half of the bucket is holes
+		if (dispatchDepth == 0 && bucket.removed * 2 >= bucket.listeners.Size())
+			CompactBucket(table, registered->source);
+
+		delete registered;
+		return true;
+	}
+
+	// Get the listeners for the given source and type, or null if there are none.
+	const Array<ListenerBase*>* EventManager::FindListeners(EventTypeID typeID, const BetaObject* source) const
+	{
+		if (typeID >= dispatchTable.Size() || dispatchTable[typeID] == nullptr)
+			return nullptr;
+
+		auto bucket = dispatchTable[typeID]->find(source);
+		if (bucket == dispatchTable[typeID]->end())
+			return nullptr;
+
+		return &bucket->second.listeners;
+	}
+
+	// Send an event to its listeners right away.
+	void EventManager::Dispatch(const Event* event, const BetaObject* source)
+	{
+		if (event->typeID >= dispatchTable.Size() || dispatchTable[event->typeID] == nullptr)
+			return;
+
+		SourceTable& table = *dispatchTable[event->typeID];
+		auto found = table.find(source);
+		if (found == table.end())
+			return;
+
+		// Handlers may add listeners and rehash the table, so keep a reference
+		// to the bucket (which doesn't move) rather than the iterator.
+		// Buckets are only erased when no dispatch is in progress.
+		ListenerBucket& bucket = found->second;
+
+		// Listeners added by handlers are not called for this event
+		Array<ListenerBase*>& listeners = bucket.listeners;
+		size_t numListeners = listeners.Size();
+
+		++dispatchDepth;
+		for (size_t i = 0; i < numListeners; ++i)
+		{
+			// Skip listeners removed by earlier handlers
+			ListenerBase* listener = listeners[i];
+			if (listener == nullptr)
+				continue;
+
+			// Call handler on destination object with event as argument
+			listener->CallHandler(event);
+		}
+		--dispatchDepth;
+
+		// Clean up after handlers that unregistered listeners
+		if (dispatchDepth == 0 && bucket.removed * 2 >= listeners.Size()
+			&& bucket.removed != 0)
+			CompactBucket(table, source);
+	}
+
+	// Remove null entries from a source's bucket, deleting it if it is empty.
+	// The bucket is looked up again, since handlers that register listeners
+	// can rehash the table and invalidate iterators held across them.
+	void EventManager::CompactBucket(SourceTable& table, const BetaObject* source)
+	{
+		auto bucket = table.find(source);
+		if (bucket == table.end())
+			return;
+
+		Array<ListenerBase*>& listeners = bucket->second.listeners;
+
+		// Shift remaining listeners forward, keeping their order
+		unsigned count = 0;
+		size_t numListeners = listeners.Size();
+		for (size_t i = 0; i < numListeners; ++i)
+		{
+			if (listeners[i] == nullptr)
+				continue;
+
+			listeners[i]->bucketIndex = count;
+			listeners[count++] = listeners[i];
+		}
+
+		if (count == 0)
+		{
+			table.erase(bucket);
+		}
+		else
+		{
+			listeners.Resize(count);
+			bucket->second.removed = 0;
+		}
+	}
+
 	// Constructor for DelayedEvent.
 	// Params:
 	//	 event  = A pointer to the event being sent.
@@ -145,4 +375,30 @@ namespace Beta
 		: event(event), source(source), delay(delay)
 	{
 	}
+
+	EventManager::ListenerBucket::ListenerBucket()
+		: removed(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Definitions:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Names of all event types, indexed by ID.
+		Array<const std::string*>& GetEventTypeNames()
+		{
+			static Array<const std::string*> names;
+			return names;
+		}
+
+		// IDs of all event types, indexed by name.
+		std::unordered_map<std::string, EventTypeID>& GetEventTypeIDs()
+		{
+			static std::unordered_map<std::string, EventTypeID> ids;
+			return ids;
+		}
+	}
 }
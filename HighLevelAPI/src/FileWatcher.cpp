@@ -0,0 +1,282 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	FileWatcher.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "FileWatcher.h"
+
+// Use inotify to find out about changes where it exists,
+// and poll modification times everywhere else
+#ifdef __linux__
+#define BE_FILEWATCHER_INOTIFY 1
+#else
+#define BE_FILEWATCHER_INOTIFY 0
+#endif
+
+#if BE_FILEWATCHER_INOTIFY
+#include <sys/inotify.h>
+#include <unistd.h>		// read, close
+#endif
+
+#include <unordered_set>	// Reloaded files
+
+// Systems
+#include <EngineCore.h>		// GetFilePath
+#include <ShaderProgram.h>	// ReloadFile, shaderPath
+#include "ResourceManager.h"	// ReloadFile
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor
+	// Params:
+	//   pollInterval = The time between checks of the assets folder, in seconds,
+	//     when changes can't be reported by the operating system.
+	FileWatcher::FileWatcher(float pollInterval)
+		: BetaObject("Module:FileWatcher"), inotifyFd(-1), pollInterval(pollInterval), pollTimer(0.0f),
+		reloadCount(0)
+	{
+	}
+
+	// Destructor - Stops watching the assets folder.
+	FileWatcher::~FileWatcher()
+	{
+		Shutdown();
+	}
+
+	// Start watching the assets folder.
+	void FileWatcher::Initialize()
+	{
+		root = std::filesystem::path(EngineCore::GetInstance().GetFilePath()).generic_string();
+		if (root.empty())
+			root = "./";
+		else if (root.back() != '/')
+			root += '/';
+
+#if BE_FILEWATCHER_INOTIFY
+		inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (inotifyFd >= 0)
+		{
+			WatchFolder("");
+			return;
+		}
+
+		std::cout << "ERROR in FileWatcher: Could not start inotify. Checking files every "
+			<< pollInterval << " seconds instead." << std::endl;
+#endif
+
+		ScanFiles(nullptr);
+	}
+
+	// Reload the resources loaded from files that have changed since the last update.
+	// Params:
+	//   dt = The change in time since the previous frame.
+	void FileWatcher::Update(float dt)
+	{
+		Array<std::string> changed;
+
+		if (inotifyFd >= 0)
+		{
+			ReadEvents(changed);
+		}
+		else
+		{
+			pollTimer += dt;
+			if (pollTimer < pollInterval)
+				return;
+
+			pollTimer = 0.0f;
+			ScanFiles(&changed);
+		}
+
+		// Editors often write a file more than once while saving it
+		std::unordered_set<std::string> reloaded;
+		for (unsigned i = 0; i < changed.Size(); ++i)
+		{
+			if (reloaded.insert(changed[i]).second)
+				ReloadFile(changed[i]);
+		}
+	}
+
+	// Stop watching the assets folder.
+	void FileWatcher::Shutdown()
+	{
+#if BE_FILEWATCHER_INOTIFY
+		if (inotifyFd >= 0)
+			close(inotifyFd);
+#endif
+
+		inotifyFd = -1;
+		watchedFolders.clear();
+		modificationTimes.clear();
+	}
+
+	// Reload the resources and shaders loaded from a file, as if it had changed.
+	// Params:
+	//   path = The path of the file, relative to the assets folder.
+	//     Ex: Textures/Monkey.png
+	// Returns:
+	//   True if anything was reloaded, false if nothing uses the file.
+	bool FileWatcher::ReloadFile(const std::string& path)
+	{
+		bool reloaded;
+
+		// Shaders aren't resources, so programs are rebuilt directly
+		const std::string& shaderPath = ShaderProgram::shaderPath;
+		if (path.size() > shaderPath.size() && path.compare(0, shaderPath.size(), shaderPath) == 0)
+			reloaded = ShaderProgram::ReloadFile(path.substr(shaderPath.size()));
+		else
+			reloaded = ResourceManagerBase::ReloadFile(path);
+
+		if (reloaded)
+		{
+			std::cout << "FileWatcher: Reloading " << path << std::endl;
+			++reloadCount;
+		}
+
+		return reloaded;
+	}
+
+	// Returns the number of changed files that have been reloaded.
+	unsigned FileWatcher::GetReloadCount() const
+	{
+		return reloadCount;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Ask inotify to report changes in a folder and all of its subfolders.
+	// Params:
+	//   folder = The path of the folder, relative to the assets folder.
+	void FileWatcher::WatchFolder(const std::string& folder)
+	{
+#if BE_FILEWATCHER_INOTIFY
+		// Saving with a new file and renaming it over the old one is reported as a move
+		std::string path = root + folder;
+		int watch = inotify_add_watch(inotifyFd, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+		if (watch < 0)
+		{
+			std::cout << "ERROR in FileWatcher: Could not watch folder " << path << "." << std::endl;
+			return;
+		}
+
+		watchedFolders[watch] = folder;
+
+		// Each subfolder needs its own watch
+		std::error_code error;
+		for (std::filesystem::directory_iterator it(path, error), end; !error && it != end; it.increment(error))
+		{
+			if (it->is_directory(error))
+				WatchFolder(folder + it->path().filename().generic_string() + "/");
+		}
+#else
+		UNREFERENCED_PARAMETER(folder);
+#endif
+	}
+
+	// Get the files that inotify has reported as changed.
+	// Params:
+	//   changed = The array that the paths of the files will be added to.
+	void FileWatcher::ReadEvents(Array<std::string>& changed)
+	{
+#if BE_FILEWATCHER_INOTIFY
+		alignas(inotify_event) char buffer[4096];
+
+		// Read until there are no events left
+		ssize_t length;
+		while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0)
+		{
+			for (char* position = buffer; position < buffer + length; )
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(position);
+				position += sizeof(inotify_event) + event->len;
+
+				if (event->mask & IN_Q_OVERFLOW)
+				{
+					std::cout << "ERROR in FileWatcher: Too many files changed at once. "
+						<< "Some of them were not reloaded." << std::endl;
+					continue;
+				}
+
+				auto folder = watchedFolders.find(event->wd);
+				if (folder == watchedFolders.end())
+					continue;
+
+				// Folder was deleted
+				if (event->mask & IN_IGNORED)
+				{
+					watchedFolders.erase(folder);
+					continue;
+				}
+
+				if (event->len == 0)
+					continue;
+
+				std::string path = folder->second + event->name;
+				if (event->mask & IN_ISDIR)
+				{
+					if (event->mask & (IN_CREATE | IN_MOVED_TO))
+						WatchFolder(path + "/");
+				}
+				else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+				{
+					changed.PushBack(path);
+				}
+			}
+		}
+#else
+		UNREFERENCED_PARAMETER(changed);
+#endif
+	}
+
+	// Compare the modification time of every file with the last time seen.
+	// Params:
+	//   changed = The array that the paths of new and modified files
+	//     will be added to, or nullptr to only record the times.
+	void FileWatcher::ScanFiles(Array<std::string>* changed)
+	{
+		// Files may be removed while they are being checked, so errors are skipped
+		std::error_code error;
+		std::filesystem::recursive_directory_iterator it(root,
+			std::filesystem::directory_options::skip_permission_denied, error);
+		for (std::filesystem::recursive_directory_iterator end; !error && it != end; it.increment(error))
+		{
+			std::error_code fileError;
+			if (!it->is_regular_file(fileError))
+				continue;
+
+			std::filesystem::file_time_type time = it->last_write_time(fileError);
+			if (fileError)
+				continue;
+
+			std::string path = it->path().generic_string().substr(root.size());
+			auto found = modificationTimes.find(path);
+			if (found != modificationTimes.end() && found->second == time)
+				continue;
+
+			modificationTimes[path] = time;
+			if (changed != nullptr)
+				changed->PushBack(path);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include "Space.h"				// static_cast to Space*
 #include "GameObjectFactory.h"	// CreateComponent
 #include "FileStream.h"			// WriteValue, ReadSkip, BeginScope, EndScope
+#include "Transform.h"			// UpdateStorageActive
 
 //------------------------------------------------------------------------------
 
@@ -35,6 +36,10 @@ namespace Beta
 	ArchetypeManager::ArchetypeManager()
 		: ResourceManager("Objects/")
 	{
+		// Archetypes are freed when the program exits, so the pools
+		// they use must be created first in order to be destroyed last
+		GameObject::GetPool();
+		Component::GetPool(sizeof(Component));
 	}
 
 	Archetype ArchetypeManager::Create(const std::string& name)
@@ -43,6 +48,31 @@ namespace Beta
 		return Archetype(EngineGetModule(GameObjectFactory)->CreateObject(name));
 	}
 
+	// Load an archetype's file again and replace its components, so that objects
+	// created from it afterward use the new data. Objects that were already
+	// created are unchanged. Archetypes are read on the main thread, since
+	// their components may load other resources while being read.
+	// Params:
+	//   name = The name of the archetype.
+	// Returns:
+	//   True if the archetype is in use and was reloaded, false otherwise.
+	bool ArchetypeManager::Reload(const std::string& name)
+	{
+		Archetype archetype = GetResource(name, false);
+		if (archetype == nullptr)
+			return false;
+
+		// Keep the old archetype if the file could not be read
+		GameObject* loaded = EngineGetModule(GameObjectFactory)->CreateObject(name);
+		if (loaded == nullptr)
+			return false;
+
+		// Archetypes are only const to the objects that use them
+		const_cast<GameObject&>(*archetype).TakeComponents(*loaded);
+		delete loaded;
+		return true;
+	}
+
 	//Create a new game object.
 	// Params:
 	//	 name = The name of the game object being created.   
@@ -83,6 +113,7 @@ namespace Beta
 			delete components[i];
 		}
 		components.Clear();
+		componentsByType.Clear();
 	}
 
 	// Initialize this object's components and set it to active.
@@ -118,6 +149,38 @@ namespace Beta
 			components[i]->FixedUpdate(dt);
 	}
 
+	// Update only the components that are, or are not, thread-safe for Update.
+	// Params:
+	//	 dt = Change in time (in seconds) since the last game loop.
+	//   threadSafe = Whether to update the thread-safe components or all others.
+	void GameObject::Update(float dt, bool threadSafe)
+	{
+		if (isDestroyed || !active) return;
+
+		size_t numComponents = components.Size();
+		for (size_t i = 0; i < numComponents; ++i)
+		{
+			if (components[i]->IsThreadSafe(PhaseUpdate) == threadSafe)
+				components[i]->Update(dt);
+		}
+	}
+
+	// Update only the components that are, or are not, thread-safe for FixedUpdate.
+	// Params:
+	//	 dt = A fixed change in time, usually 1/60th of a second.
+	//   threadSafe = Whether to update the thread-safe components or all others.
+	void GameObject::FixedUpdate(float dt, bool threadSafe)
+	{
+		if (isDestroyed || !active) return;
+
+		size_t numComponents = components.Size();
+		for (size_t i = 0; i < numComponents; ++i)
+		{
+			if (components[i]->IsThreadSafe(PhaseFixedUpdate) == threadSafe)
+				components[i]->FixedUpdate(dt);
+		}
+	}
+
 	// Draw any visible components attached to the game object.
 	void GameObject::Draw()
 	{
@@ -131,6 +194,21 @@ namespace Beta
 	{
 		component->SetOwner(this);
 		components.PushBack(component);
+
+		// Index the component under its own type and each of its base types
+		size_t typeCount = Component::GetTypeCount();
+		for (size_t type = 0; type < typeCount; ++type)
+		{
+			if (!component->IsOfType(type))
+				continue;
+
+			while (componentsByType.Size() <= type)
+				componentsByType.PushBack(nullptr);
+
+			// Keep the first component of each type
+			if (componentsByType[type] == nullptr)
+				componentsByType[type] = component;
+		}
 	}
 
 	// Whether the object has been marked for destruction.
@@ -145,6 +223,11 @@ namespace Beta
 	void GameObject::Destroy()
 	{
 		isDestroyed = true;
+
+		// Stored rigid bodies are moved without checking their owners
+		Transform* transform = GetComponent<Transform>();
+		if (transform != nullptr)
+			transform->UpdateStorageActive();
 	}
 
 	// Tells whether an object will be updated.
@@ -157,6 +240,11 @@ namespace Beta
 	void GameObject::SetActive(bool value)
 	{
 		active = value;
+
+		// Stored rigid bodies are moved without checking their owners
+		Transform* transform = GetComponent<Transform>();
+		if (transform != nullptr)
+			transform->UpdateStorageActive();
 	}
 
 	// Get the space that contains this object.
@@ -218,4 +306,84 @@ namespace Beta
 	{
 		return archetypeManager;
 	}
+
+#pragma push_macro("new")
+#undef new
+
+	// Allocate memory for a game object from the pool.
+	void* GameObject::operator new(size_t size)
+	{
+		// Classes derived from GameObject don't fit in the pool
+		if (size != sizeof(GameObject))
+			return ::operator new(size);
+
+		return GetPool().Allocate();
+	}
+
+	// Called by the debug version of new in stdafx.h.
+	void* GameObject::operator new(size_t size, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+		return operator new(size);
+	}
+
+	// Return a game object's memory to the pool.
+	void GameObject::operator delete(void* memory, size_t size)
+	{
+		if (size != sizeof(GameObject))
+			::operator delete(memory);
+		else
+			GetPool().Free(memory);
+	}
+
+	// Only called if the constructor throws after the debug version of new.
+	void GameObject::operator delete(void* memory, int blockType, const char* file, int line)
+	{
+		UNREFERENCED_PARAMETER(blockType);
+		UNREFERENCED_PARAMETER(file);
+		UNREFERENCED_PARAMETER(line);
+
+		if (GetPool().Owns(memory))
+			GetPool().Free(memory);
+		else
+			::operator delete(memory);
+	}
+
+#pragma pop_macro("new")
+
+	// Get the pool that game objects are allocated from.
+	ObjectPool& GameObject::GetPool()
+	{
+		// Created on first use, since archetypes are created by a static constructor
+		static ObjectPool pool("GameObject", sizeof(GameObject), 256);
+		return pool;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Replace this object's components with those of another object,
+	// leaving the other object empty. Used to reload archetypes.
+	// Params:
+	//   other = The object whose components will be moved to this one.
+	void GameObject::TakeComponents(GameObject& other)
+	{
+		size_t numComponents = components.Size();
+		for (size_t i = 0; i < numComponents; ++i)
+		{
+			components[i]->UnregisterEventHandlers();
+			delete components[i];
+		}
+		components.Clear();
+		componentsByType.Clear();
+
+		size_t numComponentsOther = other.components.Size();
+		for (size_t i = 0; i < numComponentsOther; ++i)
+			AddComponent(other.components[i]);
+		other.components.Clear();
+		other.componentsByType.Clear();
+	}
 }
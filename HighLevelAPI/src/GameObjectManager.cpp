@@ -18,17 +18,25 @@
 
 // STD
 #include <limits>
+#include <algorithm>	// min, sort
 
 // Systems
 #include <EngineCore.h>			// GetModule
 #include <GraphicsEngine.h>		// GetWinMinX
 #include "Quadtree.h"			// Constructor, AddObject, Clear
+#include "AABBTree.h"			// AddObject, UpdateObject, GetPairs
 #include "Space.h"				// GameObject->SetOwner
 #include "GameObjectFactory.h"	// CreateObject
+#include "JobSystem.h"			// ParallelFor
+#include "BodyStorage.h"		// ApplyForces, Integrate, UpdateMatrices
+#include <Profiler.h>			// PROFILE_SCOPE
 
 // Components
 #include "Collider.h"		// CheckCollision
+#include "ColliderCircle.h"		// GetRadius
+#include "ColliderRectangle.h"	// GetExtents
 #include "Transform.h"		// IsOnScreen
+#include "RigidBody.h"		// GetOldTranslation
 #include "ColliderLine.h"	// for raycasts
 #include "SpriteTilemap.h"
 
@@ -42,6 +50,64 @@ namespace Beta
 
 	void SwapGameObjects(GameObject** first, GameObject** second);
 
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Number of objects given to a thread at a time during parallel updates
+		const unsigned parallelUpdateGrainSize = 64;
+
+		// Number of pairs found by the AABB tree before their shapes are tested in batches
+		const unsigned batchPairThreshold = 64;
+
+		// Slot of pairs that are not tested in batches
+		const unsigned notBatched = static_cast<unsigned>(-1);
+
+		// Most impacts a fast object is stepped through during one fixed update
+		// before it is left at the last one
+		const unsigned maxImpactSteps = 4;
+
+		// Get the shape tested by a circle collider.
+		Circle GetCircle(const Collider& collider)
+		{
+			return Circle(collider.GetOwner()->GetComponent<Transform>()->GetTranslation(),
+				static_cast<const ColliderCircle&>(collider).GetRadius());
+		}
+
+		// Get the shape tested by a rectangle collider.
+		BoundingRectangle GetRectangle(const Collider& collider)
+		{
+			return BoundingRectangle(collider.GetOwner()->GetComponent<Transform>()->GetTranslation(),
+				static_cast<const ColliderRectangle&>(collider).GetExtents());
+		}
+
+		// Is a circle the same as the one stored in a slot of a batch?
+		bool IsSameCircle(const Intersection2D::CircleBatch& batch, unsigned slot, const Circle& circle)
+		{
+			return batch.x[slot] == circle.center.x && batch.y[slot] == circle.center.y
+				&& batch.radius[slot] == circle.radius;
+		}
+
+		// Is a rectangle the same as the one stored in a slot of a batch?
+		bool IsSameRectangle(const Intersection2D::RectangleBatch& batch, unsigned slot, const BoundingRectangle& rectangle)
+		{
+			return batch.left[slot] == rectangle.left && batch.bottom[slot] == rectangle.bottom
+				&& batch.right[slot] == rectangle.right && batch.top[slot] == rectangle.top;
+		}
+
+		// Mark the tests that passed in an array of results.
+		void StoreResults(const Array<unsigned>& hits, unsigned count, Array<bool>& results)
+		{
+			results.Resize(count);
+			for (unsigned i = 0; i < count; ++i)
+				results[i] = false;
+			for (auto it = hits.Begin(); it != hits.End(); ++it)
+				results[*it] = true;
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
@@ -49,7 +115,9 @@ namespace Beta
 	// Constructor
 	GameObjectManager::GameObjectManager(Space* space)
 		: BetaObject("Module:GameObjectManager", space),
-		timeAccumulator(0.0f), fixedUpdateDt(1.0f / 120.0f), quadtree(nullptr), quadtreeEnabled(false)
+		timeAccumulator(0.0f), parallelUpdateEnabled(false), inParallelUpdate(false),
+		fixedUpdateDt(1.0f / 120.0f), interpolationEnabled(true), broadphaseType(BroadphaseNone),
+		quadtree(nullptr), aabbTree(new AABBTree()), bodyStorage(nullptr)
 	{
 		objects.Reserve(128);
 	}
@@ -58,6 +126,8 @@ namespace Beta
 	GameObjectManager::~GameObjectManager()
 	{
 		delete quadtree;
+		delete aabbTree;
+		delete bodyStorage;
 	}
 
 	// Update all objects in the active game objects list.
@@ -70,8 +140,11 @@ namespace Beta
 	{
 		Space* space = static_cast<Space*>(GetOwner());
 
-		// Remake the quadtree - so that raycasting doesn't go weird places
-		PopulateQuadtree();
+		// Refresh the broadphase - so that raycasting doesn't go weird places
+		if (broadphaseType == BroadphaseAABBTree)
+			UpdateAABBTree();
+		else
+			PopulateQuadtree();
 
 		// Update objects if not paused
 		if (space == nullptr || !space->IsPaused())
@@ -90,14 +163,19 @@ namespace Beta
 	// Draw all game objects in the active game object list.
 	void GameObjectManager::Draw(void)
 	{
+		// Recalculate all changed matrices at once before sprites ask for them
+		if (bodyStorage != nullptr)
+			bodyStorage->UpdateMatrices();
+
 		size_t numObjects = objects.Size();
 		for (size_t i = 0; i < numObjects; ++i)
 		{
 			objects[i]->Draw();
 		}
 
-		// Draw quadtree
-		if (quadtreeEnabled && quadtree) quadtree->Draw();
+		// Draw broadphase
+		if (broadphaseType == BroadphaseQuadtree && quadtree) quadtree->Draw();
+		if (broadphaseType == BroadphaseAABBTree) aabbTree->Draw();
 	}
 
 	// Shutdown the game object manager, destroying all active objects.
@@ -113,6 +191,7 @@ namespace Beta
 		// Delete the quadtree to prevent strange raycast behavior
 		delete quadtree;
 		quadtree = nullptr;
+		aabbTree->Clear();
 	}
 
 	// Add a game object to the active game object list.
@@ -123,6 +202,14 @@ namespace Beta
 	//	 gameObject = Reference to the game object to be added to the list.
 	void GameObjectManager::AddObject(GameObject& gameObject)
 	{
+		// Objects can't be initialized or added to the list while other threads are using it
+		if (inParallelUpdate)
+		{
+			std::lock_guard<std::mutex> lock(deferredMutex);
+			deferredObjects.PushBack(&gameObject);
+			return;
+		}
+
 		// Okay to add one object
 		gameObject.SetOwner(GetOwner());
 		gameObject.Initialize();
@@ -185,13 +272,143 @@ namespace Beta
 	// Test whether the quadtree is currently enabled for this object manager.
 	bool GameObjectManager::IsQuadtreeEnabled() const
 	{
-		return quadtreeEnabled;
+		return broadphaseType == BroadphaseQuadtree;
 	}
 
 	// Enable or disable use of the quadtree data structure for collision detection.
 	void GameObjectManager::SetQuadtreeEnabled(bool enabled)
 	{
-		quadtreeEnabled = enabled;
+		SetBroadphaseType(enabled ? BroadphaseQuadtree : BroadphaseNone);
+	}
+
+	// Get the spatial data structure currently used for collision detection and raycasts.
+	BroadphaseType GameObjectManager::GetBroadphaseType() const
+	{
+		return broadphaseType;
+	}
+
+	// Set the spatial data structure used for collision detection and raycasts.
+	// Params:
+	//   type = The type of broadphase to use.
+	void GameObjectManager::SetBroadphaseType(BroadphaseType type)
+	{
+		if (type == broadphaseType)
+			return;
+
+		// Tree is only kept up to date while it is in use
+		if (broadphaseType == BroadphaseAABBTree)
+		{
+			aabbTree->Clear();
+			for (auto it = objects.Begin(); it != objects.End(); ++it)
+			{
+				Collider* collider = (*it)->GetComponent<Collider>();
+				if (collider != nullptr)
+					collider->SetBroadphaseProxy(AABBTree::nullProxy);
+			}
+		}
+
+		broadphaseType = type;
+	}
+
+	// Get the dynamic tree used when the broadphase type is BroadphaseAABBTree.
+	const AABBTree& GameObjectManager::GetAABBTree() const
+	{
+		return *aabbTree;
+	}
+
+	// Enable or disable storing transform and rigid body data in arrays,
+	// so that physics and matrices are updated in batches.
+	// Can only be changed while the manager has no objects.
+	// Params:
+	//   enabled = Whether body storage should be used.
+	void GameObjectManager::SetBodyStorageEnabled(bool enabled)
+	{
+		if (enabled == (bodyStorage != nullptr))
+			return;
+
+		// Existing components would still point at the old data
+		if (!objects.IsEmpty())
+		{
+			std::cout << "ERROR: Body storage cannot be changed while objects exist." << std::endl;
+			return;
+		}
+
+		delete bodyStorage;
+		bodyStorage = enabled ? new BodyStorage() : nullptr;
+	}
+
+	// Get the storage used for transforms and rigid bodies in this space.
+	// Returns:
+	//   A pointer to the storage, or nullptr if it is not enabled.
+	BodyStorage* GameObjectManager::GetBodyStorage() const
+	{
+		return bodyStorage;
+	}
+
+	// Enable or disable updating thread-safe components (see Component::IsThreadSafe)
+	// in parallel using the JobSystem module. These components are then updated
+	// after all other components, rather than in their objects' order, so this
+	// is off by default. Has no effect if there is no JobSystem module.
+	// Params:
+	//   enabled = Whether thread-safe components should be updated in parallel.
+	void GameObjectManager::SetParallelUpdateEnabled(bool enabled)
+	{
+		parallelUpdateEnabled = enabled;
+	}
+
+	// Returns whether thread-safe components are updated in parallel.
+	bool GameObjectManager::IsParallelUpdateEnabled() const
+	{
+		return parallelUpdateEnabled;
+	}
+
+	// Set the time between fixed updates. Large levels can run physics
+	// at a lower rate (e.g. 30-60 Hz) to save time.
+	// Params:
+	//   dt = The fixed timestep, in seconds. Must be greater than zero.
+	void GameObjectManager::SetFixedTimeStep(float dt)
+	{
+		if (dt <= 0.0f)
+		{
+			std::cout << "ERROR: Fixed timestep must be greater than zero." << std::endl;
+			return;
+		}
+
+		fixedUpdateDt = dt;
+	}
+
+	// Returns the time between fixed updates, in seconds.
+	float GameObjectManager::GetFixedTimeStep() const
+	{
+		return fixedUpdateDt;
+	}
+
+	// Enable or disable drawing objects with rigid bodies between their
+	// last two fixed update states, so that motion stays smooth when
+	// physics runs at a different rate than the screen. Enabled by default.
+	// Params:
+	//   enabled = Whether draws should use interpolated transforms.
+	void GameObjectManager::SetInterpolationEnabled(bool enabled)
+	{
+		interpolationEnabled = enabled;
+	}
+
+	// Returns whether draws use interpolated transforms.
+	bool GameObjectManager::IsInterpolationEnabled() const
+	{
+		return interpolationEnabled;
+	}
+
+	// Get how far the current frame is between the last fixed update and the next.
+	// Returns:
+	//   The unused fraction of a fixed step, from 0 (last fixed update)
+	//   to 1 (current state). Always 1 if interpolation is disabled.
+	float GameObjectManager::GetInterpolationAlpha() const
+	{
+		if (!interpolationEnabled)
+			return 1.0f;
+
+		return std::min(timeAccumulator / fixedUpdateDt, 1.0f);
 	}
 
 	// Perform a raycast and return all objects that intersect with the ray.
@@ -204,16 +421,21 @@ namespace Beta
 	void GameObjectManager::CastRay(const Vector2D& start, const Vector2D& direction,
 		float distance, Array<CastResult>& results, const std::string& filter)
 	{
-		if (!quadtreeEnabled)
+		if (broadphaseType == BroadphaseNone)
 		{
-			std::cout << "Call to CastRay ignored: please enable quadtree to allow raycasts. "
+			std::cout << "Call to CastRay ignored: please enable quadtree or AABB tree to allow raycasts. "
 				<< "Raycasting without a spatial data structure is not recommended." << std::endl;
 			return;
 		}
 
-		if (quadtree != nullptr)
+		LineSegment ray(start, start + direction.Normalized() * distance);
+
+		if (broadphaseType == BroadphaseAABBTree)
+		{
+			aabbTree->CastRay(ray, results, filter);
+		}
+		else if (quadtree != nullptr)
 		{
-			LineSegment ray(start, start + direction.Normalized() * distance);
 			quadtree->CastRay(ray, results, filter);
 		}
 	}
@@ -257,12 +479,25 @@ namespace Beta
 	// Update object logic using variable timestep.
 	void GameObjectManager::VariableUpdate(float dt)
 	{
+		JobSystem* jobSystem = parallelUpdateEnabled ? EngineGetModule(JobSystem) : nullptr;
+
 		// Update active objects
 		size_t numObjects = objects.Size();
 		for (unsigned i = 0; i < numObjects; ++i)
 		{
-			objects[i]->Update(dt);
+			if (jobSystem == nullptr)
+				objects[i]->Update(dt);
+			else
+				objects[i]->Update(dt, false);
 		}
+
+		// Update thread-safe components
+		if (jobSystem != nullptr)
+			ParallelUpdate(*jobSystem, PhaseUpdate, dt);
+
+		// Update stored rigid bodies
+		if (bodyStorage != nullptr)
+			bodyStorage->ApplyForces();
 	}
 
 	// Update object physics using fixed timestep.
@@ -270,24 +505,51 @@ namespace Beta
 	{
 		timeAccumulator += dt;
 
+		JobSystem* jobSystem = parallelUpdateEnabled ? EngineGetModule(JobSystem) : nullptr;
+
 		while (timeAccumulator >= fixedUpdateDt)
 		{
-			// Update active objects (physics) with fixed dt
-			for (auto it = objects.Begin(); it != objects.End(); ++it)
 			{
-				(*it)->FixedUpdate(fixedUpdateDt);
+				PROFILE_SCOPE("Physics");
+
+				// Update active objects (physics) with fixed dt
+				for (auto it = objects.Begin(); it != objects.End(); ++it)
+				{
+					if (jobSystem == nullptr)
+						(*it)->FixedUpdate(fixedUpdateDt);
+					else
+						(*it)->FixedUpdate(fixedUpdateDt, false);
+				}
+
+				// Update thread-safe components, such as rigid bodies
+				if (jobSystem != nullptr)
+					ParallelUpdate(*jobSystem, PhaseFixedUpdate, fixedUpdateDt);
+
+				// Move stored rigid bodies
+				if (bodyStorage != nullptr)
+					bodyStorage->Integrate(fixedUpdateDt);
 			}
 
-			if (!quadtreeEnabled)
 			{
-				// Check for collisions between objects
-				CheckCollisions();
-			}
-			else
-			{
-				// Instantiate quadtree
-				RemakeQuadtree();
-				CheckCollisionsQuadtree();
+				PROFILE_SCOPE("Collisions");
+				switch (broadphaseType)
+				{
+				case BroadphaseQuadtree:
+					// Instantiate quadtree
+					RemakeQuadtree();
+					CheckCollisionsQuadtree();
+					break;
+				case BroadphaseAABBTree:
+					CheckCollisionsAABBTree();
+					break;
+				default:
+					// Check for collisions between objects
+					CheckCollisions();
+					break;
+				}
+
+				// Fast objects may have hit something along the way
+				StepFastObjects();
 			}
 
 			// Decrease accumulator
@@ -295,6 +557,32 @@ namespace Beta
 		}
 	}
 
+	// Update thread-safe components on all threads, then add any objects
+	// that were created during the update.
+	void GameObjectManager::ParallelUpdate(JobSystem& jobSystem, UpdatePhase phase, float dt)
+	{
+		inParallelUpdate = true;
+
+		jobSystem.ParallelFor(static_cast<unsigned>(objects.Size()), parallelUpdateGrainSize,
+			[this, phase, dt](unsigned begin, unsigned end)
+			{
+				for (unsigned i = begin; i < end; ++i)
+				{
+					if (phase == PhaseUpdate)
+						objects[i]->Update(dt, true);
+					else
+						objects[i]->FixedUpdate(dt, true);
+				}
+			});
+
+		inParallelUpdate = false;
+
+		// Sync point - add objects that were created during the update
+		for (auto it = deferredObjects.Begin(); it != deferredObjects.End(); ++it)
+			AddObject(**it);
+		deferredObjects.Clear();
+	}
+
 	// Check collisions between pairs of objects.
 	void GameObjectManager::CheckCollisions()
 	{
@@ -380,6 +668,226 @@ namespace Beta
 		}
 	}
 
+	// Check collisions using the pairs found by the AABB tree.
+	void GameObjectManager::CheckCollisionsAABBTree()
+	{
+		// Objects have moved since the last step
+		UpdateAABBTree();
+
+		const Array<BroadphasePair>& pairs = aabbTree->GetPairs();
+		unsigned numPairs = static_cast<unsigned>(pairs.Size());
+
+		// Test simple shapes together when there are enough of them
+		bool batched = numPairs >= batchPairThreshold;
+		if (batched)
+			TestPairsBatched(pairs);
+
+		for (unsigned i = 0; i < numPairs; ++i)
+		{
+			GameObject* first = aabbTree->GetObject(pairs[i].proxyA);
+			GameObject* second = aabbTree->GetObject(pairs[i].proxyB);
+
+			// Skip inactive/destroyed
+			if (!first->IsActive() || first->IsDestroyed()
+				|| !second->IsActive() || second->IsDestroyed())
+				continue;
+
+			Collider* firstCollider = first->GetComponent<Collider>();
+			Collider* secondCollider = second->GetComponent<Collider>();
+
+			// Perform collision check and use callbacks if there is a collision
+			bool colliding;
+			if (batched && GetBatchedResult(i, *firstCollider, *secondCollider, colliding))
+				firstCollider->CheckCollision(*secondCollider, colliding);
+			else
+				firstCollider->CheckCollision(*secondCollider);
+		}
+	}
+
+	// Test the shapes of the circle and rectangle pairs found by the AABB tree
+	// together, using the batch tests in Intersection2D.
+	// Params:
+	//   pairs = The pairs found by the AABB tree.
+	void GameObjectManager::TestPairsBatched(const Array<BroadphasePair>& pairs)
+	{
+		using namespace Intersection2D;
+
+		batchSlots.Clear();
+		batchCircles[0].Clear();
+		batchCircles[1].Clear();
+		batchRectangles[0].Clear();
+		batchRectangles[1].Clear();
+		batchMixedRectangles.Clear();
+		batchMixedCircles.Clear();
+
+		// Sort the shapes of each pair by kind
+		for (auto it = pairs.Begin(); it != pairs.End(); ++it)
+		{
+			const Collider& first = *aabbTree->GetObject(it->proxyA)->GetComponent<Collider>();
+			const Collider& second = *aabbTree->GetObject(it->proxyB)->GetComponent<Collider>();
+			ColliderType firstType = first.GetColliderType();
+			ColliderType secondType = second.GetColliderType();
+
+			if (firstType == ColliderTypeCircle && secondType == ColliderTypeCircle)
+			{
+				batchSlots.PushBack(batchCircles[0].Size());
+				batchCircles[0].PushBack(GetCircle(first));
+				batchCircles[1].PushBack(GetCircle(second));
+			}
+			else if (firstType == ColliderTypeRectangle && secondType == ColliderTypeRectangle)
+			{
+				batchSlots.PushBack(batchRectangles[0].Size());
+				batchRectangles[0].PushBack(GetRectangle(first));
+				batchRectangles[1].PushBack(GetRectangle(second));
+			}
+			else if (firstType == ColliderTypeRectangle && secondType == ColliderTypeCircle)
+			{
+				batchSlots.PushBack(batchMixedRectangles.Size());
+				batchMixedRectangles.PushBack(GetRectangle(first));
+				batchMixedCircles.PushBack(GetCircle(second));
+			}
+			else if (firstType == ColliderTypeCircle && secondType == ColliderTypeRectangle)
+			{
+				batchSlots.PushBack(batchMixedRectangles.Size());
+				batchMixedRectangles.PushBack(GetRectangle(second));
+				batchMixedCircles.PushBack(GetCircle(first));
+			}
+			else
+			{
+				// Lines and tilemaps do more than test shapes
+				batchSlots.PushBack(notBatched);
+			}
+		}
+
+		batchHits.Clear();
+		CircleCircleIntersectionPairs(batchCircles[0], batchCircles[1], batchHits);
+		StoreResults(batchHits, batchCircles[0].Size(), batchCircleResults);
+
+		batchHits.Clear();
+		RectangleRectangleIntersectionPairs(batchRectangles[0], batchRectangles[1], batchHits);
+		StoreResults(batchHits, batchRectangles[0].Size(), batchRectangleResults);
+
+		batchHits.Clear();
+		RectangleCircleIntersectionPairs(batchMixedRectangles, batchMixedCircles, batchHits);
+		StoreResults(batchHits, batchMixedRectangles.Size(), batchMixedResults);
+	}
+
+	// Get the result of a pair's batch test, if its shapes have not changed since.
+	// Params:
+	//   pairIndex = The index of the pair in the AABB tree's pairs.
+	//   first = The first collider of the pair.
+	//   second = The second collider of the pair.
+	//   colliding = (Out) Whether the shapes were colliding.
+	// Returns:
+	//   True if the result can be used, false if the pair must be tested again.
+	bool GameObjectManager::GetBatchedResult(unsigned pairIndex, const Collider& first, const Collider& second,
+		bool& colliding) const
+	{
+		unsigned slot = batchSlots[pairIndex];
+		if (slot == notBatched)
+			return false;
+
+		// Collision handlers for earlier pairs may have moved the objects
+		ColliderType firstType = first.GetColliderType();
+		ColliderType secondType = second.GetColliderType();
+
+		if (firstType == ColliderTypeCircle && secondType == ColliderTypeCircle)
+		{
+			if (!IsSameCircle(batchCircles[0], slot, GetCircle(first))
+				|| !IsSameCircle(batchCircles[1], slot, GetCircle(second)))
+				return false;
+
+			colliding = batchCircleResults[slot];
+		}
+		else if (firstType == ColliderTypeRectangle && secondType == ColliderTypeRectangle)
+		{
+			if (!IsSameRectangle(batchRectangles[0], slot, GetRectangle(first))
+				|| !IsSameRectangle(batchRectangles[1], slot, GetRectangle(second)))
+				return false;
+
+			colliding = batchRectangleResults[slot];
+		}
+		else
+		{
+			const Collider& rectangle = firstType == ColliderTypeRectangle ? first : second;
+			const Collider& circle = firstType == ColliderTypeRectangle ? second : first;
+			if (!IsSameRectangle(batchMixedRectangles, slot, GetRectangle(rectangle))
+				|| !IsSameCircle(batchMixedCircles, slot, GetCircle(circle)))
+				return false;
+
+			colliding = batchMixedResults[slot];
+		}
+
+		return true;
+	}
+
+	// Move fast objects that hit something during the step back to their earliest
+	// impacts, then through the rest of the step (see Collider::StepToImpact).
+	// Objects are stepped in order of their first impacts, so the result doesn't
+	// depend on the order in which pairs were tested.
+	void GameObjectManager::StepFastObjects()
+	{
+		impactColliders.Clear();
+		for (auto it = objects.Begin(); it != objects.End(); ++it)
+		{
+			if (!(*it)->IsActive() || (*it)->IsDestroyed())
+				continue;
+
+			Collider* collider = (*it)->GetComponent<Collider>();
+			if (collider != nullptr && collider->HasImpact())
+				impactColliders.PushBack(collider);
+		}
+
+		std::sort(impactColliders.Begin(), impactColliders.End(),
+			[](const Collider* first, const Collider* second)
+			{
+				if (first->GetTimeOfImpact() != second->GetTimeOfImpact())
+					return first->GetTimeOfImpact() < second->GetTimeOfImpact();
+				return first->GetID() < second->GetID();
+			});
+
+		for (auto it = impactColliders.Begin(); it != impactColliders.End(); ++it)
+		{
+			Collider& collider = **it;
+
+			// Earlier impacts may have destroyed the object
+			for (unsigned step = 1; collider.HasImpact() && !collider.GetOwner()->IsDestroyed(); ++step)
+			{
+				if (!collider.StepToImpact(fixedUpdateDt, step < maxImpactSteps))
+					break;
+
+				// Look for anything else in the way during the rest of the step
+				BoundingRectangle bounds = collider.GetSweptBounds();
+				impactCandidates.Clear();
+				if (broadphaseType == BroadphaseAABBTree)
+				{
+					aabbTree->RetrieveNearbyObjects(bounds, impactCandidates);
+				}
+				else
+				{
+					for (auto jt = objects.Begin(); jt != objects.End(); ++jt)
+					{
+						Collider* other = (*jt)->GetComponent<Collider>();
+						if (other != nullptr && Intersection2D::RectangleRectangleIntersection(bounds, other->GetBounds()))
+							impactCandidates.PushBack(*jt);
+					}
+				}
+
+				for (auto jt = impactCandidates.Begin(); jt != impactCandidates.End(); ++jt)
+				{
+					if (!(*jt)->IsActive() || (*jt)->IsDestroyed())
+						continue;
+
+					Collider* other = (*jt)->GetComponent<Collider>();
+					if (other != nullptr)
+						collider.FindImpact(*other);
+				}
+			}
+
+			collider.EndImpactSteps();
+		}
+	}
+
 	// Destroy any objects marked for destruction.
 	void GameObjectManager::DestroyObjects()
 	{
@@ -388,6 +896,11 @@ namespace Beta
 			// Remove destroyed objects
 			if ((*it)->IsDestroyed())
 			{
+				// Remove from broadphase
+				Collider* collider = (*it)->GetComponent<Collider>();
+				if (collider != nullptr && collider->GetBroadphaseProxy() != AABBTree::nullProxy)
+					aabbTree->RemoveObject(collider->GetBroadphaseProxy());
+
 				delete* it;
 				it = objects.Erase(it);
 			}
@@ -432,6 +945,41 @@ namespace Beta
 		}
 	}
 
+	// Adds new objects to the AABB tree and updates the bounds of existing objects.
+	void GameObjectManager::UpdateAABBTree()
+	{
+		for (auto it = objects.Begin(); it != objects.End(); ++it)
+		{
+			Collider* collider = (*it)->GetComponent<Collider>();
+			if (collider == nullptr)
+				continue;
+
+			// Fast objects must also be found by anything they passed through this step
+			BoundingRectangle bounds = collider->GetSweptBounds();
+			int proxy = collider->GetBroadphaseProxy();
+
+			// New object
+			if (proxy == AABBTree::nullProxy)
+			{
+				collider->SetBroadphaseProxy(aabbTree->AddObject(*it, bounds));
+				continue;
+			}
+
+			// Predict movement so fast objects are reinserted less often
+			Vector2D displacement;
+			RigidBody* rigidBody = (*it)->GetComponent<RigidBody>();
+			if (rigidBody != nullptr)
+			{
+				Transform* transform = (*it)->GetComponent<Transform>();
+				displacement = transform->GetTranslation() - rigidBody->GetOldTranslation();
+			}
+
+			aabbTree->UpdateObject(proxy, bounds, displacement);
+		}
+
+		aabbTree->UpdatePairs();
+	}
+
 	void SwapGameObjects(GameObject** first, GameObject** second)
 	{
 		GameObject* temp = *first;
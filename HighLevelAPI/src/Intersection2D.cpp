@@ -21,9 +21,19 @@
 // STD
 #include <limits>
 
-// Components
-#include "RigidBody.h" // GetOldTranslation
-#include "Transform.h" // GetTranslation
+// Use the widest vector instructions the build allows for batch tests
+#if defined(__AVX__)
+#define BE_INTERSECTION2D_AVX 1
+#define BE_INTERSECTION2D_SSE 0
+#include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define BE_INTERSECTION2D_AVX 0
+#define BE_INTERSECTION2D_SSE 1
+#include <xmmintrin.h>
+#else
+#define BE_INTERSECTION2D_AVX 0
+#define BE_INTERSECTION2D_SSE 0
+#endif
 
 //------------------------------------------------------------------------------
 
@@ -45,13 +55,131 @@ namespace Beta
 		//   True if the point is between the two lines, false otherwise.
 		bool PointIsBetweenLines(const Vector2D& point, const Vector2D& firstLine, const Vector2D& secondLine, const Vector2D& normal, float distance);
 
-		// Reflects a point over a line.
+		// Finds when a moving point enters a rectangle.
 		// Params:
-		//   point = The point being reflected.
-		//   line = The line the point will be reflected over.
+		//   start = The start of the point's move.
+		//   velocity = The change in the point's position during the move.
+		//   rect = The rectangle.
+		//   t = T value of the point entering the rectangle.
 		// Returns:
-		//   The reflected point.
-		Vector2D ReflectPointOverLine(const Vector2D& point, const LineSegment& line, float radius);
+		//   True if the point enters the rectangle during the move, but was not inside at its start.
+		bool MovingPointRectangleIntersection(const Vector2D& start, const Vector2D& velocity,
+			const BoundingRectangle& rect, float& t);
+
+		//------------------------------------------------------------------------------
+		// Batch Test Helpers:
+		//------------------------------------------------------------------------------
+
+		namespace
+		{
+			// Each test is written once for both single floats and vectors of floats,
+			// so that the last few shapes of a batch get exactly the same math.
+			inline float Add(float a, float b) { return a + b; }
+			inline float Sub(float a, float b) { return a - b; }
+			inline float Mul(float a, float b) { return a * b; }
+			inline float Min(float a, float b) { return std::min(a, b); }
+			inline float Max(float a, float b) { return std::max(a, b); }
+			inline bool LessEqual(float a, float b) { return a <= b; }
+			inline bool And(bool a, bool b) { return a && b; }
+
+#if BE_INTERSECTION2D_AVX
+			typedef __m256 Lanes;
+			const unsigned laneCount = 8;
+
+			inline Lanes Add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+			inline Lanes Sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+			inline Lanes Mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+			inline Lanes Min(Lanes a, Lanes b) { return _mm256_min_ps(a, b); }
+			inline Lanes Max(Lanes a, Lanes b) { return _mm256_max_ps(a, b); }
+			inline Lanes LessEqual(Lanes a, Lanes b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+			inline Lanes And(Lanes a, Lanes b) { return _mm256_and_ps(a, b); }
+			inline Lanes LoadLanes(const float* memory) { return _mm256_loadu_ps(memory); }
+			inline Lanes BroadcastLanes(float value) { return _mm256_set1_ps(value); }
+			inline unsigned MoveMask(Lanes mask) { return static_cast<unsigned>(_mm256_movemask_ps(mask)); }
+#elif BE_INTERSECTION2D_SSE
+			typedef __m128 Lanes;
+			const unsigned laneCount = 4;
+
+			inline Lanes Add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+			inline Lanes Sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+			inline Lanes Mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+			inline Lanes Min(Lanes a, Lanes b) { return _mm_min_ps(a, b); }
+			inline Lanes Max(Lanes a, Lanes b) { return _mm_max_ps(a, b); }
+			inline Lanes LessEqual(Lanes a, Lanes b) { return _mm_cmple_ps(a, b); }
+			inline Lanes And(Lanes a, Lanes b) { return _mm_and_ps(a, b); }
+			inline Lanes LoadLanes(const float* memory) { return _mm_loadu_ps(memory); }
+			inline Lanes BroadcastLanes(float value) { return _mm_set1_ps(value); }
+			inline unsigned MoveMask(Lanes mask) { return static_cast<unsigned>(_mm_movemask_ps(mask)); }
+#else
+			// No vector instructions, so every shape is tested one at a time
+			typedef float Lanes;
+			const unsigned laneCount = 1;
+
+			inline Lanes LoadLanes(const float* memory) { return *memory; }
+			inline Lanes BroadcastLanes(float value) { return value; }
+			inline unsigned MoveMask(bool mask) { return mask ? 1 : 0; }
+#endif
+
+			// Same as CircleCircleIntersection.
+			template <typename T>
+			auto CircleCircleTest(T x1, T y1, T radius1, T x2, T y2, T radius2)
+			{
+				T xDiff = Sub(x1, x2);
+				T yDiff = Sub(y1, y2);
+				T distanceSquared = Add(Mul(xDiff, xDiff), Mul(yDiff, yDiff));
+				T radiusSum = Add(radius1, radius2);
+				return LessEqual(distanceSquared, Mul(radiusSum, radiusSum));
+			}
+
+			// Same as RectangleRectangleIntersection.
+			template <typename T>
+			auto RectangleRectangleTest(T left1, T bottom1, T right1, T top1, T left2, T bottom2, T right2, T top2)
+			{
+				return And(And(LessEqual(bottom1, top2), LessEqual(bottom2, top1)),
+					And(LessEqual(left1, right2), LessEqual(left2, right1)));
+			}
+
+			// Same as RectangleCircleIntersection. Clamping the center to the sides
+			// finds the same closest point as comparing it with the rectangle's center.
+			template <typename T>
+			auto RectangleCircleTest(T left, T bottom, T right, T top, T x, T y, T radius)
+			{
+				T xDiff = Sub(Min(Max(x, left), right), x);
+				T yDiff = Sub(Min(Max(y, bottom), top), y);
+				T distanceSquared = Add(Mul(xDiff, xDiff), Mul(yDiff, yDiff));
+				return LessEqual(distanceSquared, Mul(radius, radius));
+			}
+
+			// Run a test on every index of a batch, several indices at a time.
+			// Params:
+			//   count = The number of indices in the batch.
+			//   laneTest = Tests laneCount indices, starting at the given index.
+			//   singleTest = Tests the given index.
+			//   hits = (Out) The indices that pass are added to this array.
+			template <typename LaneTest, typename SingleTest>
+			void RunBatch(unsigned count, const LaneTest& laneTest, const SingleTest& singleTest, Array<unsigned>& hits)
+			{
+				unsigned i = 0;
+
+				for (; i + laneCount <= count; i += laneCount)
+				{
+					// One bit for each lane that passed
+					unsigned mask = MoveMask(laneTest(i));
+					for (unsigned lane = i; mask != 0; ++lane, mask >>= 1)
+					{
+						if (mask & 1)
+							hits.PushBack(lane);
+					}
+				}
+
+				// Shapes left over after the last full set of lanes
+				for (; i < count; ++i)
+				{
+					if (singleTest(i))
+						hits.PushBack(i);
+				}
+			}
+		}
 
 		//------------------------------------------------------------------------------
 		// Public Function Definitions:
@@ -322,57 +450,446 @@ namespace Beta
 			return true;
 		}
 
-		// Modifies object's position, velocity, and rotation using simple point-line reflection.
+		// Check whether two line segments intersect.
 		// Params:
-		//  transform = Transform of the object that is being reflected.
-		//  physics   = Physics of the object being reflected.
-		//  staticLine   = Start and end of first line segment.
-		//  movingCircle = Start and end of second line segment (can be moving point or circle).
-		//  radius		 = Radius of the circle. (Use 0 for points.)
-		//  intersection = Intersection point of the line and circle. 
-		void MovingCircleLineReflection(Transform & transform, RigidBody & physics, const LineSegment & staticLine, const LineSegment & movingCircle, float radius, const Vector2D & intersection)
+		//  first   = Start and end of first line segment.
+		//  second  = Start and end of second line segment.
+		//  intersection = Intersection point, if any.
+		// Returns:
+		//   True if intersection, false otherwise.
+		bool LineLineIntersection(const LineSegment & first, const LineSegment & second, Vector2D & intersection, float& t)
 		{
-			// 0. Figure out which side of the line the circle is on...
-			bool inside = staticLine.normal.DotProduct((movingCircle.end - staticLine.start).Normalized()) > 0.0f;
-			// If inside, use radius, if outside use -radius
-			float distance = inside ? radius : -radius;
+			return MovingCircleLineIntersection(first, second, 0, intersection, t);
+		}
+
+		// Check whether a moving circle touches a static circle during its move.
+		// Params:
+		//  movingCircle = Start and end of the moving circle's center.
+		//  radius		 = Radius of the moving circle.
+		//  staticCircle = The circle that is not moving.
+		//  t = T value of the first contact along the move.
+		// Returns:
+		//   True if the circles touch during the move, but did not overlap at its start.
+		bool MovingCircleCircleIntersection(const LineSegment& movingCircle, float radius,
+			const Circle& staticCircle, float& t)
+		{
+			// Same as moving a point toward a circle with both radii
+			Circle combined(staticCircle.center, staticCircle.radius + radius);
+
+			// Not moving, or already overlapping
+			if ((movingCircle.end - movingCircle.start).MagnitudeSquared() == 0.0f
+				|| movingCircle.start.DistanceSquared(combined.center) <= combined.radius * combined.radius)
+				return false;
+
+			return StaticCircleLineIntersection(movingCircle, combined, t);
+		}
+
+		// Check whether a moving circle touches a static rectangle during its move.
+		// Params:
+		//  movingCircle = Start and end of the moving circle's center.
+		//  radius		 = Radius of the moving circle.
+		//  staticRectangle = The rectangle that is not moving.
+		//  t = T value of the first contact along the move.
+		// Returns:
+		//   True if the shapes touch during the move, but did not overlap at its start.
+		bool MovingCircleRectangleIntersection(const LineSegment& movingCircle, float radius,
+			const BoundingRectangle& staticRectangle, float& t)
+		{
+			Vector2D velocity = movingCircle.end - movingCircle.start;
+
+			// Not moving, or already overlapping
+			if (velocity.MagnitudeSquared() == 0.0f
+				|| RectangleCircleIntersection(staticRectangle, Circle(movingCircle.start, radius)))
+				return false;
+
+			// The circle's center touches the rectangle grown by the radius, with rounded
+			// corners. This is the same as two rectangles, each grown along one axis,
+			// plus a circle at each corner.
+			bool result = false;
+			float minT = std::numeric_limits<float>::max();
+
+			const BoundingRectangle grown[2] =
+			{
+				BoundingRectangle(staticRectangle.center, staticRectangle.extents + Vector2D(radius, 0.0f)),
+				BoundingRectangle(staticRectangle.center, staticRectangle.extents + Vector2D(0.0f, radius)),
+			};
 
-			// 1. Find correct position of object by reflecting its end point over the line.
-			// (Use the ReflectPointOverLine function!)
-			// Once found, set the object's translation to this reflected point.
-			Vector2D reflectedPosition = ReflectPointOverLine(movingCircle.end, staticLine, distance);
-			transform.SetTranslation(reflectedPosition);
+			for (unsigned i = 0; i < 2; ++i)
+			{
+				if (MovingPointRectangleIntersection(movingCircle.start, velocity, grown[i], t))
+				{
+					result = true;
+					minT = std::min(minT, t);
+				}
+			}
 
-			// 2. Use the reflected position and intersection point to find the
-			// direction of the reflected velocity. Make sure to normalize this vector!
-			Vector2D reflectedDirection = (reflectedPosition - intersection).Normalized();
+			const Vector2D corners[4] =
+			{
+				Vector2D(staticRectangle.left, staticRectangle.top),
+				Vector2D(staticRectangle.right, staticRectangle.top),
+				Vector2D(staticRectangle.left, staticRectangle.bottom),
+				Vector2D(staticRectangle.right, staticRectangle.bottom),
+			};
 
-			// 3. Set the velocity of the object to this direction times
-			// the magnitude of the current velocity.
-			physics.SetVelocity(reflectedDirection * physics.GetVelocity().Magnitude());
+			for (unsigned i = 0; i < 4; ++i)
+			{
+				if (MovingCircleCircleIntersection(movingCircle, radius, Circle(corners[i], 0.0f), t))
+				{
+					result = true;
+					minT = std::min(minT, t);
+				}
+			}
 
-			// 4. Find the object's new rotation by using atan2 with the reflected direction.
-			// Once found, set the rotation of the object to this angle.
-			float reflectedAngle = atan2f(reflectedDirection.y, reflectedDirection.x);
-			transform.SetRotation(reflectedAngle);
+			t = minT;
+			return result;
 		}
 
-		// Check whether two line segments intersect.
+		// Check whether a moving rectangle touches a static rectangle during its move.
 		// Params:
-		//  first   = Start and end of first line segment.
-		//  second  = Start and end of second line segment.
-		//  intersection = Intersection point, if any.
+		//  movingRectangle = Start and end of the moving rectangle's center.
+		//  extents		 = Extents of the moving rectangle.
+		//  staticRectangle = The rectangle that is not moving.
+		//  t = T value of the first contact along the move.
 		// Returns:
-		//   True if intersection, false otherwise.
-		bool LineLineIntersection(const LineSegment & first, const LineSegment & second, Vector2D & intersection, float& t)
+		//   True if the rectangles touch during the move, but did not overlap at its start.
+		bool MovingRectangleRectangleIntersection(const LineSegment& movingRectangle, const Vector2D& extents,
+			const BoundingRectangle& staticRectangle, float& t)
 		{
-			return MovingCircleLineIntersection(first, second, 0, intersection, t);
+			// Same as moving a point toward the static rectangle grown by the extents
+			return MovingPointRectangleIntersection(movingRectangle.start, movingRectangle.end - movingRectangle.start,
+				BoundingRectangle(staticRectangle.center, staticRectangle.extents + extents), t);
+		}
+
+		// Check whether a moving rectangle touches a static line segment during its move.
+		// Params:
+		//  movingRectangle = Start and end of the moving rectangle's center.
+		//  extents		 = Extents of the moving rectangle.
+		//  staticLine	 = The line segment that is not moving.
+		//  t = T value of the first contact along the move.
+		// Returns:
+		//   True if the shapes touch during the move, but did not overlap at its start.
+		bool MovingRectangleLineIntersection(const LineSegment& movingRectangle, const Vector2D& extents,
+			const LineSegment& staticLine, float& t)
+		{
+			Vector2D velocity = movingRectangle.end - movingRectangle.start;
+			BoundingRectangle startRectangle(movingRectangle.start, extents);
+
+			// Not moving, or already overlapping
+			if (velocity.MagnitudeSquared() == 0.0f
+				|| RectangleLineIntersection(startRectangle, staticLine, t)
+				|| PointRectangleIntersection(staticLine.start, startRectangle))
+				return false;
+
+			bool result = false;
+			float minT = std::numeric_limits<float>::max();
+			Vector2D intersection;
+
+			// First contact is either a corner of the rectangle hitting the line...
+			const Vector2D corners[4] =
+			{
+				Vector2D(startRectangle.left, startRectangle.top),
+				Vector2D(startRectangle.right, startRectangle.top),
+				Vector2D(startRectangle.left, startRectangle.bottom),
+				Vector2D(startRectangle.right, startRectangle.bottom),
+			};
+
+			for (unsigned i = 0; i < 4; ++i)
+			{
+				if (LineLineIntersection(staticLine, LineSegment(corners[i], corners[i] + velocity), intersection, t))
+				{
+					result = true;
+					minT = std::min(minT, t);
+				}
+			}
+
+			// ...or an end of the line hitting the rectangle, which is the same as
+			// the end moving the opposite way
+			const Vector2D ends[2] = { staticLine.start, staticLine.end };
+			for (unsigned i = 0; i < 2; ++i)
+			{
+				if (RectangleLineIntersection(startRectangle, LineSegment(ends[i], ends[i] - velocity), t))
+				{
+					result = true;
+					minT = std::min(minT, t);
+				}
+			}
+
+			t = minT;
+			return result;
+		}
+
+		// Add a circle to the end of the batch.
+		void CircleBatch::PushBack(const Circle& circle)
+		{
+			x.PushBack(circle.center.x);
+			y.PushBack(circle.center.y);
+			radius.PushBack(circle.radius);
+		}
+
+		// Remove all circles from the batch.
+		void CircleBatch::Clear()
+		{
+			x.Clear();
+			y.Clear();
+			radius.Clear();
+		}
+
+		// Returns the number of circles in the batch.
+		unsigned CircleBatch::Size() const
+		{
+			return static_cast<unsigned>(x.Size());
+		}
+
+		// Add a rectangle to the end of the batch.
+		void RectangleBatch::PushBack(const BoundingRectangle& rectangle)
+		{
+			left.PushBack(rectangle.left);
+			bottom.PushBack(rectangle.bottom);
+			right.PushBack(rectangle.right);
+			top.PushBack(rectangle.top);
+		}
+
+		// Remove all rectangles from the batch.
+		void RectangleBatch::Clear()
+		{
+			left.Clear();
+			bottom.Clear();
+			right.Clear();
+			top.Clear();
+		}
+
+		// Returns the number of rectangles in the batch.
+		unsigned RectangleBatch::Size() const
+		{
+			return static_cast<unsigned>(left.Size());
+		}
+
+		// Check which circles in a batch intersect a circle.
+		// Params:
+		//  circle  = The circle.
+		//  circles = The circles to test against it.
+		//  hits = (Out) The indices of the intersecting circles are added to this array.
+		void CircleCircleIntersectionBatch(const Circle& circle, const CircleBatch& circles,
+			Array<unsigned>& hits)
+		{
+			const float* x = circles.x.Data();
+			const float* y = circles.y.Data();
+			const float* radius = circles.radius.Data();
+
+			const Lanes laneX = BroadcastLanes(circle.center.x);
+			const Lanes laneY = BroadcastLanes(circle.center.y);
+			const Lanes laneRadius = BroadcastLanes(circle.radius);
+
+			RunBatch(circles.Size(),
+				[&](unsigned i) { return CircleCircleTest(laneX, laneY, laneRadius,
+					LoadLanes(x + i), LoadLanes(y + i), LoadLanes(radius + i)); },
+				[&](unsigned i) { return CircleCircleTest(circle.center.x, circle.center.y, circle.radius,
+					x[i], y[i], radius[i]); },
+				hits);
+		}
+
+		// Check which rectangles in a batch intersect a rectangle.
+		// Params:
+		//  rect  = The rectangle.
+		//  rects = The rectangles to test against it.
+		//  hits = (Out) The indices of the intersecting rectangles are added to this array.
+		void RectangleRectangleIntersectionBatch(const BoundingRectangle& rect, const RectangleBatch& rects,
+			Array<unsigned>& hits)
+		{
+			const float* left = rects.left.Data();
+			const float* bottom = rects.bottom.Data();
+			const float* right = rects.right.Data();
+			const float* top = rects.top.Data();
+
+			const Lanes laneLeft = BroadcastLanes(rect.left);
+			const Lanes laneBottom = BroadcastLanes(rect.bottom);
+			const Lanes laneRight = BroadcastLanes(rect.right);
+			const Lanes laneTop = BroadcastLanes(rect.top);
+
+			RunBatch(rects.Size(),
+				[&](unsigned i) { return RectangleRectangleTest(laneLeft, laneBottom, laneRight, laneTop,
+					LoadLanes(left + i), LoadLanes(bottom + i), LoadLanes(right + i), LoadLanes(top + i)); },
+				[&](unsigned i) { return RectangleRectangleTest(rect.left, rect.bottom, rect.right, rect.top,
+					left[i], bottom[i], right[i], top[i]); },
+				hits);
+		}
+
+		// Check which circles in a batch intersect a rectangle.
+		// Params:
+		//  rect    = The rectangle.
+		//  circles = The circles to test against it.
+		//  hits = (Out) The indices of the intersecting circles are added to this array.
+		void RectangleCircleIntersectionBatch(const BoundingRectangle& rect, const CircleBatch& circles,
+			Array<unsigned>& hits)
+		{
+			const float* x = circles.x.Data();
+			const float* y = circles.y.Data();
+			const float* radius = circles.radius.Data();
+
+			const Lanes laneLeft = BroadcastLanes(rect.left);
+			const Lanes laneBottom = BroadcastLanes(rect.bottom);
+			const Lanes laneRight = BroadcastLanes(rect.right);
+			const Lanes laneTop = BroadcastLanes(rect.top);
+
+			RunBatch(circles.Size(),
+				[&](unsigned i) { return RectangleCircleTest(laneLeft, laneBottom, laneRight, laneTop,
+					LoadLanes(x + i), LoadLanes(y + i), LoadLanes(radius + i)); },
+				[&](unsigned i) { return RectangleCircleTest(rect.left, rect.bottom, rect.right, rect.top,
+					x[i], y[i], radius[i]); },
+				hits);
+		}
+
+		// Check which rectangles in a batch intersect a circle.
+		// Params:
+		//  circle = The circle.
+		//  rects  = The rectangles to test against it.
+		//  hits = (Out) The indices of the intersecting rectangles are added to this array.
+		void CircleRectangleIntersectionBatch(const Circle& circle, const RectangleBatch& rects,
+			Array<unsigned>& hits)
+		{
+			const float* left = rects.left.Data();
+			const float* bottom = rects.bottom.Data();
+			const float* right = rects.right.Data();
+			const float* top = rects.top.Data();
+
+			const Lanes laneX = BroadcastLanes(circle.center.x);
+			const Lanes laneY = BroadcastLanes(circle.center.y);
+			const Lanes laneRadius = BroadcastLanes(circle.radius);
+
+			RunBatch(rects.Size(),
+				[&](unsigned i) { return RectangleCircleTest(LoadLanes(left + i), LoadLanes(bottom + i),
+					LoadLanes(right + i), LoadLanes(top + i), laneX, laneY, laneRadius); },
+				[&](unsigned i) { return RectangleCircleTest(left[i], bottom[i], right[i], top[i],
+					circle.center.x, circle.center.y, circle.radius); },
+				hits);
+		}
+
+		// Check which pairs of circles intersect. Pair i is made of the circles
+		// at index i in each batch. Both batches must be the same size.
+		// Params:
+		//  first  = The first circle of each pair.
+		//  second = The second circle of each pair.
+		//  hits = (Out) The indices of the intersecting pairs are added to this array.
+		void CircleCircleIntersectionPairs(const CircleBatch& first, const CircleBatch& second,
+			Array<unsigned>& hits)
+		{
+			const float* x1 = first.x.Data();
+			const float* y1 = first.y.Data();
+			const float* radius1 = first.radius.Data();
+			const float* x2 = second.x.Data();
+			const float* y2 = second.y.Data();
+			const float* radius2 = second.radius.Data();
+
+			RunBatch(std::min(first.Size(), second.Size()),
+				[&](unsigned i) { return CircleCircleTest(LoadLanes(x1 + i), LoadLanes(y1 + i), LoadLanes(radius1 + i),
+					LoadLanes(x2 + i), LoadLanes(y2 + i), LoadLanes(radius2 + i)); },
+				[&](unsigned i) { return CircleCircleTest(x1[i], y1[i], radius1[i], x2[i], y2[i], radius2[i]); },
+				hits);
+		}
+
+		// Check which pairs of rectangles intersect. Pair i is made of the rectangles
+		// at index i in each batch. Both batches must be the same size.
+		// Params:
+		//  first  = The first rectangle of each pair.
+		//  second = The second rectangle of each pair.
+		//  hits = (Out) The indices of the intersecting pairs are added to this array.
+		void RectangleRectangleIntersectionPairs(const RectangleBatch& first, const RectangleBatch& second,
+			Array<unsigned>& hits)
+		{
+			const float* left1 = first.left.Data();
+			const float* bottom1 = first.bottom.Data();
+			const float* right1 = first.right.Data();
+			const float* top1 = first.top.Data();
+			const float* left2 = second.left.Data();
+			const float* bottom2 = second.bottom.Data();
+			const float* right2 = second.right.Data();
+			const float* top2 = second.top.Data();
+
+			RunBatch(std::min(first.Size(), second.Size()),
+				[&](unsigned i) { return RectangleRectangleTest(
+					LoadLanes(left1 + i), LoadLanes(bottom1 + i), LoadLanes(right1 + i), LoadLanes(top1 + i),
+					LoadLanes(left2 + i), LoadLanes(bottom2 + i), LoadLanes(right2 + i), LoadLanes(top2 + i)); },
+				[&](unsigned i) { return RectangleRectangleTest(left1[i], bottom1[i], right1[i], top1[i],
+					left2[i], bottom2[i], right2[i], top2[i]); },
+				hits);
+		}
+
+		// Check which pairs of rectangles and circles intersect. Pair i is made of the
+		// shapes at index i in each batch. Both batches must be the same size.
+		// Params:
+		//  rects   = The rectangle of each pair.
+		//  circles = The circle of each pair.
+		//  hits = (Out) The indices of the intersecting pairs are added to this array.
+		void RectangleCircleIntersectionPairs(const RectangleBatch& rects, const CircleBatch& circles,
+			Array<unsigned>& hits)
+		{
+			const float* left = rects.left.Data();
+			const float* bottom = rects.bottom.Data();
+			const float* right = rects.right.Data();
+			const float* top = rects.top.Data();
+			const float* x = circles.x.Data();
+			const float* y = circles.y.Data();
+			const float* radius = circles.radius.Data();
+
+			RunBatch(std::min(rects.Size(), circles.Size()),
+				[&](unsigned i) { return RectangleCircleTest(LoadLanes(left + i), LoadLanes(bottom + i),
+					LoadLanes(right + i), LoadLanes(top + i), LoadLanes(x + i), LoadLanes(y + i), LoadLanes(radius + i)); },
+				[&](unsigned i) { return RectangleCircleTest(left[i], bottom[i], right[i], top[i],
+					x[i], y[i], radius[i]); },
+				hits);
 		}
 
 		//------------------------------------------------------------------------------
 		// Private Functions:
 		//------------------------------------------------------------------------------
 
+		// Finds when a moving point enters a rectangle.
+		// Params:
+		//   start = The start of the point's move.
+		//   velocity = The change in the point's position during the move.
+		//   rect = The rectangle.
+		//   t = T value of the point entering the rectangle.
+		// Returns:
+		//   True if the point enters the rectangle during the move, but was not inside at its start.
+		bool MovingPointRectangleIntersection(const Vector2D& start, const Vector2D& velocity,
+			const BoundingRectangle& rect, float& t)
+		{
+			const float starts[2] = { start.x, start.y };
+			const float velocities[2] = { velocity.x, velocity.y };
+			const float minimums[2] = { rect.left, rect.bottom };
+			const float maximums[2] = { rect.right, rect.top };
+
+			// Find when the point is between the sides on both axes
+			float tEnter = 0.0f;
+			float tExit = 1.0f;
+			for (unsigned i = 0; i < 2; ++i)
+			{
+				if (velocities[i] == 0.0f)
+				{
+					if (starts[i] < minimums[i] || starts[i] > maximums[i])
+						return false;
+					continue;
+				}
+
+				float t0 = (minimums[i] - starts[i]) / velocities[i];
+				float t1 = (maximums[i] - starts[i]) / velocities[i];
+				if (t0 > t1)
+					std::swap(t0, t1);
+
+				tEnter = std::max(tEnter, t0);
+				tExit = std::min(tExit, t1);
+				if (tEnter > tExit)
+					return false;
+			}
+
+			// Already inside at the start
+			if (tEnter <= 0.0f)
+				return false;
+
+			t = tEnter;
+			return true;
+		}
+
 		// Checks whether a point is between two parallel lines.
 		// Params:
 		//   point = The point in question.
@@ -424,44 +941,5 @@ namespace Beta
 			// 4. All other cases eliminated, so it must be between them. Return true!
 			return true;
 		}
-
-		// Reflects a point over a line.
-		// Params:
-		//   point = The point being reflected.
-		//   line = The line the point will be reflected over.
-		// Returns:
-		//   The reflected point.
-		Vector2D ReflectPointOverLine(const Vector2D & point, const LineSegment & line, float radius)
-		{
-			// 1. Pretend everything is at the origin by subtracting one of the line's 
-			// points from the point we are reflecting.
-			// translated point p = point - line.start
-			Vector2D translated = point - line.start;
-
-			//////////////////////////////////////////////////////////////////////////////
-			//																			//
-			// Equation for reflected point R is as follows, given point P,				//
-			// and a line with normal n:												//
-			//		R = P - 2 * projection of P onto n									//
-			//																			//
-			// Equation for projected point J (projection of P onto N) is as follows:	//
-			//																			//
-			//		J = (P dot n) / (magnitude(n) squared) * n							//
-			//																			//
-			// However, since our normal is normalized (magnitude = 1), this simplifies //
-			// the projection (and hence the reflection) significantly:					//
-			//																			//
-			//		J = (P dot n) * n													//
-			//																			//
-			//////////////////////////////////////////////////////////////////////////////
-
-			// 2. Calculate the reflected point and store it in a variable.
-			// reflected point = P - 2 * (P dot n) * n
-			Vector2D reflected = translated - (2.0f * (line.normal.DotProduct(translated) - radius)) * line.normal;
-
-			// 3. We need to remember to move things back away from the origin before returning.
-			// Return the reflected point + line.start
-			return reflected + line.start;
-		}
 	}
 }
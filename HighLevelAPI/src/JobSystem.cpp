@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	JobSystem.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "JobSystem.h"
+
+// Systems
+#include <Profiler.h>	// SetThreadName
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Set on worker threads, and on the calling thread during ParallelFor,
+		// so that nested loops run inline instead of waiting on themselves
+		thread_local bool insideJob = false;
+	}
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor - Starts the worker threads.
+	// Params:
+	//   numThreads = The number of threads that run jobs, including the thread
+	//     that calls ParallelFor. If 0, the number of hardware threads is used.
+	JobSystem::JobSystem(unsigned numThreads)
+		: BetaObject("Module:JobSystem"), queuedJobs(0), stopping(false)
+	{
+		StartWorkers(numThreads);
+	}
+
+	// Destructor - Stops the worker threads.
+	JobSystem::~JobSystem()
+	{
+		StopWorkers();
+	}
+
+	// Run a function over a range of items using all threads, and wait for it to finish.
+	// Calls made from inside a job run on the calling thread.
+	// Params:
+	//   count     = The number of items.
+	//   grainSize = The number of items given to a thread at a time.
+	//   function  = The function that processes a range of items.
+	void JobSystem::ParallelFor(unsigned count, unsigned grainSize, const RangeFunction& function)
+	{
+		if (count == 0)
+			return;
+
+		if (grainSize == 0)
+			grainSize = 1;
+
+		// Not worth splitting up
+		unsigned numQueues = static_cast<unsigned>(queues.size());
+		if (insideJob || numQueues == 1 || count <= grainSize)
+		{
+			function(0, count);
+			return;
+		}
+
+		unsigned numJobs = (count + grainSize - 1) / grainSize;
+		std::atomic<unsigned> remaining(numJobs);
+
+		// Count jobs before queueing them so that workers never see more jobs than the count
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			queuedJobs += numJobs;
+		}
+
+		// Give each thread a contiguous block of jobs to keep its items together in memory
+		for (unsigned q = 0; q < numQueues; ++q)
+		{
+			unsigned firstJob = numJobs * q / numQueues;
+			unsigned lastJob = numJobs * (q + 1) / numQueues;
+
+			std::lock_guard<std::mutex> lock(queues[q]->mutex);
+			for (unsigned j = firstJob; j < lastJob; ++j)
+			{
+				Job job;
+				job.function = &function;
+				job.begin = j * grainSize;
+				job.end = j * grainSize + grainSize < count ? j * grainSize + grainSize : count;
+				job.remaining = &remaining;
+				queues[q]->jobs.push_back(job);
+			}
+		}
+
+		workAvailable.notify_all();
+
+		// Help out until every job has finished
+		insideJob = true;
+		while (remaining.load() != 0)
+		{
+			Job job;
+			if (PopJob(0, job))
+				RunJob(job);
+			else
+				std::this_thread::yield();
+		}
+		insideJob = false;
+	}
+
+	// Returns the number of threads that run jobs, including the calling thread.
+	unsigned JobSystem::GetThreadCount() const
+	{
+		return static_cast<unsigned>(queues.size());
+	}
+
+	// Restart the pool with a different number of threads.
+	// Must not be called while jobs are running.
+	// Params:
+	//   numThreads = The number of threads that run jobs, including the
+	//     thread that calls ParallelFor. If 0, the number of hardware threads is used.
+	void JobSystem::SetThreadCount(unsigned numThreads)
+	{
+		StopWorkers();
+		StartWorkers(numThreads);
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Create the queues and worker threads.
+	void JobSystem::StartWorkers(unsigned numThreads)
+	{
+		if (numThreads == 0)
+			numThreads = std::thread::hardware_concurrency();
+		if (numThreads == 0)
+			numThreads = 1;
+
+		stopping = false;
+
+		queues.reserve(numThreads);
+		for (unsigned i = 0; i < numThreads; ++i)
+			queues.push_back(new JobQueue());
+
+		// The calling thread uses queue 0
+		workers.reserve(numThreads - 1);
+		for (unsigned i = 1; i < numThreads; ++i)
+			workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+
+	// Stop the worker threads and destroy the queues.
+	void JobSystem::StopWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			stopping = true;
+		}
+		workAvailable.notify_all();
+
+		for (auto it = workers.begin(); it != workers.end(); ++it)
+			it->join();
+		workers.clear();
+
+		for (auto it = queues.begin(); it != queues.end(); ++it)
+			delete *it;
+		queues.clear();
+	}
+
+	// Runs jobs until the job system is stopped.
+	void JobSystem::WorkerLoop(unsigned queueIndex)
+	{
+		insideJob = true;
+		Profiler::SetThreadName("Worker " + std::to_string(queueIndex));
+
+		for (;;)
+		{
+			Job job;
+			if (PopJob(queueIndex, job))
+			{
+				RunJob(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			workAvailable.wait(lock, [this]() { return stopping || queuedJobs.load() != 0; });
+
+			if (stopping)
+				return;
+		}
+	}
+
+	// Take a job from a thread's own queue, or steal one from another queue.
+	bool JobSystem::PopJob(unsigned queueIndex, Job& job)
+	{
+		unsigned numQueues = static_cast<unsigned>(queues.size());
+
+		// Newest job from own queue
+		{
+			JobQueue& queue = *queues[queueIndex];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.jobs.empty())
+			{
+				job = queue.jobs.back();
+				queue.jobs.pop_back();
+				--queuedJobs;
+				return true;
+			}
+		}
+
+		// Oldest job from the next queue that has one
+		for (unsigned i = 1; i < numQueues; ++i)
+		{
+			JobQueue& queue = *queues[(queueIndex + i) % numQueues];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.jobs.empty())
+			{
+				job = queue.jobs.front();
+				queue.jobs.pop_front();
+				--queuedJobs;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Run a job and mark it as finished.
+	void JobSystem::RunJob(const Job& job)
+	{
+		(*job.function)(job.begin, job.end);
+
+		// The job's owner may return as soon as this reaches zero
+		--(*job.remaining);
+	}
+}
+
+//------------------------------------------------------------------------------
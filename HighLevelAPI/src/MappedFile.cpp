@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	MappedFile.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "MappedFile.h"
+
+#ifndef _WIN32
+	#include <sys/mman.h>	// mmap, munmap
+	#include <sys/stat.h>	// fstat
+	#include <fcntl.h>		// open
+	#include <unistd.h>		// close
+#endif
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor - Does not map anything.
+	MappedFile::MappedFile()
+		: data(nullptr), size(0)
+	{
+	}
+
+	// Destructor - Unmaps the file if one is open.
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	// Map a file into memory, replacing any file that is already mapped.
+	// Params:
+	//   filename = The path of the file to map.
+	// Returns:
+	//   True if the file was mapped, false otherwise.
+	bool MappedFile::Open(const std::string& filename)
+	{
+		Close();
+
+#ifdef _WIN32
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		// The view keeps the mapping alive, so the handles can be closed right away
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (mapping == nullptr)
+			return false;
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+		CloseHandle(mapping);
+		if (view == nullptr)
+			return false;
+
+		data = static_cast<char*>(view);
+		size = static_cast<size_t>(fileSize.QuadPart);
+#else
+		int file = open(filename.c_str(), O_RDONLY);
+		if (file < 0)
+			return false;
+
+		struct stat fileInfo;
+		if (fstat(file, &fileInfo) != 0 || fileInfo.st_size == 0)
+		{
+			close(file);
+			return false;
+		}
+
+		void* view = mmap(nullptr, fileInfo.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+		close(file);
+		if (view == MAP_FAILED)
+			return false;
+
+		data = static_cast<char*>(view);
+		size = static_cast<size_t>(fileInfo.st_size);
+#endif
+
+		return true;
+	}
+
+	// Unmap the current file.
+	void MappedFile::Close()
+	{
+		if (data == nullptr)
+			return;
+
+#ifdef _WIN32
+		UnmapViewOfFile(data);
+#else
+		munmap(data, size);
+#endif
+
+		data = nullptr;
+		size = 0;
+	}
+
+	// Test whether a file is currently mapped.
+	bool MappedFile::IsOpen() const
+	{
+		return data != nullptr;
+	}
+
+	// Returns a pointer to the start of the mapped file.
+	char* MappedFile::GetData() const
+	{
+		return data;
+	}
+
+	// Returns the size of the mapped file in bytes.
+	size_t MappedFile::GetSize() const
+	{
+		return size;
+	}
+}
+
+//------------------------------------------------------------------------------
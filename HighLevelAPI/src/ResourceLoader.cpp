@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ResourceLoader.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "ResourceLoader.h"
+
+#include <chrono>	// steady_clock
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Most worker threads to start when the count is chosen automatically
+		const unsigned maxDefaultWorkers = 4;
+		// Default time the main thread may spend finishing loads each frame (2 ms)
+		const float defaultUploadBudget = 0.002f;
+	}
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor - Starts the worker threads.
+	// Params:
+	//   numWorkers = The number of worker threads. If 0, a count is
+	//     chosen based on the number of hardware threads.
+	ResourceLoader::ResourceLoader(unsigned numWorkers)
+		: BetaObject("Module:ResourceLoader"), pending(0), stopping(false),
+		uploadBudget(defaultUploadBudget)
+	{
+		if (numWorkers == 0)
+		{
+			// Leave one hardware thread for the main thread
+			unsigned hardwareThreads = std::thread::hardware_concurrency();
+			numWorkers = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+			if (numWorkers > maxDefaultWorkers)
+				numWorkers = maxDefaultWorkers;
+		}
+
+		workers.reserve(numWorkers);
+		for (unsigned i = 0; i < numWorkers; ++i)
+			workers.emplace_back(&ResourceLoader::WorkerLoop, this);
+	}
+
+	// Destructor - Finishes all queued loads, then stops the worker threads.
+	ResourceLoader::~ResourceLoader()
+	{
+		// Resources that are still loading would otherwise stay placeholders
+		Flush();
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		workAvailable.notify_all();
+
+		for (auto it = workers.begin(); it != workers.end(); ++it)
+			it->join();
+	}
+
+	// Finishes loads that are ready, until the upload budget is used up.
+	// Params:
+	//   dt = The change in time since the previous frame.
+	void ResourceLoader::Update(float dt)
+	{
+		UNREFERENCED_PARAMETER(dt);
+
+		if (pending == 0)
+			return;
+
+		using namespace std::chrono;
+		steady_clock::time_point start = steady_clock::now();
+
+		for (;;)
+		{
+			LoadRequest request;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (completed.empty())
+					break;
+
+				request = completed.front();
+				completed.pop_front();
+			}
+
+			Finish(request);
+
+			// Always finish at least one request, then stop once the budget is spent
+			if (duration<float>(steady_clock::now() - start).count() >= uploadBudget)
+				break;
+		}
+	}
+
+	// Queue a resource to be loaded in the background.
+	// Params:
+	//   load   = Reads and decodes the resource. Must not use graphics or
+	//            any other main-thread state.
+	//   finish = Creates the resource from the loaded data. Called on the
+	//            main thread, even if loading failed. The data is deleted
+	//            once it returns.
+	void ResourceLoader::QueueLoad(const LoadFunction& load, const FinishFunction& finish)
+	{
+		LoadRequest request;
+		request.load = load;
+		request.finish = finish;
+		request.data = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			queued.push_back(request);
+		}
+
+		++pending;
+		workAvailable.notify_one();
+	}
+
+	// Wait for all queued loads and finish them, ignoring the upload budget.
+	// Useful when a level cannot start until its resources are ready.
+	void ResourceLoader::Flush()
+	{
+		// Finishing a request may queue more (e.g. a sprite source requesting its texture)
+		while (pending != 0)
+		{
+			LoadRequest request;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				workCompleted.wait(lock, [this]() { return !completed.empty(); });
+
+				request = completed.front();
+				completed.pop_front();
+			}
+
+			Finish(request);
+		}
+	}
+
+	// Returns the number of loads that have been queued but not yet finished.
+	unsigned ResourceLoader::GetPendingCount() const
+	{
+		return pending;
+	}
+
+	// Set the amount of time the main thread may spend finishing loads each frame.
+	// At least one load is always finished per frame so that loading makes progress.
+	// Params:
+	//   seconds = The time budget, in seconds.
+	void ResourceLoader::SetUploadBudget(float seconds)
+	{
+		uploadBudget = seconds;
+	}
+
+	// Returns the amount of time the main thread may spend finishing loads each frame.
+	float ResourceLoader::GetUploadBudget() const
+	{
+		return uploadBudget;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Takes requests off the queue and loads them until the loader is destroyed.
+	void ResourceLoader::WorkerLoop()
+	{
+		for (;;)
+		{
+			LoadRequest request;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				workAvailable.wait(lock, [this]() { return stopping || !queued.empty(); });
+
+				if (stopping)
+					return;
+
+				request = queued.front();
+				queued.pop_front();
+			}
+
+			request.data = request.load();
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				completed.push_back(request);
+			}
+			workCompleted.notify_one();
+		}
+	}
+
+	// Finish a single completed request on the main thread.
+	void ResourceLoader::Finish(LoadRequest& request)
+	{
+		--pending;
+		request.finish(request.data);
+		delete request.data;
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ResourceManager.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "ResourceManager.h"
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// List of all managers. Constant-initialized, so managers
+		// can safely be created by static constructors.
+		ResourceManagerBase* firstManager = nullptr;
+	}
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor
+	// Params:
+	//   relativePath = The assets subfolder where this resource type can be found.
+	//	 fileExtension = The file extension used by this resource type.
+	ResourceManagerBase::ResourceManagerBase(const std::string& relativePath, const std::string& fileExtension)
+		: relativePath(relativePath), extension(fileExtension), nextManager(firstManager), prevManager(nullptr)
+	{
+		if (firstManager != nullptr)
+			firstManager->prevManager = this;
+		firstManager = this;
+	}
+
+	// Destructor
+	ResourceManagerBase::~ResourceManagerBase()
+	{
+		if (prevManager != nullptr)
+			prevManager->nextManager = nextManager;
+		else
+			firstManager = nextManager;
+		if (nextManager != nullptr)
+			nextManager->prevManager = prevManager;
+	}
+
+	// Return the path to this resource type.
+	std::string ResourceManagerBase::GetFilePath() const
+	{
+		return EngineCore::GetInstance().GetFilePath() + relativePath;
+	}
+
+	// Return the file extension used by this resource type.
+	// Ex: .txt, .png
+	const std::string& ResourceManagerBase::GetFileExtension() const
+	{
+		return extension;
+	}
+
+	// Reload the resources loaded from a file, in every manager whose
+	// folder and extension match the file.
+	// Params:
+	//   path = The path of the file, relative to the assets folder.
+	//     Ex: Textures/Monkey.png
+	// Returns:
+	//   True if any resource was reloaded, false otherwise.
+	bool ResourceManagerBase::ReloadFile(const std::string& path)
+	{
+		bool reloaded = false;
+
+		for (ResourceManagerBase* manager = firstManager; manager != nullptr; manager = manager->nextManager)
+		{
+			const std::string& folder = manager->relativePath;
+			const std::string& fileExtension = manager->extension;
+			if (path.size() <= folder.size() + fileExtension.size()
+				|| path.compare(0, folder.size(), folder) != 0
+				|| path.compare(path.size() - fileExtension.size(), fileExtension.size(), fileExtension) != 0)
+				continue;
+
+			if (manager->Reload(manager->GetResourceName(path.substr(folder.size()))))
+				reloaded = true;
+		}
+
+		return reloaded;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Get the name of the resource loaded from a file in this manager's folder.
+	// Params:
+	//   filename = The file name, relative to this manager's folder.
+	// Returns:
+	//   The file name without its extension.
+	std::string ResourceManagerBase::GetResourceName(const std::string& filename) const
+	{
+		return filename.substr(0, filename.size() - extension.size());
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -18,6 +18,9 @@
 #include "Vector2D.h" // Vector2DScaleAdd
 #include "Transform.h" // TransformGetTranslation
 #include "GameObject.h" // GetComponent
+#include "Space.h" // GetObjectManager
+#include "GameObjectManager.h" // GetBodyStorage
+#include "BodyStorage.h" // AddBody
 
 #include "FileStream.h"
 
@@ -31,8 +34,28 @@ namespace Beta
 
 	// Dynamically allocate a new physics component.
 	RigidBody::RigidBody()
-		: Component("RigidBody"), angularVelocity(0.0), inverseMass(1.0f), transform(nullptr)
+		: Component("RigidBody"), localOldRotation(0.0f), localAngularVelocity(0.0), localInverseMass(1.0f),
+		fastMoving(false), storage(nullptr), storageSlot(0), transform(nullptr)
 	{
+		UseLocalData();
+	}
+
+	// Copy constructor - Copies the values of another rigid body into this one's own storage.
+	RigidBody::RigidBody(const RigidBody& other)
+		: Component(other), localOldTranslation(*other.oldTranslation),
+		localOldRotation(*other.oldRotation), localAcceleration(*other.acceleration),
+		localVelocity(*other.velocity), localAngularVelocity(*other.angularVelocity),
+		localInverseMass(*other.inverseMass), localForcesSum(*other.forcesSum),
+		fastMoving(other.fastMoving), storage(nullptr), storageSlot(0), transform(nullptr)
+	{
+		UseLocalData();
+	}
+
+	// Destructor - Removes this body's data from the space's body storage.
+	RigidBody::~RigidBody()
+	{
+		if (storage != nullptr)
+			storage->RemoveBody(storageSlot);
 	}
 
 	// Get the acceleration of a physics component.
@@ -40,7 +63,7 @@ namespace Beta
 	//		A pointer to the component's acceleration structure,
 	const Vector2D& RigidBody::GetAcceleration() const
 	{
-		return acceleration;
+		return *acceleration;
 	}
 
 	// Get the velocity of a physics component.
@@ -48,7 +71,7 @@ namespace Beta
 	//		A pointer to the component's velocity structure,	
 	const Vector2D& RigidBody::GetVelocity() const
 	{
-		return velocity;
+		return *velocity;
 	}
 
 	// Get the old translation (position) of a physics component.
@@ -56,7 +79,15 @@ namespace Beta
 	//		A pointer to the component's oldTranslation structure,
 	const Vector2D& RigidBody::GetOldTranslation() const
 	{
-		return oldTranslation;
+		return *oldTranslation;
+	}
+
+	// Get the rotation of a physics component before the last fixed update.
+	// Returns:
+	//   The component's old rotation, in radians.
+	float RigidBody::GetOldRotation() const
+	{
+		return *oldRotation;
 	}
 
 	// Get the angular velocity of a physics component.
@@ -64,7 +95,7 @@ namespace Beta
 	//	 A float representing the new angular velocity.
 	float RigidBody::GetAngularVelocity() const
 	{
-		return angularVelocity;
+		return *angularVelocity;
 	}
 
 	// Add a force to the object.
@@ -72,7 +103,7 @@ namespace Beta
 	//	 force = A force vector with direction and magnitude.
 	void RigidBody::AddForce(const Vector2D& force)
 	{
-		forcesSum += force;
+		*forcesSum += force;
 	}
 
 	// Set the velocity of a physics component.
@@ -81,17 +112,17 @@ namespace Beta
 	//	 velocity = Pointer to a velocity vector.
 	void RigidBody::SetVelocity(const Vector2D& velocity_)
 	{
-		velocity = velocity_;
+		*velocity = velocity_;
 	}
 
 	void RigidBody::SetVelocityX(float x)
 	{
-		velocity.x = x;
+		velocity->x = x;
 	}
 
 	void RigidBody::SetVelocityY(float y)
 	{
-		velocity.y = y;
+		velocity->y = y;
 	}
 
 	// Set the angular velocity of a physics component.
@@ -99,31 +130,76 @@ namespace Beta
 	//	 velocity = New value for the angular velocity.
 	void RigidBody::SetAngularVelocity(float velocity_)
 	{
-		angularVelocity = velocity_;
+		*angularVelocity = velocity_;
 	}
 
 	// Moves an object to the specified location, syncing
-	// its old, current, and new translations to that position.
+	// its old, current, and new translations to that position
+	// (see Transform::Teleport).
 	void RigidBody::MovePosition(const Vector2D& translation)
 	{
-		oldTranslation = translation;
-		transform->SetTranslation(translation);
+		transform->Teleport(translation);
+	}
+
+	// Flag the object as fast-moving, so that its collisions are found along
+	// its whole path during each fixed update instead of only where it ends up.
+	// Params:
+	//   fastMoving = Whether the object is fast-moving.
+	void RigidBody::SetFastMoving(bool fastMoving_)
+	{
+		fastMoving = fastMoving_;
+	}
+
+	// Is the object flagged as fast-moving?
+	bool RigidBody::IsFastMoving() const
+	{
+		return fastMoving;
 	}
 
 	void RigidBody::Initialize()
 	{
 		transform = GetOwner()->GetComponent<Transform>();
-		oldTranslation = transform->GetTranslation();
+		*oldTranslation = transform->GetTranslation();
+		*oldRotation = transform->GetRotation();
+
+		Space* space = GetOwner()->GetSpace();
+		if (storage != nullptr || space == nullptr)
+			return;
+
+		// Move data into body storage along with the transform,
+		// even if the transform has not been initialized yet
+		BodyStorage* bodyStorage = space->GetObjectManager().GetBodyStorage();
+		if (bodyStorage == nullptr)
+			return;
+
+		transform->AttachStorage(*bodyStorage);
+		storage = bodyStorage;
+
+		unsigned slot = storageSlot = transform->storageSlot;
+		storage->AddBody(slot, localVelocity, localAngularVelocity, localInverseMass);
+		storage->GetForcesSum(slot) = localForcesSum;
+
+		oldTranslation = &storage->GetOldTranslation(slot);
+		oldRotation = &storage->GetOldRotation(slot);
+		acceleration = &storage->GetAcceleration(slot);
+		velocity = &storage->GetVelocity(slot);
+		angularVelocity = &storage->GetAngularVelocity(slot);
+		inverseMass = &storage->GetInverseMass(slot);
+		forcesSum = &storage->GetForcesSum(slot);
 	}
 
 	void RigidBody::Update(float dt)
 	{
 		UNREFERENCED_PARAMETER(dt);
 
+		// Body storage does this for all bodies at once
+		if (storage != nullptr)
+			return;
+
 		// Calculate acceleration
-		acceleration = inverseMass * forcesSum;
+		*acceleration = *inverseMass * *forcesSum;
 		// Reset sum of forces
-		forcesSum = Vector2D();
+		*forcesSum = Vector2D();
 	}
 
 	// Update the state of a physics component.
@@ -131,29 +207,44 @@ namespace Beta
 	//	 dt = Change in time (in seconds) since the last game loop.
 	void RigidBody::FixedUpdate(float dt)
 	{
+		// Body storage does this for all bodies at once
+		if (storage != nullptr)
+			return;
+
 		// Calculate new velocity from old velocity and acceleration
-		velocity += acceleration * dt;
+		*velocity += *acceleration * dt;
 
-		// Save old translation
-		oldTranslation = transform->GetTranslation();
+		// Save old translation and rotation
+		*oldTranslation = transform->GetTranslation();
+		*oldRotation = transform->GetRotation();
 		// Calculate new translation from old translation and velocity
-		Vector2D endTranslation = oldTranslation + velocity * dt;
+		Vector2D endTranslation = *oldTranslation + *velocity * dt;
 		// Calculate new rotation from old rotation and angular velocity
-		float endRotation = transform->GetRotation() + angularVelocity * dt;
+		float endRotation = *oldRotation + *angularVelocity * dt;
 
 		// Publish results
 		transform->SetRotation(endRotation);
 		transform->SetTranslation(endTranslation);
 	}
 
+	// Rigid bodies only change their own object's transform, so they can
+	// be updated in parallel during both Update and FixedUpdate.
+	// Params:
+	//   phase = The part of the game loop that is being run.
+	bool RigidBody::IsThreadSafe(UpdatePhase phase) const
+	{
+		UNREFERENCED_PARAMETER(phase);
+		return true;
+	}
+
 	// Save object data to file.
 	// Params:
 	//   stream = The stream object used to save the object's data.
 	void RigidBody::Serialize(FileStream& stream) const
 	{
-		stream.WriteVariable("velocity", velocity);
-		stream.WriteVariable("angularVelocity", angularVelocity);
-		stream.WriteVariable("mass", 1.0f / inverseMass);
+		stream.WriteVariable("velocity", *velocity);
+		stream.WriteVariable("angularVelocity", *angularVelocity);
+		stream.WriteVariable("mass", 1.0f / *inverseMass);
 	}
 
 	// Load object data from file
@@ -161,11 +252,27 @@ namespace Beta
 	//   stream = The stream object used to load the object's data.
 	void RigidBody::Deserialize(FileStream & stream)
 	{
-		stream.ReadVariable("velocity", velocity);
-		stream.ReadVariable("angularVelocity", angularVelocity);
+		stream.ReadVariable("velocity", *velocity);
+		stream.ReadVariable("angularVelocity", *angularVelocity);
 		float mass;
 		stream.ReadVariable("mass", mass);
-		inverseMass = 1.0f / mass;
+		*inverseMass = 1.0f / mass;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Point the data pointers at this body's own variables.
+	void RigidBody::UseLocalData()
+	{
+		oldTranslation = &localOldTranslation;
+		oldRotation = &localOldRotation;
+		acceleration = &localAcceleration;
+		velocity = &localVelocity;
+		angularVelocity = &localAngularVelocity;
+		inverseMass = &localInverseMass;
+		forcesSum = &localForcesSum;
 	}
 
 	// RTTI
@@ -19,6 +19,7 @@
 #include <fmod_studio.hpp>
 #include <fmod.hpp>
 #include <sstream>
+#include <unordered_map>	// Sounds by name
 
 #include "EngineCore.h"	// EngineGetModule
 #include "SoundEvent.h"	// SoundEvent
@@ -40,6 +41,15 @@ namespace Beta
 	// All events start with "event:/"
 	static const std::string eventPrefix = "event:/";
 
+	// Number of channels mixed by FMOD, which is also the default voice limit
+	static const unsigned maxChannels = 64;
+
+	// Priority of sounds that have not been given one (same as FMOD's default)
+	static const int defaultPriority = 128;
+
+	// Index of handles that do not refer to a sound
+	static const unsigned noSlot = static_cast<unsigned>(-1);
+
 	//------------------------------------------------------------------------------
 	// Private Function Declarations:
 	//------------------------------------------------------------------------------
@@ -71,13 +81,19 @@ namespace Beta
 		//------------------------------------------------------------------------------
 
 		// Constructor/Destructor
-		Implementation()
-			: effectsVolume(1.0f), musicVolume(1.0f), system(nullptr), musicChannel(nullptr), audioFilePath("Audio/")
+		Implementation(bool noSound)
+			: maxVoices(maxChannels), musicChannel(nullptr), system(nullptr), musicVolume(1.0f), effectsVolume(1.0f),
+			audioFilePath("Audio/")
 		{
 			FMOD_Assert(FMOD::Debug_Initialize(FMOD_DEBUG_LEVEL_ERROR)); // Only show errors in log
 			FMOD_Assert(FMOD::Studio::System::create(&studioSystem)); // Create the main system object.
-			FMOD_Assert(studioSystem->initialize(64, FMOD_STUDIO_INIT_NORMAL, FMOD_INIT_NORMAL, 0));
 			FMOD_Assert(studioSystem->getLowLevelSystem(&system));
+
+			// Output must be chosen before initializing
+			if (noSound)
+				FMOD_Assert(system->setOutput(FMOD_OUTPUTTYPE_NOSOUND));
+
+			FMOD_Assert(studioSystem->initialize(maxChannels, FMOD_STUDIO_INIT_NORMAL, FMOD_INIT_NORMAL, 0));
 			FMOD_Assert(system->createChannelGroup("SoundEffects", &effectsChannelGroup));
 		}
 
@@ -86,10 +102,126 @@ namespace Beta
 			FMOD_Assert(studioSystem->release());
 		}
 
-		// Play a sound effect
-		void PlayEffect(FMOD::Sound* sound) const
+		// Play a sound effect, stopping another one if there are no voices left
+		void PlayEffect(unsigned slot)
+		{
+			SoundSlot& data = sounds[slot];
+
+			// Voices may have finished since the last update
+			if ((data.maxVoices != 0 && data.activeVoices >= data.maxVoices)
+				|| (maxVoices != 0 && voices.Size() >= maxVoices))
+				RemoveFinishedVoices();
+
+			// Too many copies of this sound - replace the oldest
+			if (data.maxVoices != 0 && data.activeVoices >= data.maxVoices)
+			{
+				for (unsigned i = 0; i < voices.Size(); ++i)
+				{
+					if (voices[i].slot == slot)
+					{
+						StopVoice(i);
+						++stats.voicesStolen;
+						break;
+					}
+				}
+			}
+
+			// Too many sounds - replace the least important, oldest first
+			if (maxVoices != 0 && voices.Size() >= maxVoices)
+			{
+				unsigned victim = 0;
+				for (unsigned i = 1; i < voices.Size(); ++i)
+				{
+					if (voices[i].priority > voices[victim].priority)
+						victim = i;
+				}
+
+				if (voices[victim].priority < data.priority)
+				{
+					++stats.playsRejected;
+					return;
+				}
+
+				StopVoice(victim);
+				++stats.voicesStolen;
+			}
+
+			// Start paused so the priority is set before the sound is heard
+			FMOD::Channel* channel = nullptr;
+			FMOD_Assert(system->playSound(data.sound, effectsChannelGroup, true, &channel));
+			if (channel == nullptr)
+				return;
+
+			FMOD_Assert(channel->setPriority(data.priority));
+			FMOD_Assert(channel->setPaused(false));
+
+			Voice voice;
+			voice.channel = channel;
+			voice.slot = slot;
+			voice.priority = data.priority;
+			voices.PushBack(voice);
+			++data.activeVoices;
+
+			++stats.plays;
+			stats.activeVoices = static_cast<unsigned>(voices.Size());
+			stats.peakVoices = std::max(stats.peakVoices, stats.activeVoices);
+		}
+
+		// Stop a playing sound effect and forget its voice.
+		void StopVoice(unsigned index)
 		{
-			FMOD_Assert(system->playSound(sound, effectsChannelGroup, false, nullptr));
+			// The channel may have already ended, which makes its handle invalid
+			voices[index].channel->stop();
+			--sounds[voices[index].slot].activeVoices;
+			voices.Erase(voices.Begin() + index);
+			stats.activeVoices = static_cast<unsigned>(voices.Size());
+		}
+
+		// Forget the voices of sound effects that have ended, keeping the rest in order.
+		void RemoveFinishedVoices()
+		{
+			unsigned kept = 0;
+			for (unsigned i = 0; i < voices.Size(); ++i)
+			{
+				// Ended channels report errors rather than that they are not playing
+				bool isPlaying = false;
+				if (voices[i].channel->isPlaying(&isPlaying) == FMOD_OK && isPlaying)
+					voices[kept++] = voices[i];
+				else
+					--sounds[voices[i].slot].activeVoices;
+			}
+
+			voices.Resize(kept);
+			stats.activeVoices = kept;
+		}
+
+		// Returns the slot of a handle's sound, or noSlot if the sound was removed.
+		unsigned GetSlot(SoundHandle handle) const
+		{
+			if (handle.index >= sounds.Size() || sounds[handle.index].generation != handle.generation
+				|| sounds[handle.index].sound == nullptr)
+				return noSlot;
+
+			return handle.index;
+		}
+
+		// Release a sound and free its slot.
+		void ReleaseSound(unsigned slot)
+		{
+			// Stop copies of this sound that are still playing
+			for (unsigned i = static_cast<unsigned>(voices.Size()); i > 0; --i)
+			{
+				if (voices[i - 1].slot == slot)
+					StopVoice(i - 1);
+			}
+
+			SoundSlot& data = sounds[slot];
+			soundIndices.erase(data.name);
+			data.sound->release();
+			data.sound = nullptr;
+			data.name.clear();
+			++data.generation;
+			freeSounds.PushBack(slot);
 		}
 
 		// Play background music
@@ -106,34 +238,84 @@ namespace Beta
 		{
 			const std::string& enginePath = EngineCore::GetInstance().GetFilePath();
 			std::string fullPath = enginePath + audioFilePath + filename;
-			int fullPathSize = static_cast<int>(fullPath.size());
 
-			// Make sure we haven't already added this by checking the name of the sound against sounds in our list.
-			char* nameBuffer = new char[fullPath.size()];
-			bool found = false;
-			for (auto it = soundList.Begin(); it != soundList.End(); ++it)
-			{
-				(*it)->getName(nameBuffer, fullPathSize);
-				if (strcmp(nameBuffer, fullPath.c_str()) == 0)
-				{
-					found = true;
-					break;
-				}
-			}
-			delete[] nameBuffer;
-			if (found) return;
+			// Make sure we haven't already added this
+			if (soundIndices.find(filename) != soundIndices.end())
+				return;
 
 			// Okay to add one object
-			FMOD::Sound* sound;
+			FMOD::Sound* sound = nullptr;
 			FMOD_Assert(system->createSound(fullPath.c_str(), mode, nullptr, &sound));
-			soundList.PushBack(sound);
+			if (sound == nullptr)
+				return;
+
+			// Reuse the slot of a removed sound if possible
+			unsigned slot;
+			if (!freeSounds.IsEmpty())
+			{
+				slot = freeSounds.Back();
+				freeSounds.PopBack();
+			}
+			else
+			{
+				slot = static_cast<unsigned>(sounds.Size());
+				sounds.PushBack(SoundSlot());
+			}
+
+			// Streams are played as music, so remember which sounds are streams
+			FMOD_MODE soundMode;
+			FMOD_Assert(sound->getMode(&soundMode));
+
+			SoundSlot& data = sounds[slot];
+			data.sound = sound;
+			data.name = filename;
+			data.isStream = (soundMode & FMOD_CREATESTREAM) != 0;
+			data.maxVoices = 0;
+			data.activeVoices = 0;
+			data.priority = defaultPriority;
+			soundIndices[filename] = slot;
 		}
 
+		//------------------------------------------------------------------------------
+		// Public Structures:
+		//------------------------------------------------------------------------------
+
+		// A loaded sound and the limits on playing it
+		struct SoundSlot
+		{
+			SoundSlot()
+				: sound(nullptr), isStream(false), generation(0), maxVoices(0), activeVoices(0),
+				priority(defaultPriority)
+			{
+			}
+
+			FMOD::Sound* sound;		// Null if the slot is unused
+			std::string name;		// Name used to add the sound
+			bool isStream;
+			unsigned generation;	// Incremented each time the slot is reused
+			unsigned maxVoices;		// Copies that can play at once, or 0 for no limit
+			unsigned activeVoices;	// Copies that are playing
+			int priority;			// 0 (most important) to 256 (least important)
+		};
+
+		// A sound effect that is playing
+		struct Voice
+		{
+			FMOD::Channel* channel;
+			unsigned slot;
+			int priority;
+		};
+
 		//------------------------------------------------------------------------------
 		// Public Variables:
 		//------------------------------------------------------------------------------
 
-		Array<FMOD::Sound*> soundList;			// List of all loaded sounds
+		Array<SoundSlot> sounds;				// All loaded sounds, indexed by handle
+		Array<unsigned> freeSounds;				// Unused entries in sounds
+		std::unordered_map<std::string, unsigned> soundIndices; // Slots of sounds by name
+		Array<Voice> voices;					// Sound effects that are playing, oldest first
+		unsigned maxVoices;						// Sound effects that can play at once, or 0 for no limit
+		SoundStats stats;
 		Array<FMOD::Studio::Bank*> bankList;	// List of all loaded sound banks.
 		FMOD::Channel* musicChannel;			 // The channel most recently used to play music
 		FMOD::ChannelGroup* effectsChannelGroup; // The channel group used for SFX.
@@ -145,13 +327,37 @@ namespace Beta
 		std::string audioFilePath;
 	};
 
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Creates a handle that does not refer to any sound.
+	SoundHandle::SoundHandle()
+		: index(noSlot), generation(0)
+	{
+	}
+
+	// Returns whether the handle was given to a sound.
+	bool SoundHandle::IsValid() const
+	{
+		return index != noSlot;
+	}
+
+	SoundStats::SoundStats()
+		: activeVoices(0), peakVoices(0), plays(0), voicesStolen(0), playsRejected(0)
+	{
+	}
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
 
 	// Constructor - initializes FMOD.
-	SoundManager::SoundManager()
-		: BetaObject("Module:SoundManager"), pimpl(new Implementation())
+	// Params:
+	//   noSound = Whether to mix sounds without sending them to an audio device,
+	//     e.g. for headless runs and tests.
+	SoundManager::SoundManager(bool noSound)
+		: BetaObject("Module:SoundManager"), pimpl(new Implementation(noSound))
 	{
 	}
 
@@ -168,17 +374,20 @@ namespace Beta
 	{
 		UNREFERENCED_PARAMETER(dt);
 		FMOD_Assert(pimpl->studioSystem->update());
+
+		// Keep the count of active voices current
+		pimpl->RemoveFinishedVoices();
 	}
 
 	// Shutdown the sound manager.
 	void SoundManager::Shutdown(void)
 	{
-		size_t numSounds = pimpl->soundList.Size();
+		size_t numSounds = pimpl->sounds.Size();
 		for (size_t i = 0; i < numSounds; ++i)
 		{
-			pimpl->soundList[i]->release();
+			if (pimpl->sounds[i].sound != nullptr)
+				pimpl->ReleaseSound(static_cast<unsigned>(i));
 		}
-		pimpl->soundList.Clear();
 
 		size_t numBanks = pimpl->bankList.Size();
 		for (size_t i = 0; i < numBanks; ++i)
@@ -264,27 +473,9 @@ namespace Beta
 	// Unloads a sound file from memory.
 	void SoundManager::RemoveSound(const std::string & filename)
 	{
-		std::string fullPath = pimpl->audioFilePath + filename;
-		char* nameBuffer = new char[fullPath.size()];
-
-		// For each sound object
-		for (auto it = pimpl->soundList.Begin(); it != pimpl->soundList.End(); )
-		{
-			// If its name matches the one we're looking for
-			(*it)->getName(nameBuffer, (int)fullPath.size());
-			if (strcmp(nameBuffer, fullPath.c_str()) == 0)
-			{
-				// Release it
-				(*it)->release();
-				it = pimpl->soundList.Erase(it);
-				break;
-			}
-			else
-			{
-				++it;
-			}
-		}
-		delete[] nameBuffer;
+		auto location = pimpl->soundIndices.find(filename);
+		if (location != pimpl->soundIndices.end())
+			pimpl->ReleaseSound(location->second);
 	}
 
 	// Plays a sound with the specified name.
@@ -292,24 +483,87 @@ namespace Beta
 	//	 name = The name of the sound to be played.
 	void SoundManager::PlaySound(const std::string & soundName)
 	{
-		char soundString[maxNameLength];
-		FMOD_MODE mode;
+		PlaySound(GetSound(soundName));
+	}
 
-		size_t numSounds = pimpl->soundList.Size();
-		for (size_t i = 0; i < numSounds; ++i)
-		{
-			FMOD_Assert(pimpl->soundList[i]->getName(soundString, maxNameLength));
+	// Plays a sound without looking up its name.
+	// Params:
+	//	 sound = The handle returned by GetSound.
+	void SoundManager::PlaySound(SoundHandle sound)
+	{
+		unsigned slot = pimpl->GetSlot(sound);
+		if (slot == noSlot)
+			return;
 
-			if (strcmp(soundName.c_str(), soundString) == 0)
-			{
-				// If the sound is a stream, record the channel being used for future use
-				FMOD_Assert(pimpl->soundList[i]->getMode(&mode));
-				if (mode & FMOD_CREATESTREAM)
-					pimpl->PlayMusic(pimpl->soundList[i]);
-				else
-					pimpl->PlayEffect(pimpl->soundList[i]);
-			}
+		// If the sound is a stream, record the channel being used for future use
+		if (pimpl->sounds[slot].isStream)
+			pimpl->PlayMusic(pimpl->sounds[slot].sound);
+		else
+			pimpl->PlayEffect(slot);
+	}
+
+	// Finds a loaded sound, so that it can be played often without looking up its name.
+	// Params:
+	//	 name = The name of the sound.
+	// Returns:
+	//   A handle to the sound, or an invalid handle if no sound has that name.
+	SoundHandle SoundManager::GetSound(const std::string& name) const
+	{
+		SoundHandle handle;
+
+		auto location = pimpl->soundIndices.find(name);
+		if (location != pimpl->soundIndices.end())
+		{
+			handle.index = location->second;
+			handle.generation = pimpl->sounds[location->second].generation;
 		}
+
+		return handle;
+	}
+
+	// Set the number of copies of a sound effect that can play at the same time.
+	// When the limit is reached, the oldest copy is stopped to play a new one.
+	// Params:
+	//	 sound = The handle returned by GetSound.
+	//   maxVoices = The number of copies, or 0 for no limit.
+	void SoundManager::SetVoiceLimit(SoundHandle sound, unsigned maxVoices)
+	{
+		unsigned slot = pimpl->GetSlot(sound);
+		if (slot != noSlot)
+			pimpl->sounds[slot].maxVoices = maxVoices;
+	}
+
+	// Set how important a sound effect is when all voices are in use.
+	// Params:
+	//	 sound = The handle returned by GetSound.
+	//   priority = From 0 (most important) to 256 (least important). Defaults to 128.
+	void SoundManager::SetPriority(SoundHandle sound, int priority)
+	{
+		unsigned slot = pimpl->GetSlot(sound);
+		if (slot != noSlot)
+			pimpl->sounds[slot].priority = std::min(std::max(priority, 0), 256);
+	}
+
+	// Set the number of sound effects that can play at the same time. When
+	// the limit is reached, the least important and then oldest sound is
+	// stopped, unless the new sound is less important than all of them.
+	// Params:
+	//   maxVoices = The number of sound effects, or 0 for no limit. Defaults to 64.
+	void SoundManager::SetMaxVoices(unsigned maxVoices)
+	{
+		pimpl->maxVoices = maxVoices;
+	}
+
+	// Returns the number of sound effects that can play at the same time.
+	unsigned SoundManager::GetMaxVoices() const
+	{
+		return pimpl->maxVoices;
+	}
+
+	// Returns counters describing the sound effects that have been played.
+	const SoundStats& SoundManager::GetStats() const
+	{
+		return pimpl->stats;
 	}
 
 	// Starts an audio event with the given name.
@@ -153,6 +153,20 @@ namespace Beta
 		return *camera;
 	}
 
+	// Set the time between physics updates for objects in this space.
+	// Params:
+	//   dt = The fixed timestep, in seconds.
+	void Space::SetFixedTimeStep(float dt)
+	{
+		objectManager.SetFixedTimeStep(dt);
+	}
+
+	// Returns the time between physics updates for objects in this space.
+	float Space::GetFixedTimeStep() const
+	{
+		return objectManager.GetFixedTimeStep();
+	}
+
 	// Game State Update
 	void Space::ChangeLevel()
 	{
@@ -20,11 +20,10 @@
 #include "SpriteSource.h"
 #include "Camera.h"			// GetViewMatrix
 #include "Mesh.h"			// Draw
-#include <ShaderProgram.h>	// Use
 
 // Components
 #include "GameObject.h" // GetComponent
-#include "Transform.h"	// GetMatrix, GetTranslation
+#include "Transform.h"	// GetDrawMatrix, GetTranslation
 
 // Math
 #include "Matrix2D.h"
@@ -117,25 +116,19 @@ namespace Beta
 		if (transform == nullptr) return;
 
 		GraphicsEngine & graphics = *EngineGetModule(GraphicsEngine);
-		graphics.GetSpriteShader().Use();
 
+		// Find texture and frame coordinates
+		Vector2D uvOffset;
+		Vector2D uvStride(1.0f, 1.0f);
+		const Texture* texture = &graphics.GetDefaultTexture();
 		if (spriteSource)
 		{
-			spriteSource->UseTexture(frameIndex, flipX, flipY);
-		}
-		else
-		{
-			graphics.GetDefaultTexture().Use();
+			texture = &spriteSource->GetFrameTexture(frameIndex, uvOffset, uvStride);
 		}
 
-		// Set blend color
-		graphics.SetSpriteBlendColor(color);
-
-		// Set transform using given translation
-		graphics.SetTransform(Matrix2D::TranslationMatrix(offset.x, offset.y) * transform->GetMatrix(), zDepth);
-
-		// Draw!
-		mesh->Draw();
+		// Queue for batched drawing using given translation
+		graphics.DrawSprite(*mesh, *texture, Matrix2D::TranslationMatrix(offset.x, offset.y) * transform->GetDrawMatrix(),
+			zDepth, color, uvOffset, uvStride, flipX, flipY);
 	}
 
 	// Set a sprite's transparency (between 0.0f and 1.0f).
@@ -223,6 +216,16 @@ namespace Beta
 		flipY = flipY_;
 	}
 
+	bool Sprite::GetFlipX() const
+	{
+		return flipX;
+	}
+
+	bool Sprite::GetFlipY() const
+	{
+		return flipY;
+	}
+
 
 	// Save object data to file.
 	// Params:
@@ -18,10 +18,13 @@
 
 // Resources
 #include <Texture.h>
+#include <TextureAtlas.h>	// Add, GetStats
 
 // Systems
 #include <EngineCore.h>	// GetFilePath
 #include <FileStream.h>
+#include <GraphicsEngine.h>	// GetSpriteBatchStats
+#include <SpriteBatch.h>	// SpriteBatchStats
 
 // Math
 #include <Vector2D.h> // SetX and SetY
@@ -30,6 +33,43 @@
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Private Structures:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Sprite source read from a file on a worker thread
+		struct SpriteSourceData : public ResourceData
+		{
+			SpriteSource spriteSource;
+
+			// Texture decoded for the atlas, if it is enabled
+			TextureImage image;
+		};
+
+		// Image decoded on a worker thread
+		struct TextureData : public ResourceData
+		{
+			TextureImage image;
+		};
+
+		// Returns a 1x1 white texture shared by all placeholder sprite sources.
+		ConstTexturePtr GetPlaceholderTexture()
+		{
+			static std::weak_ptr<const Texture> placeholder;
+
+			ConstTexturePtr texture = placeholder.lock();
+			if (texture == nullptr)
+			{
+				texture = std::make_shared<Texture>();
+				placeholder = texture;
+			}
+
+			return texture;
+		}
+	}
+
 	SpriteSourceManager SpriteSource::spriteSourceManager;
 	TextureManager SpriteSource::textureManager;
 
@@ -38,8 +78,56 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	SpriteSourceManager::SpriteSourceManager()
-		: ResourceManager("SpriteSources/")
+		: ResourceManager("SpriteSources/"), atlas(nullptr), atlasEnabled(false)
+	{
+	}
+
+	SpriteSourceManager::~SpriteSourceManager()
+	{
+		// Sprite sources keep their atlas pages alive
+		delete atlas;
+	}
+
+	// Pack the textures of sprite sources loaded from now on into shared atlas
+	// pages, so that sprites using different sprite sources can be drawn without
+	// switching textures. Sprite sources that were already loaded are unchanged,
+	// and textures too large for a page keep their own texture.
+	// Params:
+	//   enabled = Whether to use the atlas.
+	//   pageSize = The width and height of each atlas page, in pixels. Only
+	//     used the first time the atlas is enabled.
+	void SpriteSourceManager::SetAtlasEnabled(bool enabled, unsigned pageSize)
+	{
+		if (enabled && atlas == nullptr)
+			atlas = new TextureAtlas(pageSize);
+
+		atlasEnabled = enabled;
+	}
+
+	// Returns how well textures have been packed into the atlas.
+	AtlasStats SpriteSourceManager::GetAtlasStats() const
+	{
+		if (atlas == nullptr)
+			return AtlasStats();
+
+		return atlas->GetStats();
+	}
+
+	// Print the atlas's packing efficiency, along with the number of texture
+	// binds and draw calls made by the sprite batch during the last frame.
+	void SpriteSourceManager::PrintAtlasReport() const
 	{
+		AtlasStats atlasStats = GetAtlasStats();
+		std::cout << "Texture atlas: " << atlasStats.images << " textures in " << atlasStats.pages << " pages, "
+			<< static_cast<int>(atlasStats.efficiency * 100.0f + 0.5f) << "% of page area used." << std::endl;
+
+		GraphicsEngine* graphics = EngineGetModule(GraphicsEngine);
+		if (graphics == nullptr)
+			return;
+
+		const SpriteBatchStats& batchStats = graphics->GetSpriteBatchStats();
+		std::cout << "Last frame: " << batchStats.sprites << " sprites, " << batchStats.textureBinds
+			<< " texture binds, " << batchStats.drawCalls << " draw calls." << std::endl;
 	}
 
 	SpriteSourcePtr SpriteSourceManager::Create(const std::string& name)
@@ -56,8 +144,11 @@ namespace Beta
 
 			// Set the sprite source's texture
 			// Get texture if it exists, otherwise create it
-			TexturePtr texture = SpriteSource::textureManager.GetResource(spriteSource->textureName);
-			spriteSource->texture = texture;
+			if (!UseAtlas(*spriteSource, nullptr))
+			{
+				TexturePtr texture = SpriteSource::textureManager.GetResource(spriteSource->textureName);
+				spriteSource->texture = texture;
+			}
 		}
 		catch (const FileStreamException & e)
 		{
@@ -69,6 +160,92 @@ namespace Beta
 		return spriteSource;
 	}
 
+	SpriteSourcePtr SpriteSourceManager::CreatePlaceholder(const std::string& name)
+	{
+		return std::make_shared<SpriteSource>(GetPlaceholderTexture(), name);
+	}
+
+	ResourceData* SpriteSourceManager::LoadData(const std::string& name)
+	{
+		SpriteSourceData* data = new SpriteSourceData();
+
+		std::string filename = GetFilePath() + name + GetFileExtension();
+		try
+		{
+			FileStream stream(filename, OM_Read);
+			data->spriteSource.Deserialize(stream);
+
+			// Decode the texture here too, since atlas pages can only be filled in on the main thread
+			if (atlasEnabled)
+				Texture::LoadImageFromFile(data->spriteSource.textureName, data->image);
+		}
+		catch (const FileStreamException & e)
+		{
+			std::cout << "ERROR in SpriteSourceManager: " << e.what() << std::endl;
+			delete data;
+			data = nullptr;
+		}
+
+		return data;
+	}
+
+	bool SpriteSourceManager::CanReload() const
+	{
+		return true;
+	}
+
+	void SpriteSourceManager::FinishLoad(SpriteSource& placeholder, ResourceData* data)
+	{
+		// Keep the placeholder if the file could not be read
+		if (data == nullptr)
+			return;
+
+		SpriteSourceData& loaded = *static_cast<SpriteSourceData*>(data);
+		placeholder.name = loaded.spriteSource.name;
+		placeholder.numRows = loaded.spriteSource.numRows;
+		placeholder.numCols = loaded.spriteSource.numCols;
+		placeholder.textureName = loaded.spriteSource.textureName;
+
+		if (loaded.image.pixels != nullptr && UseAtlas(placeholder, &loaded.image))
+			return;
+
+		// Sprites draw the texture's white placeholder until its image is uploaded
+		placeholder.texture = SpriteSource::textureManager.RequestResource(loaded.spriteSource.textureName);
+	}
+
+	// Try to place a sprite source's texture in the atlas.
+	// Params:
+	//   spriteSource = The sprite source that will use the atlas.
+	//   image = The decoded texture, or nullptr to load it now.
+	// Returns:
+	//   True if the sprite source now uses the atlas, false otherwise.
+	bool SpriteSourceManager::UseAtlas(SpriteSource& spriteSource, const TextureImage* image)
+	{
+		if (!atlasEnabled)
+			return false;
+
+		AtlasRegion region;
+		if (!atlas->Find(spriteSource.textureName, region))
+		{
+			TextureImage loadedImage;
+			if (image == nullptr)
+			{
+				if (!Texture::LoadImageFromFile(spriteSource.textureName, loadedImage))
+					return false;
+				image = &loadedImage;
+			}
+
+			// Too large for a page, so use a separate texture
+			if (!atlas->Add(spriteSource.textureName, *image, region))
+				return false;
+		}
+
+		spriteSource.texture = region.page;
+		spriteSource.uvOrigin = region.uvOffset;
+		spriteSource.uvSize = region.uvSize;
+		return true;
+	}
+
 	TextureManager::TextureManager()
 		: ResourceManager("Textures/", ".png")
 	{
@@ -79,6 +256,45 @@ namespace Beta
 		return TexturePtr(Texture::CreateTextureFromFile(name));
 	}
 
+	TexturePtr TextureManager::CreatePlaceholder(const std::string& name)
+	{
+		Array<Color> white(1);
+		white[0] = Colors::White;
+		return std::make_shared<Texture>(white, 1, 1, name);
+	}
+
+	ResourceData* TextureManager::LoadData(const std::string& name)
+	{
+		TextureData* data = new TextureData();
+		if (!Texture::LoadImageFromFile(name, data->image))
+		{
+			delete data;
+			data = nullptr;
+		}
+
+		return data;
+	}
+
+	bool TextureManager::CanReload() const
+	{
+		return true;
+	}
+
+	void TextureManager::FinishLoad(Texture& placeholder, ResourceData* data)
+	{
+		// Keep the placeholder if the image could not be decoded
+		if (data == nullptr)
+			return;
+
+		placeholder.SetImage(static_cast<TextureData*>(data)->image);
+	}
+
+	// Textures are named by their file name, including the extension.
+	std::string TextureManager::GetResourceName(const std::string& filename) const
+	{
+		return filename;
+	}
+
 	// Constructor for SpriteSource
 	// Params:
 	//   texture = The texture that contains the frames that this sprite source will use.
@@ -87,7 +303,7 @@ namespace Beta
 	//	 numRows = The number of total rows in the sprite sheet texture.
 	SpriteSource::SpriteSource(ConstTexturePtr texture, std::string _name,
 		unsigned numCols, unsigned numRows)
-		: numCols(numCols), numRows(numRows), texture(texture), name(_name)
+		: numCols(numCols), numRows(numRows), texture(texture), uvSize(1.0f, 1.0f), name(_name)
 	{
 		// If name is empty, use name of texture without file extension
 		if (name == "" && texture != nullptr)
@@ -106,7 +322,22 @@ namespace Beta
 	void SpriteSource::UseTexture(unsigned frameIndex, bool flipX, bool flipY) const
 	{
 		Vector2D uvOffset = GetUV(frameIndex);
-		texture->Use(numCols, numRows, flipX, flipY, uvOffset);
+		Vector2D uvStride(uvSize.x / numCols, uvSize.y / numRows);
+		texture->Use(uvOffset, uvStride, flipX, flipY);
+	}
+
+	// Retrieves the texture and texture coordinates needed to draw the given frame.
+	// Params:
+	//   frameIndex = The index of the frame of the texture that we want to use.
+	//   uvOffset   = (Out) The texture coordinate offset of the frame.
+	//   uvStride   = (Out) The size of a single frame in texture coordinates.
+	// Returns:
+	//   The texture that contains the frame.
+	const Texture& SpriteSource::GetFrameTexture(unsigned frameIndex, Vector2D& uvOffset, Vector2D& uvStride) const
+	{
+		uvOffset = GetUV(frameIndex);
+		uvStride = Vector2D(uvSize.x / numCols, uvSize.y / numRows);
+		return *texture;
 	}
 
 	// Returns the maximum number of possible frames in the sprite source's texture (rows * cols).
@@ -122,13 +353,13 @@ namespace Beta
 	//   A vector containing the UV/texture coordinates.
 	const Vector2D SpriteSource::GetUV(unsigned int frameIndex) const
 	{
-		Vector2D textureCoords;
+		Vector2D textureCoords = uvOrigin;
 
-		float uSize = 1.0f / numCols;
-		float vSize = 1.0f / numRows;
+		float uSize = uvSize.x / numCols;
+		float vSize = uvSize.y / numRows;
 
-		textureCoords.x = uSize * (frameIndex % numCols);
-		textureCoords.y = vSize * (frameIndex / numCols);
+		textureCoords.x += uSize * (frameIndex % numCols);
+		textureCoords.y += vSize * (frameIndex / numCols);
 
 		return textureCoords;
 	}
@@ -156,8 +387,8 @@ namespace Beta
 		stream.WriteVariable("numRows", numRows);
 		stream.WriteVariable("numCols", numCols);
 
-		// Extract the filename from the relative path
-		std::string filename = texture->GetName();
+		// Extract the filename from the relative path (atlas pages have their own names)
+		std::string filename = textureName.empty() ? texture->GetName() : textureName;
 		size_t lastSlash = filename.find_last_of('/');
 		if (lastSlash != std::string::npos)
 			filename = filename.substr(lastSlash + 1);
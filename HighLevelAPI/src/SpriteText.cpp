@@ -226,13 +226,16 @@ namespace Beta
 		GraphicsEngine & graphics = *EngineGetModule(GraphicsEngine);
 		graphics.SetSpriteBlendColor(GetColor());
 
+		// Interpolated between fixed updates if the object has a rigid body
+		Vector2D drawTranslation = transform->GetDrawTranslation();
+
 		for (size_t i = 0; i < length; ++i)
 		{
 			// New lines and spaces
 			if (text[i] == '\n' || (text[i] == ' ' && column >= rowLength))
 			{
 				// Set transform
-				graphics.SetTransform(offset + transform->GetTranslation(),
+				graphics.SetTransform(offset + drawTranslation,
 					transform->GetScale(), 0.0f, GetZDepth());
 
 				// Draw at the specified offset
@@ -258,7 +261,7 @@ namespace Beta
 		if (!lastText.empty())
 		{
 			// Set transform
-			graphics.SetTransform(offset + transform->GetTranslation(),
+			graphics.SetTransform(offset + drawTranslation,
 				transform->GetScale(), 0.0f, GetZDepth());
 
 			// Draw at the specified offset
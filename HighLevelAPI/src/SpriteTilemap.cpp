@@ -17,17 +17,26 @@
 #include "SpriteTilemap.h"
 
 // Components
-#include "Transform.h"	// GetMatrix
+#include "Transform.h"	// GetDrawMatrix
 #include "GameObject.h"	// GetComponent
 #include "Area.h"		// SetSize, SetOffset
 
 // Systems
 #include <EngineCore.h>	// EngineGetModule
 #include <FileStream.h> // Read/Write Variable
-#include <Space.h>	// GetResourceManager
+#include <Space.h>	// GetResourceManager, GetCamera
+#include <GraphicsEngine.h>	// DrawSprite, GetDefaultTexture
+#include <MeshFactory.h>	// AddVertex, EndCreate
+#include <Camera.h>		// GetScreenWorldDimensions
 
 // Resources
 #include "Tilemap.h"	// GetWidth, GetHeight, GetCellValue
+#include "SpriteSource.h"	// GetFrameTexture
+#include <Vertex.h>
+
+// Math
+#include <Matrix2D.h>
+#include <Shapes2D.h>	// BoundingRectangle
 
 //------------------------------------------------------------------------------
 
@@ -37,9 +46,15 @@ namespace Beta
 	// Public Functions:
 	//------------------------------------------------------------------------------
 
+	SpriteTilemapStats::SpriteTilemapStats()
+		: chunksVisible(0), chunksRebuilt(0), tiles(0), drawCalls(0)
+	{
+	}
+
 	// Create a new sprite object.
 	SpriteTilemap::SpriteTilemap()
-		: map(nullptr)
+		: map(nullptr), chunkCountX(0), chunkCountY(0), builtMap(nullptr), builtRevision(0),
+		builtSpriteSource(nullptr), builtFlipX(false), builtFlipY(false)
 	{
 		SetName("SpriteTilemap");
 	}
@@ -71,42 +86,91 @@ namespace Beta
 		area->SetZDepth(GetZDepth());
 	}
 
-	// Draw a sprite (Sprite can be textured or untextured).
+	// Draw the chunks of the tilemap that are on screen.
 	void SpriteTilemap::Draw()
 	{
-		if (map == nullptr)
+		stats = SpriteTilemapStats();
+
+		if (map == nullptr || transform == nullptr || map->GetWidth() == 0 || map->GetHeight() == 0)
 			return;
 
-		// Set up variables
-		int minX = map->GetMinIndexX();
-		int maxX = map->GetMaxIndexX();
-		int minY = map->GetMinIndexY();
-		int maxY = map->GetMaxIndexY();
-		Vector2D offset;
-		int cellValue = 0;
-		const Vector2D & tileSize = transform->GetScale();
+		// Throw away cached meshes if anything that affects every tile has changed
+		if (map.get() != builtMap || map->GetRevision() != builtRevision || GetSpriteSource() != builtSpriteSource
+			|| GetFlipX() != builtFlipX || GetFlipY() != builtFlipY)
+		{
+			ResetChunks();
+		}
 
-		// Loop through cells in map
-		for (int r = minY; r < maxY; ++r)
+		// Find the part of the map that is on screen by moving the corners
+		// of the screen into the tilemap's local space, where tiles are 1x1
+		const BoundingRectangle screen = GetOwner()->GetSpace()->GetCamera().GetScreenWorldDimensions();
+		const Matrix2D& inverse = transform->GetInverseMatrix();
+		Vector2D corners[4] =
 		{
-			for (int c = minX; c < maxX; ++c)
-			{
-				// Set frame index based on cell data
-				cellValue = map->GetCellValue(c, r);
+			inverse * Vector2D(screen.left, screen.bottom),
+			inverse * Vector2D(screen.right, screen.bottom),
+			inverse * Vector2D(screen.left, screen.top),
+			inverse * Vector2D(screen.right, screen.top),
+		};
 
-				// Skip empty cells
-				if (cellValue < 1)
-					continue;
+		Vector2D localMin = corners[0];
+		Vector2D localMax = corners[0];
+		for (unsigned i = 1; i < 4; ++i)
+		{
+			localMin.x = std::min(localMin.x, corners[i].x);
+			localMin.y = std::min(localMin.y, corners[i].y);
+			localMax.x = std::max(localMax.x, corners[i].x);
+			localMax.y = std::max(localMax.y, corners[i].y);
+		}
+
+		// Tile (c, r) is centered at (c, -r), so convert to cells relative to the map's minimum indices
+		int firstColumn = static_cast<int>(floor(localMin.x + 0.5f)) - map->GetMinIndexX();
+		int lastColumn = static_cast<int>(floor(localMax.x + 0.5f)) - map->GetMinIndexX();
+		int firstRow = static_cast<int>(floor(-localMax.y + 0.5f)) - map->GetMinIndexY();
+		int lastRow = static_cast<int>(floor(-localMin.y + 0.5f)) - map->GetMinIndexY();
+
+		// Nothing on screen
+		if (lastColumn < 0 || lastRow < 0 || firstColumn >= static_cast<int>(map->GetWidth())
+			|| firstRow >= static_cast<int>(map->GetHeight()))
+			return;
+
+		const int chunkSize = static_cast<int>(Tilemap::GetChunkSize());
+		unsigned firstChunkX = std::max(firstColumn, 0) / chunkSize;
+		unsigned firstChunkY = std::max(firstRow, 0) / chunkSize;
+		unsigned lastChunkX = std::min(static_cast<unsigned>(lastColumn) / chunkSize, chunkCountX - 1);
+		unsigned lastChunkY = std::min(static_cast<unsigned>(lastRow) / chunkSize, chunkCountY - 1);
+
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
 
-				// Set frame index to cell value
-				SetFrame(cellValue - 1);
+		// Interpolated between fixed updates if the object has a rigid body
+		Matrix2D drawMatrix = transform->GetDrawMatrix();
 
-				// Set offset based on cell location and scale
-				offset.x = c * tileSize.x;
-				offset.y = r * -tileSize.y;
+		for (unsigned chunkY = firstChunkY; chunkY <= lastChunkY; ++chunkY)
+		{
+			for (unsigned chunkX = firstChunkX; chunkX <= lastChunkX; ++chunkX)
+			{
+				Chunk& chunk = chunks[chunkY * chunkCountX + chunkX];
+				++stats.chunksVisible;
 
-				// Draw the sprite
-				Sprite::Draw(offset);
+				// Rebuild chunks whose cells have changed
+				unsigned revision = map->GetChunkRevision(chunkX, chunkY);
+				if (!chunk.built || chunk.revision != revision)
+				{
+					BuildChunk(chunk, chunkX, chunkY);
+					chunk.revision = revision;
+					++stats.chunksRebuilt;
+				}
+
+				// Texture coordinates and flipping are already part of the mesh
+				for (size_t i = 0; i < chunk.batches.Size(); ++i)
+				{
+					const ChunkBatch& batch = chunk.batches[i];
+					graphics.DrawSprite(*batch.mesh, *batch.texture, drawMatrix, GetZDepth(),
+						GetColor(), Vector2D(), Vector2D(1.0f, 1.0f), false, false);
+
+					stats.tiles += batch.tiles;
+					++stats.drawCalls;
+				}
 			}
 		}
 	}
@@ -117,6 +181,7 @@ namespace Beta
 	void SpriteTilemap::SetTilemap(ConstTilemapPtr map_)
 	{
 		map = map_;
+		ResetChunks();
 	}
 
 	// Loads object data from a file.
@@ -139,5 +204,137 @@ namespace Beta
 		stream.WriteVariable("tilemap", map->GetName());
 	}
 
+	// Returns counters for the most recent draw.
+	const SpriteTilemapStats& SpriteTilemap::GetStats() const
+	{
+		return stats;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	SpriteTilemap::Chunk::Chunk()
+		: revision(0), built(false)
+	{
+	}
+
+	// Discard all cached chunk meshes.
+	void SpriteTilemap::ResetChunks()
+	{
+		// Destroying the chunks releases their meshes
+		chunks.Clear();
+
+		builtMap = map.get();
+		builtSpriteSource = GetSpriteSource();
+		builtFlipX = GetFlipX();
+		builtFlipY = GetFlipY();
+
+		if (map == nullptr)
+		{
+			builtRevision = 0;
+			chunkCountX = 0;
+			chunkCountY = 0;
+			return;
+		}
+
+		builtRevision = map->GetRevision();
+		chunkCountX = map->GetChunkCountX();
+		chunkCountY = map->GetChunkCountY();
+		chunks.Resize(static_cast<size_t>(chunkCountX) * chunkCountY);
+	}
+
+	// Create the meshes for the tiles in a chunk.
+	void SpriteTilemap::BuildChunk(Chunk& chunk, unsigned chunkX, unsigned chunkY)
+	{
+		chunk.batches.Clear();
+		chunk.built = true;
+
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
+		MeshFactory& factory = *EngineGetModule(MeshFactory);
+		ConstSpriteSourcePtr spriteSource = GetSpriteSource();
+
+		// Vertices for each texture used by the chunk
+		Array<const Texture*> textures;
+		Array<Array<Vertex>> vertices;
+
+		const unsigned chunkSize = Tilemap::GetChunkSize();
+		const int firstColumn = map->GetMinIndexX() + static_cast<int>(chunkX * chunkSize);
+		const int firstRow = map->GetMinIndexY() + static_cast<int>(chunkY * chunkSize);
+		const int endColumn = std::min(firstColumn + static_cast<int>(chunkSize), map->GetMaxIndexX());
+		const int endRow = std::min(firstRow + static_cast<int>(chunkSize), map->GetMaxIndexY());
+
+		for (int r = firstRow; r < endRow; ++r)
+		{
+			for (int c = firstColumn; c < endColumn; ++c)
+			{
+				int cellValue = map->GetCellValue(c, r);
+
+				// Skip empty cells
+				if (cellValue < 1)
+					continue;
+
+				// Find texture and frame coordinates
+				unsigned frame = static_cast<unsigned>(cellValue - 1);
+				Vector2D uvOffset;
+				Vector2D uvStride(1.0f, 1.0f);
+				const Texture* texture = &graphics.GetDefaultTexture();
+				if (spriteSource != nullptr)
+				{
+					if (frame >= spriteSource->GetFrameCount())
+						continue;
+					texture = &spriteSource->GetFrameTexture(frame, uvOffset, uvStride);
+				}
+
+				// Mirroring a frame is the same as starting at its far edge and stepping backwards
+				if (builtFlipX)
+				{
+					uvOffset.x += uvStride.x;
+					uvStride.x = -uvStride.x;
+				}
+				if (builtFlipY)
+				{
+					uvOffset.y += uvStride.y;
+					uvStride.y = -uvStride.y;
+				}
+
+				size_t index = std::find(textures.Begin(), textures.End(), texture) - textures.Begin();
+				if (index == textures.Size())
+				{
+					textures.PushBack(texture);
+					vertices.PushBack(Array<Vertex>());
+				}
+
+				// Same corners as a default quad mesh, centered on the tile
+				Vector2D center(static_cast<float>(c), static_cast<float>(-r));
+				Vertex bottomLeft(center + Vector2D(-0.5f, -0.5f), uvOffset + Vector2D(0.0f, uvStride.y));
+				Vertex bottomRight(center + Vector2D(0.5f, -0.5f), uvOffset + uvStride);
+				Vertex topLeft(center + Vector2D(-0.5f, 0.5f), uvOffset);
+				Vertex topRight(center + Vector2D(0.5f, 0.5f), uvOffset + Vector2D(uvStride.x, 0.0f));
+
+				Array<Vertex>& tileVertices = vertices[index];
+				tileVertices.PushBack(bottomLeft);
+				tileVertices.PushBack(bottomRight);
+				tileVertices.PushBack(topLeft);
+				tileVertices.PushBack(bottomRight);
+				tileVertices.PushBack(topRight);
+				tileVertices.PushBack(topLeft);
+			}
+		}
+
+		// Create one mesh per texture
+		for (size_t i = 0; i < textures.Size(); ++i)
+		{
+			for (size_t j = 0; j < vertices[i].Size(); ++j)
+				factory.AddVertex(vertices[i][j]);
+
+			ChunkBatch batch;
+			batch.mesh = MeshPtr(factory.EndCreate());
+			batch.texture = textures[i];
+			batch.tiles = static_cast<unsigned>(vertices[i].Size() / 6);
+			chunk.batches.PushBack(batch);
+		}
+	}
+
 	COMPONENT_SUBCLASS_SUBCLASS_DEFINITION(Sprite, SpriteTilemap)
 }
@@ -19,11 +19,90 @@
 #include <EngineCore.h>	// GetFilePath
 #include <FileStream.h> // ReadVariable
 #include <GameObject.h> // GetName
+#include "MappedFile.h" // Open, GetData
+
+#include <cstdint>		// uint32_t, uint64_t
+#include <filesystem>	// last_write_time
 
 //------------------------------------------------------------------------------
 
 namespace Beta
 {
+	//------------------------------------------------------------------------------
+	// Private Structures:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Layout of a binary tilemap file:
+		//   TilemapFileHeader
+		//   Map name (nameLength chars, not terminated)
+		//   Cells at cellOffset (width * height int32s row by row, or run-length encoded)
+		//   Objects at objectOffset (per object: uint32 name length, name chars, int32 x, int32 y)
+		// All values are stored in native (little-endian) byte order.
+		struct TilemapFileHeader
+		{
+			char magic[4];
+			uint32_t version;
+			uint32_t width;
+			uint32_t height;
+			int32_t offsetX;
+			int32_t offsetY;
+			uint32_t compression;
+			uint32_t nameLength;
+			uint64_t cellOffset;
+			uint64_t cellSize;
+			uint64_t objectOffset;
+			uint32_t numObjects;
+			uint32_t reserved;
+		};
+
+		typedef enum TilemapCompression
+		{
+			// Cells are stored as-is and can be used in place
+			TilemapCompressionNone,
+			// Cells are stored as (uint32 count, int32 value) runs
+			TilemapCompressionRunLength,
+		} TilemapCompression;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		const char tilemapFileMagic[4] = { 'B', 'T', 'M', 'P' };
+		const uint32_t tilemapFileVersion = 1;
+
+		// Alignment of the cell data, so that it can be used in place
+		const uint64_t tilemapCellAlignment = 64;
+
+		// Smallest stored object (name length, x, and y with an empty name)
+		const uint64_t tilemapMinObjectSize = sizeof(uint32_t) + 2 * sizeof(int32_t);
+
+		// Extension of binary tilemaps, which are used instead of text files if present
+		const std::string binaryExtension = ".map";
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Declarations:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Copy a value out of a mapped file, checking that it is in bounds.
+		template<typename T>
+		bool ReadMapped(const MappedFile& file, uint64_t& position, T& value);
+
+		// Count the cells described by run-length encoded cell data, so that
+		// the size of a map can be checked before its cells are allocated.
+		uint64_t CountRunLengthCells(const MappedFile& file, uint64_t offset, uint64_t size);
+
+		// Write a value to a binary file.
+		template<typename T>
+		void WriteBinary(std::ofstream& file, const T& value);
+	}
 
 
 	//------------------------------------------------------------------------------
@@ -69,6 +148,7 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	const int Tilemap::invalidIndex = -1;
+	const unsigned Tilemap::chunkSize = 32;
 	TilemapManager Tilemap::tilemapManager;
 
 	TilemapManager::TilemapManager()
@@ -80,6 +160,42 @@ namespace Beta
 	{
 		TilemapPtr map = std::make_shared<Tilemap>();
 		std::string path = GetFilePath() + name + GetFileExtension();
+		std::string binaryPath = GetFilePath() + name + binaryExtension;
+
+		// Prefer the binary format, since it does not need to be parsed
+		std::error_code binaryError;
+		std::filesystem::file_time_type binaryTime = std::filesystem::last_write_time(binaryPath, binaryError);
+		bool useBinary = !binaryError;
+
+		// Rebuild the binary file if the text file was saved after it. The new file
+		// replaces the old one rather than overwriting it, since maps that are
+		// still loaded may be using the old file's cells in place.
+		std::error_code textError;
+		std::filesystem::file_time_type textTime = std::filesystem::last_write_time(path, textError);
+		if (useBinary && !textError && textTime > binaryTime)
+		{
+			std::string newBinaryPath = binaryPath + ".new";
+			std::error_code renameError;
+			if (Tilemap::ConvertToBinary(path, newBinaryPath))
+				std::filesystem::rename(newBinaryPath, binaryPath, renameError);
+			else
+				renameError = std::make_error_code(std::errc::io_error);
+
+			// Use the text file if the binary file could not be replaced
+			if (renameError)
+			{
+				std::filesystem::remove(newBinaryPath, renameError);
+				useBinary = false;
+			}
+		}
+
+		if (useBinary)
+		{
+			if (!map->DeserializeBinary(binaryPath))
+				map.reset();
+			return map;
+		}
+
 		FileStream stream(path, OM_Read);
 		try
 		{
@@ -101,24 +217,29 @@ namespace Beta
 	//   height = The height of the map.
 	//   name = The name of the map.
 	//   data = The array containing the map data.
-	Tilemap::Tilemap(unsigned width_, unsigned height_, const std::string & name, int** data)
-		: width(0), height(0), offsetX(0), offsetY(0), data(data), name(name)
+	Tilemap::Tilemap(unsigned width_, unsigned height_, const std::string & name, int** data_)
+		: width(0), height(0), offsetX(0), offsetY(0), data(nullptr), mappedFile(nullptr), revision(0), name(name)
 	{
-		// If no data was passed, but we know the size of the map
-		if (data == nullptr && width_ != 0 && height_ != 0)
+		// If we know the size of the map
+		if (width_ != 0 && height_ != 0)
 		{
 			// Set width and height and allocate memory for the map
 			Resize(width_, height_);
+
+			// Copy data that was passed in
+			if (data_ != nullptr)
+			{
+				for (unsigned r = 0; r < height; ++r)
+					for (unsigned c = 0; c < width; ++c)
+						data[r * width + c] = data_[c][r];
+			}
 		}
 	}
 
 	// Destructor.
 	Tilemap::~Tilemap()
 	{
-		// Delete data array
-		for (unsigned i = 0; i < width; ++i)
-			delete[] data[i];
-		delete[] data;
+		ReleaseData();
 	}
 
 	// Gets the width of the map (in tiles).
@@ -169,7 +290,7 @@ namespace Beta
 		if (actualColumn >= width || actualRow >= height)
 			return invalidIndex;
 		else
-			return data[actualColumn][actualRow];
+			return data[actualRow * width + actualColumn];
 	}
 
 	// Sets the value of the cell in the map with the given indices.
@@ -224,7 +345,8 @@ namespace Beta
 			std::cout << "Grow" << std::endl;
 		}
 
-		data[actualColumn][actualRow] = value;
+		data[actualRow * width + actualColumn] = value;
+		++chunkRevisions[(actualRow / chunkSize) * GetChunkCountX() + actualColumn / chunkSize];
 
 		if (verbose)
 			std::cout << *this << std::endl;
@@ -256,12 +378,8 @@ namespace Beta
 			return;
 
 		// Allocate new memory
-		int** dataNew = new int* [width_];
-		for (size_t c = 0; c < width_; ++c)
-		{
-			dataNew[c] = new int[height_];
-			memset(dataNew[c], 0, sizeof(int) * height_);
-		}
+		int* dataNew = new int[width_ * height_];
+		memset(dataNew, 0, sizeof(int) * width_ * height_);
 
 		// Copy from old into new
 		unsigned minHeight = std::min(height, height_);
@@ -279,15 +397,13 @@ namespace Beta
 				size_t yNew = y + yShiftNew;
 				size_t xOld = x + xShiftOld;
 				size_t yOld = y + yShiftOld;
-				dataNew[xNew][yNew]
-					= data[xOld][yOld];
+				dataNew[yNew * width_ + xNew]
+					= data[yOld * width + xOld];
 			}
 		}
 
 		// Delete old data
-		for (size_t c = 0; c < width; ++c)
-			delete[] data[c];
-		delete[] data;
+		ReleaseData();
 
 		// Set width and height
 		width = width_;
@@ -299,13 +415,15 @@ namespace Beta
 		// Adjust offsets
 		offsetX += xShift;
 		offsetY += yShift;
+
+		ResetChunks();
 	}
 
 	// Resets all tiles to 0
 	void Tilemap::Clear()
 	{
-		for (size_t c = 0; c < width; ++c)
-			memset(data[c], 0, sizeof(int) * height);
+		memset(data, 0, sizeof(int) * width * height);
+		ResetChunks();
 	}
 
 	// Shrinks map so that any columns or rows on the edge of the map
@@ -323,7 +441,7 @@ namespace Beta
 		{
 			for (unsigned c = 0; c < width; ++c)
 			{
-				if (data[c][r] != 0)
+				if (data[r * width + c] != 0)
 				{
 					empty = false;
 					break;
@@ -340,7 +458,7 @@ namespace Beta
 		{
 			for (unsigned c = 0; c < width; ++c)
 			{
-				if (data[c][r] != 0)
+				if (data[r * width + c] != 0)
 				{
 					empty = false;
 					break;
@@ -358,7 +476,7 @@ namespace Beta
 		{
 			for (unsigned r = 0; r < height; ++r)
 			{
-				if (data[c][r] != 0)
+				if (data[r * width + c] != 0)
 				{
 					empty = false;
 					break;
@@ -375,7 +493,7 @@ namespace Beta
 		{
 			for (unsigned r = 0; r < height; ++r)
 			{
-				if (data[c][r] != 0)
+				if (data[r * width + c] != 0)
 				{
 					empty = false;
 					break;
@@ -447,7 +565,8 @@ namespace Beta
 
 		// Set width, height, allocate memory
 		Resize(width_, height_);
-		stream.ReadArrayVariable("tileLayer", data, width, height);
+		stream.ReadArrayVariable("tileLayer", data, width * height);
+		ResetChunks();
 
 		// Read size of object layer and resize as necessary
 		size_t numObjects = 0;
@@ -481,7 +600,7 @@ namespace Beta
 		stream.WriteVariable("offsetY", offsetY);
 
 		// Big data
-		stream.WriteArrayVariable("tileLayer", data, width, height);
+		stream.WriteArrayVariable("tileLayer", data, width, height, false);
 		stream.WriteVariable("numObjects", objects.Size());
 		stream.WriteValue("objectLayer :");
 		stream.BeginScope();
@@ -494,6 +613,276 @@ namespace Beta
 		stream.EndScope();
 	}
 
+	// Loads the map from a binary tilemap file. Uncompressed cell data is
+	// mapped into memory and used in place instead of being copied.
+	// Params:
+	//   filename = The path of the binary file.
+	// Returns:
+	//   True if the map was loaded, false otherwise.
+	bool Tilemap::DeserializeBinary(const std::string& filename)
+	{
+		MappedFile* file = new MappedFile();
+		if (!file->Open(filename))
+		{
+			std::cout << "ERROR in Tilemap: Could not open " << filename << std::endl;
+			delete file;
+			return false;
+		}
+
+		// Validate header
+		TilemapFileHeader header;
+		uint64_t position = 0;
+		if (!ReadMapped(*file, position, header) || memcmp(header.magic, tilemapFileMagic, sizeof(header.magic)) != 0
+			|| header.version != tilemapFileVersion)
+		{
+			std::cout << "ERROR in Tilemap: " << filename << " is not a binary tilemap." << std::endl;
+			delete file;
+			return false;
+		}
+
+		const uint64_t numCells = static_cast<uint64_t>(header.width) * header.height;
+		bool valid = header.cellOffset % sizeof(int32_t) == 0
+			&& header.cellOffset <= file->GetSize() && header.cellSize <= file->GetSize() - header.cellOffset
+			&& header.objectOffset <= file->GetSize()
+			&& header.numObjects <= (file->GetSize() - header.objectOffset) / tilemapMinObjectSize
+			&& sizeof(TilemapFileHeader) + header.nameLength <= file->GetSize();
+		if (header.compression == TilemapCompressionNone)
+			valid = valid && header.cellSize == numCells * sizeof(int32_t);
+		else if (header.compression == TilemapCompressionRunLength)
+			valid = valid && header.cellSize % (2 * sizeof(uint32_t)) == 0
+				&& CountRunLengthCells(*file, header.cellOffset, header.cellSize) == numCells;
+		else
+			valid = false;
+
+		if (!valid)
+		{
+			std::cout << "ERROR in Tilemap: " << filename << " is corrupt." << std::endl;
+			delete file;
+			return false;
+		}
+
+		const char* contents = file->GetData();
+		int* cells = nullptr;
+
+		// Use cells in place
+		if (header.compression == TilemapCompressionNone)
+		{
+			cells = reinterpret_cast<int*>(file->GetData() + header.cellOffset);
+		}
+		// Decode runs, which were counted above to match the size of the map
+		else
+		{
+			cells = new int[numCells];
+			uint64_t cell = 0;
+			for (position = header.cellOffset; position < header.cellOffset + header.cellSize; )
+			{
+				uint32_t count;
+				int32_t value;
+				ReadMapped(*file, position, count);
+				ReadMapped(*file, position, value);
+				std::fill(cells + cell, cells + cell + count, value);
+				cell += count;
+			}
+		}
+
+		// Read objects
+		Array<ObjectInMap> objectsNew;
+		objectsNew.Reserve(header.numObjects);
+		position = header.objectOffset;
+		for (uint32_t i = 0; i < header.numObjects; ++i)
+		{
+			uint32_t nameLength;
+			ObjectInMap object;
+			if (!ReadMapped(*file, position, nameLength) || nameLength > file->GetSize() - position)
+				break;
+
+			object.name.assign(contents + position, nameLength);
+			position += nameLength;
+			if (!ReadMapped(*file, position, object.x) || !ReadMapped(*file, position, object.y))
+				break;
+
+			objectsNew.PushBack(object);
+		}
+
+		if (objectsNew.Size() != header.numObjects)
+		{
+			std::cout << "ERROR in Tilemap: " << filename << " is corrupt." << std::endl;
+			if (header.compression != TilemapCompressionNone)
+				delete[] cells;
+			delete file;
+			return false;
+		}
+
+		// Replace current contents
+		ReleaseData();
+		name.assign(contents + sizeof(TilemapFileHeader), header.nameLength);
+		width = header.width;
+		height = header.height;
+		offsetX = header.offsetX;
+		offsetY = header.offsetY;
+		data = cells;
+		objects = objectsNew;
+		ResetChunks();
+
+		// Keep the file open only while its cells are in use
+		if (header.compression == TilemapCompressionNone)
+			mappedFile = file;
+		else
+			delete file;
+
+		return true;
+	}
+
+	// Saves the map to a binary tilemap file.
+	// Params:
+	//   filename = The path of the binary file.
+	//   compress = Whether to run-length encode the cells.
+	// Returns:
+	//   True if the map was saved, false otherwise.
+	bool Tilemap::SerializeBinary(const std::string& filename, bool compress) const
+	{
+		std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			std::cout << "ERROR in Tilemap: Could not open " << filename << " for writing." << std::endl;
+			return false;
+		}
+
+		const size_t numCells = static_cast<size_t>(width) * height;
+
+		// Encode runs of identical cells
+		Array<uint32_t> runs;
+		if (compress)
+		{
+			for (size_t i = 0; i < numCells; )
+			{
+				uint32_t count = 1;
+				while (i + count < numCells && data[i + count] == data[i])
+					++count;
+
+				runs.PushBack(count);
+				runs.PushBack(static_cast<uint32_t>(data[i]));
+				i += count;
+			}
+		}
+
+		TilemapFileHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, tilemapFileMagic, sizeof(header.magic));
+		header.version = tilemapFileVersion;
+		header.width = width;
+		header.height = height;
+		header.offsetX = offsetX;
+		header.offsetY = offsetY;
+		header.compression = compress ? TilemapCompressionRunLength : TilemapCompressionNone;
+		header.nameLength = static_cast<uint32_t>(name.size());
+
+		uint64_t nameEnd = sizeof(TilemapFileHeader) + name.size();
+		header.cellOffset = (nameEnd + tilemapCellAlignment - 1) / tilemapCellAlignment * tilemapCellAlignment;
+		header.cellSize = compress ? runs.Size() * sizeof(uint32_t) : numCells * sizeof(int32_t);
+		header.objectOffset = header.cellOffset + header.cellSize;
+		header.numObjects = static_cast<uint32_t>(objects.Size());
+
+		// Header and name
+		WriteBinary(file, header);
+		file.write(name.data(), name.size());
+		for (uint64_t i = nameEnd; i < header.cellOffset; ++i)
+			file.put(0);
+
+		// Cells
+		if (compress)
+			file.write(reinterpret_cast<const char*>(runs.Data()), header.cellSize);
+		else if (numCells != 0)
+			file.write(reinterpret_cast<const char*>(data), header.cellSize);
+
+		// Objects
+		for (size_t i = 0; i < objects.Size(); ++i)
+		{
+			WriteBinary(file, static_cast<uint32_t>(objects[i].name.size()));
+			file.write(objects[i].name.data(), objects[i].name.size());
+			WriteBinary(file, static_cast<int32_t>(objects[i].x));
+			WriteBinary(file, static_cast<int32_t>(objects[i].y));
+		}
+
+		if (!file.good())
+		{
+			std::cout << "ERROR in Tilemap: Could not write " << filename << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	// Converts a tilemap from the text format to the binary format.
+	// Params:
+	//   textFilename = The path of the existing text file.
+	//   binaryFilename = The path of the binary file to create.
+	//   compress = Whether to run-length encode the cells.
+	// Returns:
+	//   True if the map was converted, false otherwise.
+	bool Tilemap::ConvertToBinary(const std::string& textFilename,
+		const std::string& binaryFilename, bool compress)
+	{
+		Tilemap map;
+		FileStream stream(textFilename, OM_Read);
+		try
+		{
+			map.Deserialize(stream);
+		}
+		catch (const FileStreamException & e)
+		{
+			std::cout << "ERROR in Tilemap: " << e.what() << std::endl;
+			return false;
+		}
+
+		return map.SerializeBinary(binaryFilename, compress);
+	}
+
+	// Test whether the cells are used in place from a mapped binary file.
+	bool Tilemap::IsMapped() const
+	{
+		return mappedFile != nullptr;
+	}
+
+	// Returns the cells of the map, stored row by row (GetWidth() cells per row).
+	const int* Tilemap::GetCellData() const
+	{
+		return data;
+	}
+
+	// Returns the width and height of the square chunks used to track changes (in tiles).
+	unsigned Tilemap::GetChunkSize()
+	{
+		return chunkSize;
+	}
+
+	// Gets the number of chunks needed to cover the width of the map.
+	unsigned Tilemap::GetChunkCountX() const
+	{
+		return (width + chunkSize - 1) / chunkSize;
+	}
+
+	// Gets the number of chunks needed to cover the height of the map.
+	unsigned Tilemap::GetChunkCountY() const
+	{
+		return (height + chunkSize - 1) / chunkSize;
+	}
+
+	// Returns a number that changes whenever a cell in the given chunk is set.
+	// Params:
+	//   chunkX = The column of the chunk.
+	//   chunkY = The row of the chunk.
+	unsigned Tilemap::GetChunkRevision(unsigned chunkX, unsigned chunkY) const
+	{
+		return chunkRevisions[chunkY * GetChunkCountX() + chunkX];
+	}
+
+	// Returns a number that changes whenever the whole map changes.
+	unsigned Tilemap::GetRevision() const
+	{
+		return revision;
+	}
+
 	const int Tilemap::InvalidIndex()
 	{
 		return invalidIndex;
@@ -509,11 +898,91 @@ namespace Beta
 		for (size_t y = 0; y < map.height; ++y)
 		{
 			for (size_t x = 0; x < map.width; ++x)
-				stream << map.data[x][y] << " ";
+				stream << map.data[y * map.width + x] << " ";
 			stream << std::endl;
 		}
 		return stream;
 	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Free the cells, or unmap them if they came from a binary file.
+	void Tilemap::ReleaseData()
+	{
+		if (mappedFile != nullptr)
+		{
+			delete mappedFile;
+			mappedFile = nullptr;
+		}
+		else
+		{
+			delete[] data;
+		}
+
+		data = nullptr;
+	}
+
+	// Mark the whole map as changed and reset chunk revisions to match its size.
+	void Tilemap::ResetChunks()
+	{
+		++revision;
+
+		size_t numChunks = static_cast<size_t>(GetChunkCountX()) * GetChunkCountY();
+		chunkRevisions.Resize(numChunks);
+		for (size_t i = 0; i < numChunks; ++i)
+			chunkRevisions[i] = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Definitions:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Copy a value out of a mapped file, checking that it is in bounds.
+		template<typename T>
+		bool ReadMapped(const MappedFile& file, uint64_t& position, T& value)
+		{
+			if (position > file.GetSize() || file.GetSize() - position < sizeof(T))
+				return false;
+
+			memcpy(&value, file.GetData() + position, sizeof(T));
+			position += sizeof(T);
+			return true;
+		}
+
+		// Count the cells described by run-length encoded cell data, so that
+		// the size of a map can be checked before its cells are allocated.
+		// Params:
+		//   file = The mapped tilemap file.
+		//   offset = The position of the first run, which must be in bounds.
+		//   size = The size of the runs in bytes, which must be in bounds.
+		// Returns:
+		//   The sum of the runs' counts.
+		uint64_t CountRunLengthCells(const MappedFile& file, uint64_t offset, uint64_t size)
+		{
+			uint64_t cells = 0;
+			for (uint64_t position = offset; position < offset + size; )
+			{
+				uint32_t count;
+				int32_t value;
+				ReadMapped(file, position, count);
+				ReadMapped(file, position, value);
+				cells += count;
+			}
+
+			return cells;
+		}
+
+		// Write a value to a binary file.
+		template<typename T>
+		void WriteBinary(std::ofstream& file, const T& value)
+		{
+			file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -27,6 +27,9 @@
 #include "Space.h"
 
 #include "GameObject.h" // GetName
+#include "GameObjectManager.h" // GetBodyStorage
+#include "BodyStorage.h" // AddTransform
+#include "RigidBody.h" // GetOldTranslation, GetOldRotation, oldTranslation
 
 namespace Beta
 {
@@ -40,15 +43,44 @@ namespace Beta
 	//	 x = Initial world position on the x-axis.
 	//	 y = Initial world position on the y-axis.
 	Transform::Transform(float x, float y)
-		: Component("Transform"), translation(x, y), scale(1.0f, 1.0f),
-		rotation(0.0f), isDirty(true)
+		: Component("Transform"), localTranslation(x, y), localRotation(0.0f),
+		localScale(1.0f, 1.0f), localIsDirty(true), storage(nullptr), storageSlot(0)
 	{
+		UseLocalData();
 	}
 
 	Transform::Transform(Vector2D translation, Vector2D scale, float rotation)
-		: Component("Transform"), translation(translation), scale(scale),
-		rotation(rotation), isDirty(true)
+		: Component("Transform"), localTranslation(translation), localRotation(rotation),
+		localScale(scale), localIsDirty(true), storage(nullptr), storageSlot(0)
 	{
+		UseLocalData();
+	}
+
+	// Copy constructor - Copies the values of another transform into this one's own storage.
+	Transform::Transform(const Transform& other)
+		: Component(other), localTranslation(*other.translation), localRotation(*other.rotation),
+		localScale(*other.scale), localIsDirty(true), storage(nullptr), storageSlot(0)
+	{
+		UseLocalData();
+	}
+
+	// Destructor - Releases this transform's slot in the space's body storage.
+	Transform::~Transform()
+	{
+		if (storage != nullptr)
+			storage->RemoveTransform(storageSlot);
+	}
+
+	// Moves this transform's data into the space's body storage, if it has one.
+	void Transform::Initialize()
+	{
+		Space* space = GetOwner() ? GetOwner()->GetSpace() : nullptr;
+		if (space == nullptr)
+			return;
+
+		BodyStorage* bodyStorage = space->GetObjectManager().GetBodyStorage();
+		if (bodyStorage != nullptr)
+			AttachStorage(*bodyStorage);
 	}
 
 	// Get the transform matrix, based upon translation, rotation and scale settings.
@@ -57,7 +89,7 @@ namespace Beta
 	const Matrix2D& Transform::GetMatrix() const
 	{
 		CalculateMatrices();
-		return matrix;
+		return *matrix;
 	}
 
 	// Get the inverse of the transform matrix.
@@ -66,7 +98,38 @@ namespace Beta
 	const Matrix2D& Transform::GetInverseMatrix() const
 	{
 		CalculateMatrices();
-		return inverseMatrix;
+		return *inverseMatrix;
+	}
+
+	// Get the matrix that should be used to draw the object. Objects with rigid
+	// bodies are drawn between their previous and current fixed update states,
+	// using the space's interpolation alpha.
+	// Returns:
+	//	 The interpolated matrix, or the transform matrix if there is nothing to interpolate.
+	Matrix2D Transform::GetDrawMatrix() const
+	{
+		Vector2D drawTranslation;
+		float drawRotation;
+		if (!GetInterpolatedState(drawTranslation, drawRotation))
+			return GetMatrix();
+
+		// Same as ComputeMatrices, without the inverse
+		return Matrix2D::TranslationMatrix(drawTranslation.x, drawTranslation.y)
+			* Matrix2D::RotationMatrixRadians(drawRotation)
+			* Matrix2D::ScalingMatrix(scale->x, scale->y);
+	}
+
+	// Get the translation that should be used to draw the object (see GetDrawMatrix).
+	// Returns:
+	//	 The interpolated translation, or the translation if there is nothing to interpolate.
+	Vector2D Transform::GetDrawTranslation() const
+	{
+		Vector2D drawTranslation;
+		float drawRotation;
+		if (!GetInterpolatedState(drawTranslation, drawRotation))
+			return *translation;
+
+		return drawTranslation;
 	}
 
 	// Set the translation of a transform component.
@@ -75,26 +138,49 @@ namespace Beta
 	//	 translation = Pointer to a translation vector.
 	void Transform::SetTranslation(const Vector2D& translation_)
 	{
-		if (!AlmostEqual(translation, translation_))
-			isDirty = true;
+		if (!AlmostEqual(*translation, translation_))
+			*isDirty = true;
 
-		translation = translation_;
+		*translation = translation_;
 	}
 
 	void Transform::SetTranslationX(float x)
 	{
-		if (!AlmostEqual(x, translation.x))
-			isDirty = true;
+		if (!AlmostEqual(x, translation->x))
+			*isDirty = true;
 
-		translation.x = x;
+		translation->x = x;
 	}
 
 	void Transform::SetTranslationY(float y)
 	{
-		if (!AlmostEqual(y, translation.y))
-			isDirty = true;
+		if (!AlmostEqual(y, translation->y))
+			*isDirty = true;
+
+		translation->y = y;
+	}
 
-		translation.y = y;
+	// Move the object to a new translation without drawing it between its old
+	// and new positions. Objects with rigid bodies are drawn partway between
+	// fixed updates, so use this rather than SetTranslation when moving them
+	// outside of physics (e.g. wrapping around the screen or respawning).
+	// Params:
+	//	 translation = Reference to a translation vector.
+	void Transform::Teleport(const Vector2D& translation_)
+	{
+		SetTranslation(translation_);
+
+		GameObject* owner = GetOwner();
+		if (owner == nullptr)
+			return;
+
+		// Start interpolating from the new state
+		RigidBody* rigidBody = owner->GetComponent<RigidBody>();
+		if (rigidBody != nullptr)
+		{
+			*rigidBody->oldTranslation = *translation;
+			*rigidBody->oldRotation = *rotation;
+		}
 	}
 
 	// Get the translation of a transform component.
@@ -106,7 +192,7 @@ namespace Beta
 	//		
 	const Vector2D& Transform::GetTranslation() const
 	{
-		return translation;
+		return *translation;
 	}
 
 	// Set the rotation of a transform component.
@@ -115,10 +201,10 @@ namespace Beta
 	//	 rotation = The rotation value (in radians).
 	void Transform::SetRotation(float rotation_)
 	{
-		if (!AlmostEqual(rotation, rotation_))
-			isDirty = true;
+		if (!AlmostEqual(*rotation, rotation_))
+			*isDirty = true;
 
-		rotation = rotation_;
+		*rotation = rotation_;
 	}
 
 	// Get the rotation value of a transform component.
@@ -128,7 +214,7 @@ namespace Beta
 	//		The component's rotation value (in radians).
 	float Transform::GetRotation() const
 	{
-		return rotation;
+		return *rotation;
 	}
 
 	// Set the scale of a transform component.
@@ -137,26 +223,26 @@ namespace Beta
 	//	 translation = Pointer to a scale vector.
 	void Transform::SetScale(const Vector2D& scale_)
 	{
-		if (!AlmostEqual(scale, scale_))
-			isDirty = true;
+		if (!AlmostEqual(*scale, scale_))
+			*isDirty = true;
 
-		scale = scale_;
+		*scale = scale_;
 	}
 
 	void Transform::SetScaleX(float x)
 	{
-		if (!AlmostEqual(x, scale.x))
-			isDirty = true;
+		if (!AlmostEqual(x, scale->x))
+			*isDirty = true;
 
-		scale.x = x;
+		scale->x = x;
 	}
 
 	void Transform::SetScaleY(float y)
 	{
-		if (!AlmostEqual(y, scale.y))
-			isDirty = true;
+		if (!AlmostEqual(y, scale->y))
+			*isDirty = true;
 
-		scale.y = y;
+		scale->y = y;
 	}
 
 	// Get the scale of a transform component.
@@ -166,17 +252,17 @@ namespace Beta
 	//   A reference to the component's scale structure,	
 	const Vector2D& Transform::GetScale() const
 	{
-		return scale;
+		return *scale;
 	}
 
 	// Returns a bounding rectangle using translation and (half) scale.
 	const BoundingRectangle Transform::GetBounds() const
 	{
-		Vector2D extents = scale / 2.0f;
+		Vector2D extents = *scale / 2.0f;
 		extents.x = fabsf(extents.x);
 		extents.y = fabsf(extents.y);
 
-		return BoundingRectangle(translation, extents);
+		return BoundingRectangle(*translation, extents);
 	}
 
 	// Tests whether the object is visible on screen.
@@ -188,14 +274,44 @@ namespace Beta
 		return Intersection2D::RectangleRectangleIntersection(object, screen);
 	}
 
+	// Calculates a transform matrix and its inverse.
+	// Params:
+	//   translation = World position of the object.
+	//   rotation = Rotation of the object about the z-axis.
+	//   scale = Width and height of the object.
+	//   matrix = (Out) The transform matrix.
+	//   inverseMatrix = (Out) The inverse of the transform matrix.
+	void Transform::ComputeMatrices(const Vector2D& translation, float rotation,
+		const Vector2D& scale, Matrix2D& matrix, Matrix2D& inverseMatrix)
+	{
+		// TRANSFORM
+		Matrix2D scaling = Matrix2D::ScalingMatrix(scale.x, scale.y);
+		Matrix2D rot = Matrix2D::RotationMatrixRadians(rotation);
+		Matrix2D trans = Matrix2D::TranslationMatrix(translation.x, translation.y);
+
+		// Scaling is applied first, then rotation, then translation
+		matrix = trans * rot * scaling;
+
+		// INVERSE
+		float inverseScaleX = (scale.x != 0.0f) ? (1.0f / scale.x) : 0.0f;
+		float inverseScaleY = (scale.y != 0.0f) ? (1.0f / scale.y) : 0.0f;
+
+		scaling = Matrix2D::ScalingMatrix(inverseScaleX, inverseScaleY);
+		rot = Matrix2D::RotationMatrixRadians(-rotation);
+		trans = Matrix2D::TranslationMatrix(-translation.x, -translation.y);
+
+		// Reverse order for inverse
+		inverseMatrix = scaling * rot * trans;
+	}
+
 	// Save object data to file.
 	// Params:
 	//   stream = The stream object used to save the object's data.
 	void Transform::Serialize(FileStream& stream) const
 	{
-		stream.WriteVariable("translation", translation);
-		stream.WriteVariable("rotation", rotation);
-		stream.WriteVariable("scale", scale);
+		stream.WriteVariable("translation", *translation);
+		stream.WriteVariable("rotation", *rotation);
+		stream.WriteVariable("scale", *scale);
 	}
 
 	// Load object data from file
@@ -203,37 +319,98 @@ namespace Beta
 	//   stream = The stream object used to load the object's data.
 	void Transform::Deserialize(FileStream& stream)
 	{
-		stream.ReadVariable("translation", translation);
-		stream.ReadVariable("rotation", rotation);
-		stream.ReadVariable("scale", scale);
+		stream.ReadVariable("translation", *translation);
+		stream.ReadVariable("rotation", *rotation);
+		stream.ReadVariable("scale", *scale);
+		*isDirty = true;
 	}
 
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
 	// Calculates the transform matrix and its inverse using translation, rotation, and scale.
 	void Transform::CalculateMatrices() const
 	{
-		if (isDirty)
+		if (*isDirty)
 		{
-			// TRANSFORM
-			Matrix2D scaling = Matrix2D::ScalingMatrix(scale.x, scale.y);
-			Matrix2D rot = Matrix2D::RotationMatrixRadians(rotation);
-			Matrix2D trans = Matrix2D::TranslationMatrix(translation.x, translation.y);
+			ComputeMatrices(*translation, *rotation, *scale, *matrix, *inverseMatrix);
+		}
 
-			// Scaling is applied first, then rotation, then translation
-			matrix = trans * rot * scaling;
+		*isDirty = false;
+	}
 
-			// INVERSE
-			float inverseScaleX = (scale.x != 0.0f) ? (1.0f / scale.x) : 0.0f;
-			float inverseScaleY = (scale.y != 0.0f) ? (1.0f / scale.y) : 0.0f;
+	// Finds the translation and rotation to draw with, between the last two fixed updates.
+	// Params:
+	//   drawTranslation = (Out) The interpolated translation.
+	//   drawRotation = (Out) The interpolated rotation.
+	// Returns:
+	//   False if the object should be drawn using its current state.
+	bool Transform::GetInterpolatedState(Vector2D& drawTranslation, float& drawRotation) const
+	{
+		GameObject* owner = GetOwner();
+		Space* space = GetSpace();
+		if (owner == nullptr || space == nullptr)
+			return false;
+
+		RigidBody* rigidBody = owner->GetComponent<RigidBody>();
+		if (rigidBody == nullptr)
+			return false;
+
+		float alpha = space->GetObjectManager().GetInterpolationAlpha();
+		if (alpha >= 1.0f)
+			return false;
+
+		// Stationary objects can keep using their cached matrix
+		const Vector2D& oldTranslation = rigidBody->GetOldTranslation();
+		float oldRotation = rigidBody->GetOldRotation();
+		if (AlmostEqual(oldTranslation, *translation) && AlmostEqual(oldRotation, *rotation))
+			return false;
+
+		drawTranslation = oldTranslation + (*translation - oldTranslation) * alpha;
+		drawRotation = oldRotation + (*rotation - oldRotation) * alpha;
+		return true;
+	}
 
-			scaling = Matrix2D::ScalingMatrix(inverseScaleX, inverseScaleY);
-			rot = Matrix2D::RotationMatrixRadians(-rotation);
-			trans = Matrix2D::TranslationMatrix(-translation.x, -translation.y);
+	// Moves this transform's data into the given storage. Does nothing if already moved.
+	void Transform::AttachStorage(BodyStorage& bodyStorage)
+	{
+		if (storage != nullptr)
+			return;
 
-			// Reverse order for inverse
-			inverseMatrix = scaling * rot * trans;
-		}
+		storage = &bodyStorage;
+		storageSlot = storage->AddTransform(localTranslation, localRotation, localScale);
+
+		translation = &storage->GetTranslation(storageSlot);
+		rotation = &storage->GetRotation(storageSlot);
+		scale = &storage->GetScale(storageSlot);
+		matrix = &storage->GetMatrix(storageSlot);
+		inverseMatrix = &storage->GetInverseMatrix(storageSlot);
+		isDirty = &storage->GetIsDirty(storageSlot);
+
+		UpdateStorageActive();
+	}
+
+	// Point the data pointers at this transform's own variables.
+	void Transform::UseLocalData()
+	{
+		translation = &localTranslation;
+		rotation = &localRotation;
+		scale = &localScale;
+		matrix = &localMatrix;
+		inverseMatrix = &localInverseMatrix;
+		isDirty = &localIsDirty;
+	}
+
+	// Tell the body storage whether the owner is updated, so that a stored
+	// rigid body only moves while its object is active and not destroyed.
+	void Transform::UpdateStorageActive()
+	{
+		if (storage == nullptr)
+			return;
 
-		isDirty = false;
+		const GameObject* owner = GetOwner();
+		storage->SetActive(storageSlot, owner == nullptr || (owner->IsActive() && !owner->IsDestroyed()));
 	}
 
 	// RTTI
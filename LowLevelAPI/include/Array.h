@@ -15,19 +15,59 @@
 // Include Files:
 //------------------------------------------------------------------------------
 
-// No includes, no error checking, no nothing. 
+// Almost no includes, no error checking, no nothing. 
 // Fast, but dangerous! Use at your own risk.
 
+#include <cstddef>	// size_t
+#include <utility>	// move, forward
+
 //------------------------------------------------------------------------------
 
+// Placement new is used to construct elements, which the
+// debug version of new in stdafx.h would break
+#pragma push_macro("new")
+#undef new
+
 namespace Beta
 {
 	//------------------------------------------------------------------------------
-	// Public Structures:
+	// Private Structures:
 	//------------------------------------------------------------------------------
 
+	// Space for elements stored inside the array itself.
+	template<typename ValueType, size_t InlineCapacity>
+	class ArrayInlineStorage
+	{
+	protected:
+		ValueType* InlineData()
+		{
+			return reinterpret_cast<ValueType*>(inlineBuffer);
+		}
+
+	private:
+		alignas(ValueType) unsigned char inlineBuffer[InlineCapacity * sizeof(ValueType)];
+	};
+
+	// Arrays without inline storage take up no extra space.
 	template<typename ValueType>
-	class Array
+	class ArrayInlineStorage<ValueType, 0>
+	{
+	protected:
+		ValueType* InlineData()
+		{
+			return nullptr;
+		}
+	};
+
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// A dynamic array. Elements are only constructed when they are added.
+	// InlineCapacity elements are stored inside the array itself, so small
+	// arrays don't allocate any memory until they grow past that size.
+	template<typename ValueType, size_t InlineCapacity = 0>
+	class Array : private ArrayInlineStorage<ValueType, InlineCapacity>
 	{
 	public:
 		//------------------------------------------------------------------------------
@@ -35,6 +75,7 @@ namespace Beta
 		//------------------------------------------------------------------------------
 
 		typedef ValueType* ValuePointer;
+		typedef const ValueType* ConstValuePointer;
 		typedef ValueType& ValueReference;
 		typedef const ValueType& ConstValueReference;
 		typedef ValuePointer Iterator;
@@ -46,35 +87,66 @@ namespace Beta
 
 		// Constructors/Destructors
 		Array()
-			: data(nullptr), size(0), capacity(0)
+			: size(0), capacity(InlineCapacity), data(this->InlineData())
 		{
 		}
 
 		Array(const Array& other)
-			: data(nullptr), size(0), capacity(0)
+			: size(0), capacity(InlineCapacity), data(this->InlineData())
 		{
 			ReplaceWith(other);
 		}
 
+		Array(Array&& other)
+			: size(0), capacity(InlineCapacity), data(this->InlineData())
+		{
+			TakeFrom(other);
+		}
+
 		Array(size_t size_)
-			: data(nullptr), size(0), capacity(0)
+			: size(0), capacity(InlineCapacity), data(this->InlineData())
 		{
 			Resize(size_);
 		}
 
 		~Array()
 		{
-			delete[] data;
+			Clear();
+			FreeData();
 		}
 
 		// Add an element to the end of the array.
 		void PushBack(ConstValueReference item)
+		{
+			EmplaceBack(item);
+		}
+
+		// Move an element to the end of the array.
+		void PushBack(ValueType&& item)
+		{
+			EmplaceBack(std::move(item));
+		}
+
+		// Construct an element in place at the end of the array.
+		// Returns a reference to the new element.
+		template<typename... Args>
+		ValueReference EmplaceBack(Args&&... args)
 		{
 			if (size == capacity)
-				Grow();
+			{
+				// Construct the new element before moving the others,
+				// in case the arguments refer to elements of this array
+				size_t newCapacity = capacity > 0 ? capacity * 2 : 1;
+				ValuePointer newData = Allocate(newCapacity);
+				::new (static_cast<void*>(newData + size)) ValueType(std::forward<Args>(args)...);
+				MoveData(newData, newCapacity);
+			}
+			else
+			{
+				::new (static_cast<void*>(data + size)) ValueType(std::forward<Args>(args)...);
+			}
 
-			data[size] = item;
-			++size;
+			return data[size++];
 		}
 
 		// Removes the last element from the array.
@@ -83,11 +155,17 @@ namespace Beta
 			if (size == 0)
 				return;
 			--size;
+			data[size].~ValueType();
 		}
 
 		// Clear the contents of the array, setting size to 0.
+		// Keeps the array's memory so that it can be reused.
 		void Clear()
 		{
+			for (size_t i = 0; i < size; ++i)
+			{
+				data[i].~ValueType();
+			}
 			size = 0;
 		}
 
@@ -98,33 +176,25 @@ namespace Beta
 			if (capacity >= capacity_)
 				return;
 
-			// Double capacity
-			capacity = capacity_;
-			ValuePointer newData = new ValueType[capacity];
-			// Move data
-			for (size_t i = 0; i < size; ++i)
-			{
-				newData[i] = data[i];
-			}
-			delete[] data;
-			data = newData;
+			MoveData(Allocate(capacity_), capacity_);
 		}
 
 		// Set the size of the array to the desired amount, reallocating if necessary.
+		// New elements are default-initialized.
 		void Resize(size_t size_)
 		{
 			// Re-allocate only if necessary
 			if (capacity < size_)
+				MoveData(Allocate(size_), size_);
+
+			// Construct added elements, destroy removed ones
+			for (size_t i = size; i < size_; ++i)
 			{
-				capacity = size_;
-				ValuePointer newData = new ValueType[capacity];
-				// Move data
-				for (size_t i = 0; i < size; ++i)
-				{
-					newData[i] = data[i];
-				}
-				delete[] data;
-				data = newData;
+				::new (static_cast<void*>(data + i)) ValueType;
+			}
+			for (size_t i = size_; i < size; ++i)
+			{
+				data[i].~ValueType();
 			}
 
 			// Set size to new value
@@ -139,9 +209,9 @@ namespace Beta
 
 			for (auto it = location; it != End() - 1; ++it)
 			{
-				*it = *(it + 1);
+				*it = std::move(*(it + 1));
 			}
-			--size;
+			PopBack();
 
 			return location;
 		}
@@ -153,13 +223,27 @@ namespace Beta
 
 			for (auto it = &*location; it != End() - 1; ++it)
 			{
-				*it = *(it + 1);
+				*it = std::move(*(it + 1));
 			}
-			--size;
+			PopBack();
 
 			return location + 1;
 		}
 
+		// Remove the given element by moving the last element into its place.
+		// Faster than Erase, but does not keep the order of the elements.
+		Iterator SwapErase(Iterator location)
+		{
+			if (location == End())
+				return End();
+
+			if (location != End() - 1)
+				*location = std::move(Back());
+			PopBack();
+
+			return location;
+		}
+
 		// Get the position of the given element in the array.
 		// Returns an iterator equal to End if the item is not found.
 		Iterator Find(ConstValueReference item) const
@@ -200,7 +284,13 @@ namespace Beta
 		}
 
 		// Return a pointer to the underlying array data.
-		const ValuePointer Data() const
+		ValuePointer Data()
+		{
+			return data;
+		}
+
+		// Return a pointer to the underlying array data.
+		ConstValuePointer Data() const
 		{
 			return data;
 		}
@@ -248,6 +338,20 @@ namespace Beta
 			return *this;
 		}
 
+		Array& operator=(Array&& rhs)
+		{
+			if (this != &rhs)
+			{
+				Clear();
+				FreeData();
+				data = this->InlineData();
+				capacity = InlineCapacity;
+				TakeFrom(rhs);
+			}
+
+			return *this;
+		}
+
 		ConstValueReference operator[](size_t index) const
 		{
 			return data[index];
@@ -338,31 +442,64 @@ namespace Beta
 
 			// Re-allocate only if necessary
 			if (capacity < other.size)
+				MoveData(Allocate(other.size), other.size);
+
+			for (auto it = other.Begin(); it != other.End(); ++it)
+			{
+				::new (static_cast<void*>(data + size)) ValueType(*it);
+				++size;
+			}
+		}
+
+		// Take the data of another array, leaving it empty. This array must be empty.
+		void TakeFrom(Array& other)
+		{
+			// Memory can only be stolen if it isn't inside the other array
+			if (other.data != other.InlineData())
 			{
-				delete[] data;
-				capacity = other.size;
-				data = new ValueType[capacity];
+				data = other.data;
+				size = other.size;
+				capacity = other.capacity;
+
+				other.data = other.InlineData();
+				other.size = 0;
+				other.capacity = InlineCapacity;
+				return;
 			}
 
 			for (auto it = other.Begin(); it != other.End(); ++it)
 			{
-				PushBack(*it);
+				::new (static_cast<void*>(data + size)) ValueType(std::move(*it));
+				++size;
 			}
+			other.Clear();
+		}
+
+		// Get uninitialized memory for the given number of elements.
+		static ValuePointer Allocate(size_t count)
+		{
+			return static_cast<ValuePointer>(::operator new(count * sizeof(ValueType)));
 		}
 
-		// Increase the capacity of the array.
-		void Grow()
+		// Free the array's memory, unless it is inside the array itself.
+		void FreeData()
+		{
+			if (data != this->InlineData())
+				::operator delete(data);
+		}
+
+		// Move all elements into new memory and free the old memory.
+		void MoveData(ValuePointer newData, size_t newCapacity)
 		{
-			// Double capacity
-			capacity = capacity > 0 ? capacity * 2 : 1;
-			ValuePointer newData = new ValueType[capacity];
-			// Move data
 			for (size_t i = 0; i < size; ++i)
 			{
-				newData[i] = data[i];
+				::new (static_cast<void*>(newData + i)) ValueType(std::move(data[i]));
+				data[i].~ValueType();
 			}
-			delete[] data;
+			FreeData();
+
 			data = newData;
+			capacity = newCapacity;
 		}
 
 		//------------------------------------------------------------------------------
@@ -375,4 +512,6 @@ namespace Beta
 	};
 }
 
+#pragma pop_macro("new")
+
 //------------------------------------------------------------------------------
@@ -17,5 +17,6 @@
 // Systems
 #include <EngineCore.h>
 #include <FrameRateController.h>
+#include <Profiler.h>
 
 //------------------------------------------------------------------------------
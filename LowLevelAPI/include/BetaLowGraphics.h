@@ -15,10 +15,14 @@
 #include <GraphicsEngine.h>
 #include <MeshFactory.h>
 #include <ShaderProgram.h>
+#include <UniformBuffer.h>
+#include <SpriteBatch.h>
+#include <NullGraphics.h>
 #include <DebugDraw.h>
 
 // Resources
 #include <Texture.h>
+#include <TextureAtlas.h>
 #include <PostEffect.h>
 #include <Font.h>
 
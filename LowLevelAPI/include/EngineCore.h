@@ -18,6 +18,7 @@
 #include "BetaObject.h"
 
 #include <typeindex> // Comparing module types
+#include <utility>	 // forward
 #include "Array.h" // Array of modules
 #include "StartupSettings.h"
 
@@ -40,6 +41,7 @@ namespace Beta
 	class MeshFactory;
 
 	class FrameRateController;
+	class Profiler;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
@@ -64,12 +66,13 @@ namespace Beta
 		// Params:
 		//   ModuleType = A template parameter that specifies the class type
 		//      of the module being added to the engine.
+		//   args = Arguments passed to the module's constructor.
 		// Return:
 		//   A pointer to the module that was added to the engine.
-		template<class ModuleType>
-		ModuleType* AddModule()
+		template<class ModuleType, typename... Args>
+		ModuleType* AddModule(Args&&... args)
 		{
-			ModuleType* module = new ModuleType();
+			ModuleType* module = new ModuleType(std::forward<Args>(args)...);
 			module->SetOwner(this);
 			moduleMap.emplace(typeid(ModuleType), module);
 			moduleList.PushBack(module);
@@ -95,6 +98,7 @@ namespace Beta
 		// Getters for standard modules
         template<> DebugDraw* GetModule<DebugDraw>() { return debugDraw; }
 		template<> FrameRateController* GetModule<FrameRateController>() { return frameRateController; }
+		template<> Profiler* GetModule<Profiler>() { return profiler; }
 		template<> GraphicsEngine* GetModule<GraphicsEngine>() { return graphics; }
 		template<> Input* GetModule<Input>() { return input; }
 		template<> MeshFactory* GetModule<MeshFactory>() { return meshFactory; }
@@ -157,6 +161,7 @@ namespace Beta
 		ModuleMap moduleMap; // For retrieval
 		typedef Array<BetaObject*> ModuleList;
 		ModuleList moduleList; // For iterating
+		Array<unsigned> moduleZones; // Profiler zone for each module
 
 		// Assets directory
 		std::string assetsPath;
@@ -164,6 +169,9 @@ namespace Beta
 		// Should the program stop when escape is pressed?
 		bool closeOnEscape;
 
+		// Number of frames to run before stopping (0 for no limit)
+		unsigned long frameLimit;
+
 		// Standard modules - Declaration order here
 		// in class specifies ideal order of initialization.
 		WindowSystem* system;
@@ -172,6 +180,7 @@ namespace Beta
 		MeshFactory* meshFactory;
 		DebugDraw* debugDraw;
 		FrameRateController* frameRateController;
+		Profiler* profiler;
 	};
 }
 
@@ -47,11 +47,12 @@ namespace Beta
 		// Destroys font data via FreeType
 		BE_API ~Font();
 
-		// Draw text to the screen using this font.
+		// Draw text to the screen using this font. The whole string is drawn
+		// at once, and strings drawn in recent frames reuse their layout.
 		// (NOTE: Use SetTransform to define where the
 		// text should appear on screen, as well as its world scale.)
 		// Params:
-		//   text = The string of text that should be drawn.
+		//   text = The string of text that should be drawn (UTF-8).
 		BE_API void DrawText(const std::string& text) const;
 
 		// Return the filename of the font.
@@ -60,7 +61,13 @@ namespace Beta
 		// Return the size of the font.
 		BE_API unsigned GetSize() const;
 
-		// Load a font from a file
+		// Load a font from a file in the Fonts folder of the engine's file path.
+		// System font directories are not searched.
+		// Params:
+		//   filename = The name of the font file, relative to the Fonts folder.
+		//   size = The height of the font, in pixels.
+		// Returns:
+		//   The new font, or nullptr if the file could not be loaded.
 		BE_API static Font* CreateFontFromFile(const std::string& filename, unsigned size);
 
 		// The current relative path for loading fonts
@@ -25,6 +25,59 @@ namespace Beta
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// Source of real time for the frame rate controller. The default clock uses
+	// the system's monotonic clock; tests can supply their own clock to measure
+	// how accurately frames are paced without depending on the machine.
+	class BE_API FrameClock
+	{
+	public:
+		virtual ~FrameClock() {}
+
+		// Returns the current time in seconds. Must never go backwards.
+		virtual double GetTime() const = 0;
+
+		// Block the calling thread until the given time. May wake up late, but
+		// should never wake up early.
+		// Params:
+		//   time = The time to wait for, in seconds, as returned by GetTime.
+		virtual void SleepUntil(double time) = 0;
+	};
+
+	// Ways of waiting until it is time to start the next frame
+	enum BE_API PacingMode
+	{
+		// Sleep for the entire wait. Uses the least CPU time, but the operating
+		// system may wake the program up a millisecond or more too late.
+		PacingSleep,
+
+		// Sleep until shortly before the end of the frame, then check the time in a
+		// loop until the frame is over. Much more accurate, at the cost of a little
+		// CPU time each frame.
+		PacingHybrid,
+	};
+
+	// Statistics about the most recent frames. Times are in seconds.
+	struct BE_API FrameTimeStats
+	{
+		// Number of frames included in the statistics
+		unsigned frames;
+
+		// Time between the start of a frame and the start of the next
+		double average;
+		double min;
+		double max;
+		double median;
+		double percentile95;
+		double percentile99;
+
+		// Frames that ended noticeably later than the frame rate cap allows
+		unsigned missedDeadlines;
+
+		// How long waits lasted past the end of the frame
+		double averageOvershoot;
+		double maxOvershoot;
+	};
+
 	class BE_API FrameRateController
 	{
 	public:
@@ -39,7 +92,10 @@ namespace Beta
 		// frame rate controller.
 		// Params:
 		//   framerateCap = Maximum frames per second.
-		void Initialize(unsigned framerateCap = 200);
+		//   virtualClock = Whether every frame should last exactly 1 / framerateCap
+		//     seconds instead of measuring real time. The controller never waits
+		//     when using the virtual clock.
+		void Initialize(unsigned framerateCap = 200, bool virtualClock = false);
 
 		// End the current frame, updating the delta time and frame count. Frame 
 		// rate controller will wait until enough time has passed if an individual
@@ -59,7 +115,62 @@ namespace Beta
 		//   The total frames that have elapsed.
 		unsigned long GetFrameCount() const;
 
+		// Gets the real time spent on the previous frame, not including time spent
+		// waiting to limit the frame rate. Measured even when using the virtual clock.
+		// Returns:
+		//   The time in seconds spent processing the previous frame.
+		double GetCPUFrameTime() const;
+
+		// Set how the controller waits when a frame finishes early. Defaults to PacingHybrid.
+		// Params:
+		//   mode = The way to wait.
+		void SetPacingMode(PacingMode mode);
+
+		// Get how the controller waits when a frame finishes early.
+		PacingMode GetPacingMode() const;
+
+		// Set how long before the end of a frame the hybrid mode stops sleeping
+		// and starts checking the time in a loop. Defaults to 2 milliseconds.
+		// Params:
+		//   seconds = The length of the loop at the end of each frame.
+		void SetSpinTime(double seconds);
+
+		// Get how long before the end of a frame the hybrid mode stops sleeping.
+		double GetSpinTime() const;
+
+		// Replace the clock used to measure and wait for real time.
+		// (NOTE: The controller does not take ownership of the clock.)
+		// Params:
+		//   clock = The clock to use, or nullptr to use the system clock.
+		void SetClock(FrameClock* clock);
+
+		// Get statistics about the most recent frames (up to statsLength).
+		// Returns:
+		//   Frame times, percentiles, and missed deadlines.
+		FrameTimeStats GetFrameTimeStats() const;
+
+		// Forget the frames used by GetFrameTimeStats.
+		void ResetFrameTimeStats();
+
+		// Number of frames kept for statistics.
+		static const unsigned statsLength = 256;
+
 	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		// Timing of a single frame, kept for statistics
+		struct FrameRecord
+		{
+			// Time between the start of the frame and the start of the next
+			double time;
+			// How long the wait lasted past the end of the frame
+			double overshoot;
+			// Whether the controller limited the frame rate
+			bool paced;
+		};
+
 		//------------------------------------------------------------------------------
 		// Private Functions:
 		//------------------------------------------------------------------------------
@@ -67,6 +178,18 @@ namespace Beta
 		// Disable copy and assign to prevent accidental copies
 		FrameRateController(const FrameRateController&) = delete;
 		FrameRateController& operator=(const FrameRateController&) = delete;
+
+		// Wait until the given time using the current pacing mode.
+		// Params:
+		//   time = The time at which the next frame should start.
+		void WaitUntil(double time);
+
+		// Add the frame that just ended to the statistics.
+		// Params:
+		//   frameTime = The length of the frame.
+		//   paced = Whether the controller limited the frame rate.
+		//   overshoot = How long the wait lasted past the end of the frame.
+		void RecordFrame(double frameTime, bool paced, double overshoot);
 	
 		//------------------------------------------------------------------------------
 		// Private Variables:
@@ -86,6 +209,24 @@ namespace Beta
 		// Time passed between frames.
 		double deltaTime;
 
+		// Whether time advances by a fixed amount each frame.
+		bool virtualClock;
+
+		// Real time stamp from the start of the current frame.
+		double frameStartTime;
+		// Real time spent processing the previous frame.
+		double cpuFrameTime;
+
+		// Waiting
+		PacingMode pacingMode;
+		double spinTime;
+		FrameClock* clock;
+
+		// Recent frames, used as a ring buffer
+		FrameRecord frames[statsLength];
+		unsigned framesIndex;
+		unsigned framesCount;
+
 		// Test for vsync
 		GraphicsEngine* graphics; 
 	};
@@ -41,6 +41,9 @@ namespace Beta
 	class Renderer;
 	class PostEffect;
 	class ShaderProgram;
+	class UniformBuffer;
+	class Mesh;
+	struct SpriteBatchStats;
 	typedef FT_LibraryRec_ FontSystem;
 
 	//------------------------------------------------------------------------------
@@ -83,7 +86,9 @@ namespace Beta
 		GraphicsEngine();
 		~GraphicsEngine();
 
-		void Initialize(unsigned width, unsigned height);
+		// Params:
+		//   headless = Whether to use the null backend instead of an OpenGL context.
+		void Initialize(unsigned width, unsigned height, bool headless = false);
 		void FrameStart();
 		void FrameEnd();
 
@@ -113,10 +118,43 @@ namespace Beta
 		// Camera
 		Camera& GetDefaultCamera() const;
 
+		/////////////
+		// SPRITES //
+		/////////////
+
+		// Queue a sprite to be drawn by the sprite batch. Queued sprites are sorted by
+		// depth only, keeping submission order within each depth, and each run of
+		// consecutive sprites that share a mesh, texture, shader, and blend mode is
+		// drawn with a single instanced draw call. The current blend mode is used.
+		// Params:
+		//   mesh      = The mesh to draw for this sprite (usually a quad).
+		//   texture   = The texture to sample from.
+		//   transform = The world matrix of the sprite.
+		//   depth     = The z-depth of the sprite.
+		//   color     = The color to blend with the sprite's texture.
+		//   uvOffset  = The texture coordinate offset of the sprite's frame.
+		//   uvStride  = The size of a single frame in texture coordinates.
+		//   flipX     = Whether to flip the texture horizontally.
+		//   flipY     = Whether to flip the texture vertically.
+		void DrawSprite(const Mesh& mesh, const Texture& texture, const Matrix2D& transform,
+			float depth = 0.0f, const Color& color = Colors::White, const Vector2D& uvOffset = Vector2D(),
+			const Vector2D& uvStride = Vector2D(1.0f, 1.0f), bool flipX = false, bool flipY = false);
+
+		// Draw all queued sprites immediately. This is done automatically at the end
+		// of the frame, when the camera changes, and before anything is drawn with SetTransform.
+		void FlushSprites();
+
+		// Returns sprite and draw call counts for the most recently completed frame.
+		const SpriteBatchStats& GetSpriteBatchStats() const;
+
 		// Return the sprite shader (usually for the purpose of setting uniforms)
 		const ShaderProgram& GetSpriteShader() const;
 		// Return the font shader
 		const ShaderProgram& GetFontShader() const;
+		// Return the shader used for batched sprites
+		const ShaderProgram& GetSpriteBatchShader() const;
+		// Return the buffer for the CameraData uniform block shared by the sprite shaders
+		const UniformBuffer& GetCameraBuffer() const;
 
 		///////////////////////
 		// ADVANCED SETTINGS //
@@ -124,6 +162,8 @@ namespace Beta
 
 		// Set how sprites are blended
 		void SetBlendMode(BlendMode mode, bool forceSet = false);
+		// Get how sprites are currently blended
+		BlendMode GetBlendMode() const;
 
 		// Add a post-processing effect. Effects are applied sequentially,
 		// starting with the first that was added.
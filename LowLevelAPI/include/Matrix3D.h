@@ -29,19 +29,29 @@ namespace Beta
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// 4x4 matrix, stored inline in the same column-major layout as glm::mat4
+	// so that it can be used with GLM and sent to OpenGL without conversion.
 	struct BE_API Matrix3D
 	{
 	public:
-		Matrix3D();
-		Matrix3D(const Matrix3D& other);
+		// Constructors
+		Matrix3D(); // Defaults to identity
 		Matrix3D(const Matrix2D& m);
-		~Matrix3D();
 
-		void* data;
+		// Copying and moving never allocate
+		Matrix3D(const Matrix3D& other) = default;
+		Matrix3D(Matrix3D&& other) = default;
+		Matrix3D& operator=(const Matrix3D& rhs) = default;
+		Matrix3D& operator=(Matrix3D&& rhs) = default;
 
-	private:
-		// Deleted to prevent issues with pimpl.
-		Matrix3D& operator=(const Matrix3D& rhs) = delete;
+		// Operators
+		Matrix3D operator*(const Matrix3D& other) const; // Concatenates two matrices
+
+		// Other functions
+		Matrix3D Inverse() const; // Returns the inverse of this matrix
+
+		// Matrix data, indexed as data[column][row]
+		alignas(16) float data[4][4];
 	};
 }
 
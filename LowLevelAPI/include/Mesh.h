@@ -90,6 +90,7 @@ namespace Beta
 		BE_API void SetName(const std::string& name);
 
 		friend class MeshFactory;
+		friend class SpriteBatch;
 
 	private:
 		//------------------------------------------------------------------------------
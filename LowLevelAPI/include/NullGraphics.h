@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	NullGraphics.h
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Counters for the graphics calls made while the null backend is installed.
+	struct BE_API NullGraphicsStats
+	{
+		NullGraphicsStats();
+
+		// Total number of graphics calls of any kind.
+		unsigned long calls;
+		// Number of draw, clear, and blit calls.
+		unsigned long drawCalls;
+		// Number of instances drawn by instanced draw calls.
+		unsigned long instances;
+		// Number of calls that upload buffer data.
+		unsigned long bufferUploads;
+		// Number of calls that upload texture data.
+		unsigned long textureUploads;
+		// Number of uniform updates.
+		unsigned long uniformUpdates;
+		// Number of calls that bind objects or change pipeline state.
+		unsigned long stateChanges;
+		// Number of shaders, programs, buffers, textures, and other objects created.
+		unsigned long objectsCreated;
+		// Number of shaders, programs, buffers, textures, and other objects deleted.
+		unsigned long objectsDeleted;
+	};
+
+	// Graphics backend that does nothing except count calls. Used when the
+	// engine runs in headless mode, so that renderers, textures, meshes,
+	// shaders, and fonts can be used without a window or GPU.
+	namespace NullGraphics
+	{
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Route all OpenGL calls made by the engine to the null backend.
+		// Must be called instead of loading a real OpenGL context.
+		BE_API void Install();
+
+		// Test whether the null backend is currently installed.
+		BE_API bool IsInstalled();
+
+		// Get the counters for all calls made since the backend was installed
+		// or the counters were last reset.
+		BE_API const NullGraphicsStats& GetStats();
+
+		// Set all counters back to zero.
+		BE_API void ResetStats();
+	}
+}
+
+//------------------------------------------------------------------------------
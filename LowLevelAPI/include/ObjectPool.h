@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ObjectPool.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <Array.h>
+#include <string>	// Pool names
+#include <mutex>	// Allocation lock
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Snapshot of a pool's usage, for debugging and tuning.
+	struct BE_API PoolStats
+	{
+		std::string name;
+		size_t objectSize;
+		// Objects currently allocated from the pool
+		unsigned live;
+		// Most objects that have been allocated at the same time
+		unsigned peak;
+		// Slots ready to be reused without allocating
+		unsigned freeCount;
+		// Blocks of memory requested from the system
+		unsigned slabCount;
+	};
+
+	// Hands out fixed-size pieces of memory from large slabs. Freed pieces are
+	// kept on a list and reused by the next allocation, so objects that are
+	// created and destroyed often never go back to the system heap.
+	// Slabs are only released when the pool is destroyed.
+	class ObjectPool
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor - Creates an empty pool.
+		// Params:
+		//   name = The name shown in the pool's stats.
+		//   objectSize = The size of each piece of memory, in bytes.
+		//   objectsPerSlab = The number of objects in each slab.
+		BE_API ObjectPool(const std::string& name, size_t objectSize, unsigned objectsPerSlab = 64);
+
+		// Destructor - Frees all slabs, unless objects are still using them.
+		BE_API ~ObjectPool();
+
+		// Get memory for one object.
+		// Returns:
+		//   A pointer to uninitialized memory of at least the pool's object size.
+		BE_API void* Allocate();
+
+		// Return an object's memory to the pool.
+		// Params:
+		//   memory = A pointer returned by Allocate.
+		BE_API void Free(void* memory);
+
+		// Make sure a number of objects can be allocated without creating slabs.
+		// Params:
+		//   count = The number of objects.
+		BE_API void Reserve(unsigned count);
+
+		// Test whether memory came from this pool.
+		// Params:
+		//   memory = The memory to test.
+		BE_API bool Owns(const void* memory) const;
+
+		// Returns the size of each piece of memory in the pool.
+		BE_API size_t GetObjectSize() const;
+
+		// Returns the pool's current usage.
+		BE_API PoolStats GetStats() const;
+
+		// Get the usage of every pool that exists.
+		// Params:
+		//   stats = The array that the stats will be added to.
+		BE_API static void GetAllStats(Array<PoolStats>& stats);
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		// Stored in the memory of unused slots
+		struct FreeSlot
+		{
+			FreeSlot* next;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+
+		// Create a slab and add its slots to the free list. Lock must be held.
+		void AddSlab();
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		std::string name;
+		size_t objectSize;
+		unsigned objectsPerSlab;
+
+		Array<char*> slabs;
+		FreeSlot* freeList;
+		unsigned freeCount;
+		unsigned live;
+		unsigned peak;
+
+		mutable std::mutex mutex;
+
+		// All pools that exist, for GetAllStats
+		ObjectPool* nextPool;
+		ObjectPool* prevPool;
+	};
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	Profiler.h
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Array.h"
+#include <string>	// Zone names
+
+//------------------------------------------------------------------------------
+
+// Measure the time spent in the rest of the current scope on the CPU.
+// The name should be a string literal; zones with the same name are combined.
+// Params:
+//   name = The name of the zone, e.g. "Physics".
+#define PROFILE_SCOPE(name) \
+	static const unsigned PROFILE_CONCAT(profileZone, __LINE__) = Beta::Profiler::RegisterZone(name); \
+	Beta::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileZone, __LINE__))
+
+// Measure the time spent in the rest of the current scope on both the CPU and
+// the GPU. GPU times are only measured on the thread that owns the OpenGL context.
+// Params:
+//   name = The name of the zone, e.g. "PostEffects".
+#define PROFILE_GPU_SCOPE(name) \
+	static const unsigned PROFILE_CONCAT(profileZone, __LINE__) = Beta::Profiler::RegisterZone(name); \
+	Beta::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileZone, __LINE__), true)
+
+// Helpers for creating unique variable names
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Forward Declarations:
+	//------------------------------------------------------------------------------
+
+	class Font;
+	class Camera;
+
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Timings for a single zone over the recent frames. Times are in milliseconds
+	// per frame, and include the time spent in any zones nested inside this one.
+	struct BE_API ProfileZoneStats
+	{
+		std::string name;
+		// How deeply the zone was nested when it last ran (0 for outermost zones)
+		unsigned depth;
+		// CPU time spent in the zone each frame, added up across all threads
+		double cpuAverage;
+		double cpuMin;
+		double cpuMax;
+		// GPU time spent in the zone each frame (0 if it is not measured)
+		double gpuAverage;
+		// Average number of times the zone was entered each frame
+		double callsPerFrame;
+	};
+
+	// Records how long named parts of each frame take. Zones are marked with the
+	// PROFILE_SCOPE and PROFILE_GPU_SCOPE macros, and can be nested and used on
+	// any thread. Each thread writes its timings to its own buffer without
+	// locking, and the buffers are collected by the main thread at the end of
+	// each frame. GPU timings use OpenGL timer queries, which are read a few
+	// frames later so that the CPU never waits for the GPU. When there is no
+	// GPU (e.g. the null graphics backend is installed), only CPU times are kept.
+	class Profiler
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Consts:
+		//------------------------------------------------------------------------------
+
+		// Number of frames used for rolling statistics.
+		static const unsigned historyLength = 120;
+
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor
+		BE_API Profiler();
+
+		// Destructor - Releases timer queries.
+		BE_API ~Profiler();
+
+		// Choose a GPU timer. Must be called after the graphics engine has been initialized.
+		BE_API void Initialize();
+
+		// Collect the timings recorded by all threads during the frame and update
+		// the statistics. Should only be called by existing Low-Level API systems.
+		BE_API void FrameEnd();
+
+		// Draw the overlay, if it is enabled. Should only be called by existing Low-Level API systems.
+		BE_API void Draw();
+
+		// Enable or disable recording. Zones entered while disabled are ignored.
+		BE_API void SetEnabled(bool enabled);
+
+		// Are zones currently being recorded?
+		BE_API bool IsEnabled() const;
+
+		// Get the statistics for every zone that has been recorded.
+		// Params:
+		//   stats = The array that the stats will be added to, in the order the zones were registered.
+		BE_API void GetZoneStats(Array<ProfileZoneStats>& stats) const;
+
+		// Print the statistics for every zone to the console.
+		BE_API void PrintReport() const;
+
+		// Show or hide a list of zones and their times on top of the game. Bars are
+		// drawn with DebugDraw; names and times are only shown if a font has been set.
+		// Params:
+		//   enabled = Whether the overlay should be drawn.
+		BE_API void SetOverlayEnabled(bool enabled);
+
+		// Is the overlay being drawn?
+		BE_API bool IsOverlayEnabled() const;
+
+		// Set the font used to write zone names and times in the overlay.
+		// Params:
+		//   font = The font to use, or nullptr to only draw bars.
+		BE_API void SetOverlayFont(const Font* font);
+
+		// Keep every zone recorded during the next few frames so that they can be
+		// exported. Any previous capture is discarded.
+		// Params:
+		//   frames = The number of frames to capture.
+		BE_API void StartCapture(unsigned frames);
+
+		// Is a capture still in progress?
+		BE_API bool IsCapturing() const;
+
+		// Write the last capture to a file in the Chrome trace event format, which
+		// can be opened with chrome://tracing or https://ui.perfetto.dev.
+		// Params:
+		//   filename = The path of the file to write.
+		// Returns:
+		//   True if the file was written, false otherwise.
+		BE_API bool ExportChromeTrace(const std::string& filename) const;
+
+		// Are GPU times being measured?
+		BE_API bool HasGPUTimer() const;
+
+		// Returns the number of timings that were lost because a thread recorded
+		// more zones in a single frame than its buffer could hold.
+		BE_API unsigned long GetDroppedCount() const;
+
+		// Get the ID of a zone, registering it if needed. Used by the PROFILE_SCOPE macros.
+		// Params:
+		//   name = The name of the zone.
+		BE_API static unsigned RegisterZone(const std::string& name);
+
+		// Set the name shown for the calling thread in exported captures.
+		// Params:
+		//   name = The name of the thread, e.g. "Worker 1".
+		BE_API static void SetThreadName(const std::string& name);
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		class GPUTimer;
+		class GLTimer;
+
+		// Timings for a zone over the last few frames
+		struct ZoneHistory
+		{
+			ZoneHistory();
+
+			std::string name;
+			unsigned depth;
+			float cpuTime[historyLength];
+			float gpuTime[historyLength];
+			unsigned short calls[historyLength];
+
+			// Totals for the current frame
+			long long frameCPU;
+			long long frameGPU;
+			unsigned frameCalls;
+		};
+
+		// A captured timing, kept for exporting
+		struct CaptureSample
+		{
+			long long start;
+			long long end;
+			unsigned zoneID;
+			// Index of the thread, or gpuThread for GPU timings
+			unsigned thread;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		Profiler(const Profiler&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+
+		// Add a timing to the current frame's totals.
+		void AddSample(unsigned zoneID, unsigned depth, long long start, long long end, unsigned thread, bool gpu);
+
+		// Begin or end a GPU zone. Called by ProfileScope.
+		friend class ProfileScope;
+		void BeginGPUZone(unsigned zoneID, unsigned depth);
+		void EndGPUZone();
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		// Statistics for each zone, indexed by ID
+		Array<ZoneHistory*> zones;
+		unsigned historyIndex;
+		unsigned historyCount;
+
+		// Measures time on the GPU (does nothing when there is no GPU)
+		GPUTimer* gpuTimer;
+
+		// Captured timings
+		Array<CaptureSample> capture;
+		unsigned captureFramesLeft;
+
+		// Overlay
+		bool overlayEnabled;
+		const Font* overlayFont;
+		Camera* overlayCamera;
+	};
+
+	// Records the time between its construction and destruction as a zone.
+	// Use the PROFILE_SCOPE and PROFILE_GPU_SCOPE macros instead of creating these directly.
+	class ProfileScope
+	{
+	public:
+		// Enter a zone.
+		// Params:
+		//   zoneID = The ID returned by Profiler::RegisterZone.
+		//   gpu = Whether GPU time should also be measured.
+		BE_API ProfileScope(unsigned zoneID, bool gpu = false);
+
+		// Leave the zone, recording the time spent in it.
+		BE_API ~ProfileScope();
+
+	private:
+		// Disable copy and assign
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+		unsigned zoneID;
+		bool gpu;
+		long long start;
+	};
+}
+
+//------------------------------------------------------------------------------
@@ -31,11 +31,51 @@ namespace Beta
 	class Matrix2D;
 	struct Matrix3D;
 	struct Color;
+	class ShaderProgram;
 
 	//------------------------------------------------------------------------------
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// A uniform variable in a specific shader program. Programs find the locations
+	// of their uniforms when they are linked, so a handle can be obtained once and
+	// then used to set the uniform without looking it up by name.
+	class UniformHandle
+	{
+	public:
+		// Constructor - Creates a handle that does not refer to any uniform.
+		BE_API UniformHandle();
+
+		// Returns whether the handle refers to a uniform that can be set.
+		BE_API bool IsValid() const;
+
+	private:
+		friend class ShaderProgram;
+
+		// Constructor
+		// Params:
+		//   program = The id of the program that contains the uniform.
+		//   location = The location of the uniform in the program.
+		UniformHandle(unsigned program, int location);
+
+		unsigned program;
+		int location;
+	};
+
+	// Handles for the uniforms used by the engine's sprite and font shaders.
+	// Handles are invalid for any of these that a program doesn't use.
+	struct BE_API SpriteUniforms
+	{
+		UniformHandle worldMatrix;
+		UniformHandle uvOffset;
+		UniformHandle uvStride;
+		UniformHandle flipX;
+		UniformHandle flipY;
+		UniformHandle diffuse;
+		UniformHandle tintColor;
+		UniformHandle blendColor;
+	};
+
 	class ShaderProgram
 	{
 	public:
@@ -66,6 +106,34 @@ namespace Beta
 		BE_API void SetUniform(const std::string& name, const Array<Vector3D>& values) const;
 		BE_API void SetUniform(const std::string& name, const Array<Color>& values) const;
 
+		// Find a uniform variable so that it can be set without a lookup by name.
+		// Handles should be kept and reused rather than found every frame.
+		// Params:
+		//   name = The name of the uniform in the shaders.
+		// Returns:
+		//   A handle to the uniform, which is invalid if the program doesn't use it.
+		BE_API UniformHandle GetUniform(const std::string& name) const;
+
+		// Returns handles for the uniforms used by the engine's sprite shaders.
+		BE_API const SpriteUniforms& GetSpriteUniforms() const;
+
+		// Set values of uniform variables using handles from GetUniform
+		BE_API void SetUniform(const UniformHandle& uniform, int value) const;
+		BE_API void SetUniform(const UniformHandle& uniform, float value) const;
+		BE_API void SetUniform(const UniformHandle& uniform, bool value) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Vector2D& value) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Vector3D& value) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Color& value) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Matrix2D& value) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Matrix3D& value) const;
+
+		// Set values of uniform arrays using handles from GetUniform
+		BE_API void SetUniform(const UniformHandle& uniform, const Array<int>& values) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Array<float>& values) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Array<Vector2D>& values) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Array<Vector3D>& values) const;
+		BE_API void SetUniform(const UniformHandle& uniform, const Array<Color>& values) const;
+
 		// Operators
 		BE_API bool operator==(const ShaderProgram& other) const;
 
@@ -77,14 +145,65 @@ namespace Beta
 		//   A valid program if successful, nullptr if unsuccessful.
 		BE_API static ShaderProgram* CreateProgramFromFile(const std::string& vertexShaderFile, const std::string& fragmentShaderFile);
 
+		// Compile and link the program's shader files again, after they have changed.
+		// If the new shaders can't be compiled or linked, the old program is kept.
+		// Uniform values set on the old program are set again on the new one. The
+		// program gets a new id, so handles from GetUniform must be found again.
+		// Returns:
+		//   True if the program was rebuilt, false otherwise.
+		BE_API bool Reload();
+
+		// Rebuild every program that uses a shader file, after the file has changed.
+		// Params:
+		//   filename = The file name of the shader.
+		// Returns:
+		//   True if any program uses the file, false otherwise.
+		BE_API static bool ReloadFile(const std::string& filename);
+
 		// The current relative path for loading shaders.
 		BE_API static std::string shaderPath;
 
+		// Returns the number of uniform values and uniform buffer updates sent
+		// to the GPU during the most recently completed frame.
+		BE_API static unsigned GetUniformUploadCount();
+
 	private:
+		friend class GraphicsEngine;
+		friend class UniformBuffer;
+		friend class SpriteBatch;
+
 		//------------------------------------------------------------------------------
 		// Private Functions:
 		//------------------------------------------------------------------------------
 
+		// How a uniform value is sent to the GPU
+		enum UniformType
+		{
+			UT_None = 0,
+			UT_Int,
+			UT_Float,
+			UT_Vector2,
+			UT_Vector3,
+			UT_Vector4,
+			UT_Matrix3,
+			UT_Matrix4,
+		};
+
+		// The last value set for a uniform, kept so that it can be set again
+		// when the program is relinked by Reload.
+		struct UniformValue
+		{
+			UniformValue();
+
+			// Type of each element, or UT_None if the uniform hasn't been set
+			UniformType type;
+			// Number of elements, which is more than 1 for arrays
+			int count;
+			// Elements of int and bool uniforms
+			Array<int, 1> ints;
+			// Elements of all other uniforms
+			Array<float, 16> floats;
+		};
 
 		// Deleted functions
 		ShaderProgram(const ShaderProgram& other) = delete;
@@ -97,10 +216,43 @@ namespace Beta
 		//   pixelShader = The file name of the pixel shader.
 		ShaderProgram(unsigned id, const std::string& vertexShader, const std::string& pixelShader);
 
+		// Create a program from shader files and link it.
+		// Returns:
+		//   The id of the program, or 0 if it could not be compiled or linked.
+		static unsigned LinkProgramFromFiles(const std::string& vertexShaderFile, const std::string& fragmentShaderFile);
+
+		// Delete a program along with the shaders attached to it.
+		static void DeleteProgram(unsigned program);
+
+		// Find the locations of all active uniforms, and connect uniform
+		// blocks to their buffers. Called once after the program is linked.
+		void FindUniforms();
+
 		// Getting IDs of shader variables
 		int GetUniformLocation(const std::string& name) const;
+		int FindUniformLocation(const std::string& name) const;
 		int GetAttributeLocation(const std::string& name) const;
 
+		// Make the program current so that a uniform can be set, unless it already is.
+		// Returns false if the handle can't be used with this program.
+		bool BeginUpload(const UniformHandle& uniform) const;
+		// Start a new value for a uniform, replacing the one that was stored.
+		// The caller adds the elements and then sends it with UploadUniform.
+		UniformValue& StoreUniform(int location, UniformType type, int count) const;
+		// Send a stored value to a uniform. Must be called between BeginUpload and EndUpload.
+		void UploadUniform(int location, const UniformValue& value) const;
+		// Restore the program that was current before BeginUpload.
+		void EndUpload() const;
+
+		// Count a uniform value or buffer sent to the GPU.
+		static void CountUpload();
+		// Save the upload count for the frame that just ended and start a new count.
+		static void EndFrame();
+
+		// Make a program current by its id, e.g. to restore a program saved with
+		// glGetIntegerv. Keeps track of it so that uniform uploads restore it.
+		static void UseProgramID(unsigned programID);
+
 		// Loads shaders into OpenGL from strings/files
 		static bool AddShaderFromString(unsigned program, const std::string& source, int glType);
 		static bool AddShaderFromFile(unsigned program, const std::string& filename, int glType);
@@ -120,6 +272,15 @@ namespace Beta
         // Store locations for faster lookup
         mutable std::map<std::string, int> uniformLocations;
         mutable std::map<std::string, int> attributeLocations;
+
+		// Values set for uniforms, indexed by location
+		mutable Array<UniformValue> uniformValues;
+
+		SpriteUniforms spriteUniforms;
+
+		// All programs that exist, for ReloadFile
+		ShaderProgram* nextProgram;
+		ShaderProgram* prevProgram;
 	};
 }
 
@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	SpriteBatch.h
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Array.h"
+#include "GraphicsEngine.h" // BlendMode
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Forward Declarations:
+	//------------------------------------------------------------------------------
+
+	class Mesh;
+	class Texture;
+	class ShaderProgram;
+	class Matrix2D;
+	class Vector2D;
+	struct Color;
+
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Counters describing the work done by the sprite batch during a frame.
+	struct BE_API SpriteBatchStats
+	{
+		SpriteBatchStats();
+
+		// Number of sprites that were queued.
+		unsigned sprites;
+		// Number of times queued sprites were sorted and sent to the GPU.
+		unsigned batches;
+		// Number of instanced draw calls issued.
+		unsigned drawCalls;
+		// Number of times a different texture was bound between draw calls.
+		unsigned textureBinds;
+	};
+
+	// Collects sprites over the course of a frame, sorts them by depth, and
+	// draws each run of consecutive sprites that share a mesh, texture, shader,
+	// and blend mode with a single instanced draw call.
+	class SpriteBatch
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Ctors/Dtors
+		BE_API SpriteBatch();
+		BE_API ~SpriteBatch();
+
+		// Load the instancing shader and create the instance buffer.
+		BE_API void Init();
+
+		// Draw any remaining sprites and save the counters for the frame.
+		// Params:
+		//   graphics = The graphics engine, used to switch blend modes between batches.
+		BE_API void FrameEnd(GraphicsEngine& graphics);
+
+		// Queue a sprite for drawing.
+		// Params:
+		//   mesh      = The mesh to draw for this sprite (usually a quad).
+		//   texture   = The texture to sample from.
+		//   transform = The world matrix of the sprite.
+		//   depth     = The z-depth of the sprite. Lower values are drawn first.
+		//   color     = The color to blend with the sprite's texture.
+		//   uvOffset  = The texture coordinate offset of the sprite's frame.
+		//   uvStride  = The size of a single frame in texture coordinates.
+		//   flipX     = Whether to flip the texture horizontally.
+		//   flipY     = Whether to flip the texture vertically.
+		//   blendMode = The blend mode to use when drawing the sprite.
+		//   shader    = The program to use. Must accept the same instance attributes
+		//     as spriteShaderInstanced.vert. Uses the default program if null.
+		BE_API void Add(const Mesh& mesh, const Texture& texture, const Matrix2D& transform,
+			float depth, const Color& color, const Vector2D& uvOffset, const Vector2D& uvStride,
+			bool flipX, bool flipY, BlendMode blendMode, const ShaderProgram* shader = nullptr);
+
+		// Draw all queued sprites and empty the queue.
+		// Params:
+		//   graphics = The graphics engine, used to switch blend modes between batches.
+		BE_API void Flush(GraphicsEngine& graphics);
+
+		// Returns the number of sprites waiting to be drawn.
+		BE_API unsigned GetQueuedCount() const;
+
+		// Get the default instancing shader (usually for the purposes of setting uniforms)
+		BE_API const ShaderProgram& GetShader() const;
+
+		// Returns counters for the most recently completed frame.
+		BE_API const SpriteBatchStats& GetStats() const;
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		// Per-instance data, laid out exactly as it is uploaded to the GPU.
+		struct Instance
+		{
+			// Upper-left 2x2 block of the world matrix (column-major)
+			float basis[4];
+			// Translation x, y and z-depth
+			float translation[4];
+			// UV offset and stride, with flipping folded in
+			float uv[4];
+			// Blend color
+			float color[4];
+		};
+
+		// State used to order and group instances.
+		struct Command
+		{
+			float depth;
+			const ShaderProgram* shader;
+			int blendMode;
+			unsigned textureID;
+			const Mesh* mesh;
+			unsigned instanceIndex;
+
+			bool operator<(const Command& other) const;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		SpriteBatch(const SpriteBatch&) = delete;
+		SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+		// Point the instance attributes of the given mesh at the instance buffer.
+		void BindInstanceAttributes(const Mesh& mesh, unsigned firstInstance) const;
+
+		// Disable the instance attributes of the bound mesh so that it can still be
+		// drawn without instancing.
+		void UnbindInstanceAttributes() const;
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		// Default instancing shader
+		ShaderProgram* shader;
+
+		// Queued sprites
+		Array<Instance> instances;
+		Array<Command> commands;
+
+		// Instances in sorted order, ready for upload
+		Array<Instance> sortedInstances;
+
+		// Persistent instance buffer
+		unsigned instanceBuffer;
+		unsigned instanceBufferCapacity;
+
+		// Counters for the current and previous frames
+		SpriteBatchStats stats;
+		SpriteBatchStats frameStats;
+	};
+}
+
+//------------------------------------------------------------------------------
@@ -54,6 +54,11 @@ namespace Beta
 		bool closeOnEscape;
 		// Whether to synchronize sync the frame rate with the refresh rate. Defaults to true.
 		bool vSync;
+		// Whether to run without a window or GPU. Graphics calls are sent to a null backend
+		// and each frame advances time by exactly 1 / framerateCap. Defaults to false.
+		bool headless;
+		// Number of frames to run before stopping automatically. Defaults to 0 (no limit).
+		unsigned long frameLimit;
 	};
 }
 
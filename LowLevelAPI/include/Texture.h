@@ -45,6 +45,26 @@ namespace Beta
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// Decoded pixels from an image file, before they have been sent to the GPU.
+	struct BE_API TextureImage
+	{
+		// Creates an empty image.
+		TextureImage();
+
+		// Frees the pixel data.
+		~TextureImage();
+
+		unsigned char* pixels;	// Pixel data, one byte per channel.
+		int width;				// Width of the image in pixels.
+		int height;				// Height of the image in pixels.
+		int numChannels;		// Number of color channels (1 to 4).
+
+	private:
+		// Deleted to prevent freeing the pixels twice.
+		TextureImage(const TextureImage& rhs) = delete;
+		TextureImage& operator=(const TextureImage& rhs) = delete;
+	};
+
 	class Texture
 	{
 	public:
@@ -81,15 +101,56 @@ namespace Beta
 		BE_API void Use(unsigned spriteColumns, unsigned spriteRows, bool flipX, bool flipY, 
 			const Vector2D& uvOffset, const ShaderProgram* shader = nullptr) const;
 
+		// Set this as the active texture.
+		// Params:
+		//   uvOffset		= The texture coordinate offset to use when rendering.
+		//   uvStride		= The size of the area to draw in texture coordinates.
+		//	 flipX			= Whether to flip the texture horizontally when drawing.
+		//	 flipY			= Whether to flip the texture vertically when drawing.
+		//   shader			= The shader that will be using this texture. Defaults to sprite shader if parameter is null.
+		BE_API void Use(const Vector2D& uvOffset, const Vector2D& uvStride, bool flipX, bool flipY,
+			const ShaderProgram* shader = nullptr) const;
+
 		// Returns the name of the texture.
 		BE_API const std::string& GetName() const;
 		// Returns the ID of the texture buffer in OpenGL.
 		BE_API unsigned GetBufferID() const;
 
+		// Replace the contents of this texture with a decoded image.
+		// Params:
+		//   image = The image to upload.
+		//   mode = The filtering mode to use for the texture.
+		// Returns:
+		//   True if the image was uploaded, false if its format is not supported.
+		BE_API bool SetImage(const TextureImage& image, TextureFilterMode mode = TM_Nearest);
+
+		// Replace part of this texture with new pixels.
+		// Params:
+		//   pixels = The pixel data, one byte per channel.
+		//   width, height = The size of the area to replace, in pixels.
+		//   numChannels = The number of color channels in the pixel data (1 to 4).
+		//   x, y = The top-left corner of the area to replace.
+		// Returns:
+		//   True if the pixels were uploaded, false if their format is not supported.
+		BE_API bool SetSubImage(const unsigned char* pixels, int width, int height, int numChannels, int x, int y);
+
 		// Loads a texture from a file
 		BE_API static Texture* CreateTextureFromFile(const std::string& filename,
 			TextureFilterMode mode = TM_Nearest);
 
+		// Creates an RGBA texture whose pixels will be filled in later with SetSubImage.
+		BE_API static Texture* CreateEmptyTexture(unsigned width, unsigned height,
+			const std::string& name = "", TextureFilterMode mode = TM_Nearest);
+
+		// Reads and decodes an image file without creating a texture.
+		// Does not use OpenGL, so it is safe to call from worker threads.
+		// Params:
+		//   filename = The name of the file, relative to the texture path.
+		//   image = (Out) The decoded image.
+		// Returns:
+		//   True if the image was loaded, false otherwise.
+		BE_API static bool LoadImageFromFile(const std::string& filename, TextureImage& image);
+
 		// The current relative path for loading textures
 		static std::string texturePath;
 
@@ -109,6 +170,13 @@ namespace Beta
 		void CreateTextureFromArray(const Array<Color>& colors, size_t width,
 			size_t height, TextureFilterMode mode = TM_Nearest);
 
+		// Returns the OpenGL format for pixel data with the given number of channels, or 0 if there is none.
+		static unsigned GetChannelFormat(int numChannels);
+
+		// Uploads pixel data to a new OpenGL texture, replacing the current one.
+		bool UploadImage(const unsigned char* pixels, int width, int height,
+			int numChannels, TextureFilterMode mode);
+
 		// Loads a red-channel texture from an array of unsigned chars.
 		void CreateRedTextureFromArray(const unsigned char* buffer, size_t width,
 			size_t height, TextureFilterMode mode = TM_Nearest);
@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	TextureAtlas.h
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "Array.h"
+#include "Vector2D.h"
+#include "Texture.h"	// TextureFilterMode, TextureImage
+
+#include <map>		// Regions by name
+#include <memory>	// shared_ptr
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// Where an image was placed in an atlas.
+	struct BE_API AtlasRegion
+	{
+		AtlasRegion();
+
+		// The page texture that contains the image.
+		std::shared_ptr<const Texture> page;
+		// Texture coordinates of the image's top-left corner in the page.
+		Vector2D uvOffset;
+		// Size of the image in texture coordinates.
+		Vector2D uvSize;
+	};
+
+	// How well images have been packed into an atlas.
+	struct BE_API AtlasStats
+	{
+		AtlasStats();
+
+		// Number of page textures.
+		unsigned pages;
+		// Number of images that have been packed.
+		unsigned images;
+		// Number of pixels covered by images (not counting padding).
+		unsigned long usedPixels;
+		// Number of pixels in all pages.
+		unsigned long totalPixels;
+		// Fraction of page pixels covered by images, from 0 to 1.
+		float efficiency;
+	};
+
+	// Packs many images into a few large page textures, so that sprites using
+	// different images can still be drawn without switching textures. Images are
+	// placed with the skyline bottom-left method, and their edge pixels are copied
+	// into the padding around them so that filtering doesn't pick up neighbors.
+	class TextureAtlas
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor - Creates an empty atlas. Pages are created as needed.
+		// Params:
+		//   pageSize = The width and height of each page, in pixels.
+		//   padding = The number of pixels to leave around each image.
+		//   mode = The filtering mode to use for the page textures.
+		BE_API TextureAtlas(unsigned pageSize = 2048, unsigned padding = 2, TextureFilterMode mode = TM_Nearest);
+
+		// Pack an image into the atlas. Must be called on the main thread.
+		// Params:
+		//   name = The name used to find the image later.
+		//   image = The image to pack.
+		//   region = (Out) Where the image was placed.
+		// Returns:
+		//   True if the image was packed (or already had been), false if it is too large for a page.
+		BE_API bool Add(const std::string& name, const TextureImage& image, AtlasRegion& region);
+
+		// Find an image that was already packed.
+		// Params:
+		//   name = The name given to Add.
+		//   region = (Out) Where the image was placed.
+		// Returns:
+		//   True if the image is in the atlas, false otherwise.
+		BE_API bool Find(const std::string& name, AtlasRegion& region) const;
+
+		// Returns how well images have been packed so far.
+		BE_API AtlasStats GetStats() const;
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
+		// A horizontal segment of the top edge of the space used in a page
+		struct SkylineNode
+		{
+			unsigned x;
+			unsigned y;
+			unsigned width;
+		};
+
+		struct Page
+		{
+			std::shared_ptr<Texture> texture;
+			Array<SkylineNode> skyline;
+		};
+
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+		// Find the lowest place in a page where a rectangle fits, and reserve it.
+		// Params:
+		//   page = The page to search.
+		//   width, height = The size of the rectangle, including padding.
+		//   x, y = (Out) The top-left corner of the reserved space.
+		// Returns:
+		//   True if the rectangle fits, false otherwise.
+		bool Insert(Page& page, unsigned width, unsigned height, unsigned& x, unsigned& y) const;
+
+		// Find the top of the skyline under a rectangle that starts at a node.
+		// Returns false if the rectangle would stick out of the page.
+		bool Fit(const Page& page, unsigned index, unsigned width, unsigned height, unsigned& y) const;
+
+		// Add an empty page.
+		Page& AddPage();
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		unsigned pageSize;
+		unsigned padding;
+		TextureFilterMode mode;
+
+		Array<Page> pages;
+		std::map<std::string, AtlasRegion> regions;
+		unsigned long usedPixels;
+	};
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	UniformBuffer.h
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include <string>
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Structures:
+	//------------------------------------------------------------------------------
+
+	// GPU memory for the values in a uniform block, e.g.
+	//
+	//   layout (std140) uniform CameraData { mat4 projectionMatrix; mat4 viewMatrix; };
+	//
+	// Every shader program that declares a block with the buffer's name reads
+	// from the same buffer, so shared values only need to be sent once instead
+	// of once per program. Data must follow the std140 layout rules.
+	class UniformBuffer
+	{
+	public:
+		//------------------------------------------------------------------------------
+		// Public Functions:
+		//------------------------------------------------------------------------------
+
+		// Constructor - Creates the buffer and assigns it a binding point.
+		// Programs linked after this will use the buffer for the block automatically.
+		// Params:
+		//   blockName = The name of the uniform block in the shaders.
+		//   size = The size of the block, in bytes.
+		BE_API UniformBuffer(const std::string& blockName, size_t size);
+
+		// Destructor - Frees the buffer and its binding point.
+		BE_API ~UniformBuffer();
+
+		// Send data to part of the buffer.
+		// Params:
+		//   data = The values to send.
+		//   size = The number of bytes to send.
+		//   offset = Where the data starts in the block, in bytes.
+		BE_API void SetData(const void* data, size_t size, size_t offset = 0) const;
+
+		// Returns the name of the uniform block.
+		BE_API const std::string& GetBlockName() const;
+
+		// Returns the binding point used by the buffer.
+		BE_API unsigned GetBindingPoint() const;
+
+		// Find the binding point of a buffer by its block name.
+		// Params:
+		//   blockName = The name of the uniform block in the shaders.
+		//   bindingPoint = Set to the binding point if a buffer is found.
+		// Returns:
+		//   True if a buffer exists for the block, false otherwise.
+		BE_API static bool FindBindingPoint(const std::string& blockName, unsigned& bindingPoint);
+
+	private:
+		//------------------------------------------------------------------------------
+		// Private Functions:
+		//------------------------------------------------------------------------------
+
+		// Disable copy and assign to prevent accidental copies
+		UniformBuffer(const UniformBuffer&) = delete;
+		UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+		//------------------------------------------------------------------------------
+		// Private Variables:
+		//------------------------------------------------------------------------------
+
+		std::string blockName;
+		size_t size;
+		unsigned id;
+		unsigned bindingPoint;
+	};
+}
+
+//------------------------------------------------------------------------------
@@ -29,21 +29,23 @@ namespace Beta
 	// Public Structures:
 	//------------------------------------------------------------------------------
 
+	// 3D vector, stored inline in the same layout as glm::vec3.
 	struct BE_API Vector3D
 	{
 	public:
 		Vector3D();
-		Vector3D(const Vector3D& other);
 		Vector3D(float value);
 		Vector3D(float x, float y, float z);
 		Vector3D(const Vector2D& v, float z = 0.0f);
-		~Vector3D();
 
-		void* data;
+		// Copying and moving never allocate
+		Vector3D(const Vector3D& other) = default;
+		Vector3D(Vector3D&& other) = default;
+		Vector3D& operator=(const Vector3D& rhs) = default;
+		Vector3D& operator=(Vector3D&& rhs) = default;
 
-	private:
-		// Deleted to prevent issues with pimpl.
-		Vector3D& operator=(const Vector3D& rhs) = delete;
+		// Components x, y, and z
+		float data[3];
 	};
 }
 
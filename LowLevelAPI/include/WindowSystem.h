@@ -61,6 +61,9 @@ namespace Beta
 		// Does the window for this program still exist?
 		bool DoesWindowExist() const;
 
+		// Is the engine running without a window?
+		bool IsHeadless() const;
+
 		// Test whether the application is in fullscreen mode.
 		bool IsFullScreen() const;
 		// Set whether the window is fullscreen.
@@ -27,10 +27,16 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "Matrix3D.h"
+#include "Vector3D.h"
 
 inline glm::mat4& GlmMatrix(const Beta::Matrix3D& m)
 {
-	return static_cast<glm::mat4&>(*static_cast<glm::mat4*>(m.data));
+	return reinterpret_cast<glm::mat4&>(const_cast<Beta::Matrix3D&>(m).data);
+}
+
+inline glm::vec3& GlmVector(const Beta::Vector3D& v)
+{
+	return reinterpret_cast<glm::vec3&>(const_cast<Beta::Vector3D&>(v).data);
 }
 
 #pragma warning(pop)
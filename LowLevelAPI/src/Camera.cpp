@@ -25,7 +25,7 @@
 #include "Matrix2D.h"
 
 // Systems
-#include "ShaderProgram.h"	// SetUniform
+#include "UniformBuffer.h"	// SetData
 #include "EngineCore.h"		// GetModule
 #include "GraphicsEngine.h" // GetViewport
 
@@ -123,7 +123,7 @@ namespace Beta
 			glm::vec3 eye(translation.x, translation.y, distance);
 			glm::vec3 target(translation.x, translation.y, 0.0f);
 
-			glm::mat4& view = static_cast<glm::mat4&>(*static_cast<glm::mat4*>(viewMatrix.data));
+			glm::mat4& view = GlmMatrix(viewMatrix);
 			view = glm::lookAt(eye, target, up);
 
 			isDirtyView = false;
@@ -198,13 +198,14 @@ namespace Beta
 
 	void Camera::Use() const
 	{
-		const ShaderProgram* program = &EngineGetModule(GraphicsEngine)->GetSpriteShader();
-		program->SetUniform("projectionMatrix", pimpl->GetProjectionMatrix());
-		program->SetUniform("viewMatrix", pimpl->GetViewMatrix());
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
 
-		program = &EngineGetModule(GraphicsEngine)->GetFontShader();
-		program->SetUniform("projectionMatrix", pimpl->GetProjectionMatrix());
-		program->SetUniform("viewMatrix", pimpl->GetViewMatrix());
+		// Queued sprites must be drawn with the camera that was active when they were queued
+		graphics.FlushSprites();
+
+		// All sprite shaders read the matrices from the same CameraData block
+		glm::mat4 matrices[2] = { GlmMatrix(pimpl->GetProjectionMatrix()), GlmMatrix(pimpl->GetViewMatrix()) };
+		graphics.GetCameraBuffer().SetData(matrices, sizeof(matrices));
 	}
 
 	const Vector2D& Camera::GetTranslation() const
@@ -24,6 +24,7 @@
 #include "MeshFactory.h"	// Constructor
 #include "DebugDraw.h"	// Draw
 #include "FrameRateController.h" // GetFrameTime, FrameEnd
+#include "Profiler.h"	// PROFILE_SCOPE, FrameEnd
 
 #define VK_ESCAPE 0
 //------------------------------------------------------------------------------
@@ -40,20 +41,25 @@ namespace Beta
 	void EngineCore::Start(const Beta::StartupSettings& settings)
 	{
 		closeOnEscape = settings.closeOnEscape;
+		frameLimit = settings.frameLimit;
 
 		// Initialize the WindowSystem (Windows, Message Handlers)
 		system->Initialize(settings);
 
 		// Init graphics
 		const Vector2D& resolution = system->GetResolution(); // NOTE: WindowSystem may have changed resolution during initialization
-		graphics->Initialize(static_cast<unsigned>(resolution.x), static_cast<unsigned>(resolution.y));
+		graphics->Initialize(static_cast<unsigned>(resolution.x), static_cast<unsigned>(resolution.y), settings.headless);
 		graphics->SetUseVSync(settings.vSync);
 
 		// Init debug draw
 		debugDraw->Initialize();
 
-		// Initialize the frame rate controller.
-		frameRateController->Initialize(settings.framerateCap);
+		// Initialize the frame rate controller. Headless runs use a virtual clock
+		// so that every run sees the same sequence of frame times.
+		frameRateController->Initialize(settings.framerateCap, settings.headless);
+
+		// Init profiler, which needs graphics to know whether GPU timers exist
+		profiler->Initialize();
 
 		// Initialize custom engine modules
 		Initialize();
@@ -125,9 +131,9 @@ namespace Beta
 
 	// Constructor is private to prevent accidental instantiation
 	EngineCore::EngineCore()
-		: BetaObject("EngineCore"), isRunning(true), assetsPath("Assets/"), closeOnEscape(true),
+		: BetaObject("EngineCore"), isRunning(true), assetsPath("Assets/"), closeOnEscape(true), frameLimit(0),
 		system(nullptr), input(nullptr), graphics(nullptr), meshFactory(nullptr), debugDraw(nullptr),
-			frameRateController(nullptr)
+			frameRateController(nullptr), profiler(nullptr)
 	{
 		// Initialize random number generator
 		Random::Init();
@@ -147,11 +153,17 @@ namespace Beta
 
 		// Create the frame rate controller.
 		frameRateController = new FrameRateController();
+
+		// Create the profiler.
+		profiler = new Profiler();
 	}
 
 	// Ditto for destructor
 	EngineCore::~EngineCore()
 	{
+		// Shutdown profiler while graphics still exist
+		delete profiler;
+
 		// Shutdown FRC
 		delete frameRateController;
 
@@ -182,42 +194,76 @@ namespace Beta
 	//	 dt = Change in time (in seconds) since the last game loop.
 	void EngineCore::Update(float dt)
 	{
-		// Handling Input
-		input->Update();
+		// Give each module its own zone
+		while (moduleZones.Size() < moduleList.Size())
+			moduleZones.PushBack(Profiler::RegisterZone(moduleList[moduleZones.Size()]->GetName()));
 
-		// Tell graphics module that a new frame is starting
-		graphics->FrameStart();
-
-		// Update extra modules
-		//size_t numModules = modules.Size();
-		//for (size_t i = 0; i < numModules; ++i)
-		for (auto it = moduleList.Begin(); it != moduleList.End(); ++it)
 		{
-			(*it)->Update(dt);
-		}
+			PROFILE_SCOPE("Frame");
 
-		// Draw extra modules
-		//for (size_t i = 0; i < numModules; ++i)
-		for (auto it = moduleList.Begin(); it != moduleList.End(); ++it)
-		{
-			(*it)->Draw();
-		}
+			{
+				PROFILE_SCOPE("Input");
+
+				// Handling Input
+				input->Update();
+			}
 
-		// Draw debug lines
-		debugDraw->Draw();
+			// Tell graphics module that a new frame is starting
+			graphics->FrameStart();
 
-		// Swap buffers
-		graphics->FrameEnd();
+			{
+				PROFILE_SCOPE("Update");
 
-		// Complete the draw process for the current game loop.
-		system->Draw();
+				// Update extra modules
+				for (size_t i = 0; i < moduleList.Size(); ++i)
+				{
+					ProfileScope moduleScope(moduleZones[i]);
+					moduleList[i]->Update(dt);
+				}
+			}
+
+			{
+				PROFILE_GPU_SCOPE("Draw");
+
+				// Draw extra modules
+				for (size_t i = 0; i < moduleList.Size(); ++i)
+				{
+					ProfileScope moduleScope(moduleZones[i]);
+					moduleList[i]->Draw();
+				}
+
+				// Draw profiler overlay
+				profiler->Draw();
+
+				// Draw debug lines
+				debugDraw->Draw();
+
+				// Draw queued sprites and post effects
+				graphics->FrameEnd();
+			}
+
+			{
+				PROFILE_SCOPE("Swap");
+
+				// Complete the draw process for the current game loop.
+				system->Draw();
+			}
+
+			{
+				PROFILE_SCOPE("Sleep");
+
+				// Sleep
+				frameRateController->FrameEnd();
+			}
+		}
 
-		// Sleep
-		frameRateController->FrameEnd();
+		// Collect timings for this frame
+		profiler->FrameEnd();
 
 		// Check if forcing the application to quit
 		if ((closeOnEscape && input->CheckTriggered(VK_ESCAPE))
-			|| !system->DoesWindowExist())
+			|| !system->DoesWindowExist()
+			|| (frameLimit != 0 && frameRateController->GetFrameCount() >= frameLimit))
 		{
 			Stop();
 		}
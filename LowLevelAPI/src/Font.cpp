@@ -5,7 +5,7 @@
 // Project:		Beta Engine
 // Course:		WANIC VGP2
 //
-// Copyright � 2019 DigiPen (USA) Corporation.
+// Copyright  2019 DigiPen (USA) Corporation.
 //
 //------------------------------------------------------------------------------
 
@@ -20,28 +20,29 @@
 #include <glad.h>
 #include "../../glfw/src/glfw3.h"
 
-// Windows
-// No ^
-//#include <Shlobj.h> // GetKnownFolderPath
-
 // Font loading
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
 // Resources
 #include <MeshFactory.h>
+#include "Mesh.h"		// Draw
+#include "Texture.h"	// Use
+#include "Vertex.h"
 
 // Systems
 #include "EngineCore.h"		// GetModule, GetFilePath
 #include "GraphicsEngine.h" // GetFontSystem
 #include "ShaderProgram.h"	// Use, SetUniform
 
+#include <unordered_map>	// extendedGlyphs, layouts
+
 //------------------------------------------------------------------------------
 
 namespace Beta
 {
 		//------------------------------------------------------------------------------
-		// Private Structures:
+		// Private Consts:
 		//------------------------------------------------------------------------------
 
 		std::string Font::fontPath = "Fonts/";
@@ -49,6 +50,29 @@ namespace Beta
 		static const int numCharacters = 128;
 		typedef FT_FaceRec_ FontFace;
 
+		// Codepoints below this are found by indexing a table rather than a hash map
+		static const unsigned glyphTableSize = 256;
+
+		// Values in the glyph table for glyphs that have no index
+		static const int glyphNotLoaded = -1;
+		static const int glyphMissing = -2;
+
+		// Used in place of a glyph index for line breaks
+		static const int glyphNewLine = -3;
+
+		// Empty pixels around each glyph in the atlas, so that neighbors don't bleed
+		static const unsigned glyphPadding = 1;
+
+		// Smallest width and height of a glyph atlas, in pixels
+		static const unsigned minAtlasSize = 256;
+
+		// Number of strings whose meshes are kept between draws
+		static const size_t maxCachedLayouts = 64;
+
+		//------------------------------------------------------------------------------
+		// Private Structures:
+		//------------------------------------------------------------------------------
+
 		// Many values in FreeType are stored as sub-pixels, i.e. 1 / 64 pixels
 		// Bitshift by 6 to get value in pixels (2^6 = 64)
 		inline unsigned SubPixelsToPixels(int value)
@@ -56,69 +80,381 @@ namespace Beta
 			return value >> 6;
 		}
 
-		// Represents a character texture loaded from a font file
-		struct Character
+		// Decodes the UTF-8 character starting at the given position. Bytes that are
+		// not valid UTF-8 are treated as single Latin-1 characters.
+		// Params:
+		//   text = The string being decoded.
+		//   position = The index of the first byte. Advanced past the character.
+		// Returns:
+		//   The codepoint of the character.
+		static unsigned DecodeCodepoint(const std::string& text, size_t& position)
 		{
-			//------------------------------------------------------------------------------
-			// Public Variables:
-			//------------------------------------------------------------------------------
+			unsigned char lead = static_cast<unsigned char>(text[position++]);
+			unsigned length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+			if (length == 0 || position + length > text.size())
+				return lead;
+
+			unsigned codepoint = lead & (0x3F >> length);
+			for (unsigned i = 0; i < length; ++i)
+			{
+				unsigned char next = static_cast<unsigned char>(text[position + i]);
+				if ((next & 0xC0) != 0x80)
+					return lead;
+				codepoint = (codepoint << 6) | (next & 0x3F);
+			}
 
-			Texture* texture;	 // Texture used for this character.
+			position += length;
+			return codepoint;
+		}
+
+		// Represents a character that has been packed into the glyph atlas
+		struct Glyph
+		{
+			unsigned x;			 // Left of glyph in atlas, in pixels
+			unsigned y;			 // Top of glyph in atlas, in pixels
+			unsigned width;		 // Width of glyph bitmap, in pixels
+			unsigned height;	 // Height of glyph bitmap, in pixels
 			Vector2D size;       // Size of glyph
 			Vector2D bearing;    // Offset from baseline to left/top of glyph
 			Vector2D advance;    // Offset to advance to next glyph
 			FT_UInt glyphIndex;  // Index of the glyph for this character.
+		};
 
-			//------------------------------------------------------------------------------
-			// Public Functions:
-			//------------------------------------------------------------------------------
-
-			Character(Texture* texture, const Vector2D& size, const Vector2D& bearing,
-				Vector2D advance, FT_UInt glyphIndex)
-				: texture(texture), size(size), bearing(bearing), advance(advance), glyphIndex(glyphIndex)
-			{
-			}
-
-			~Character()
-			{
-				delete texture;
-			}
-
-			// Disable copy constructor and assignment
-			Character(const Character& other) = delete;
-			Character& operator=(const Character& other) = delete;
+		// Mesh for a string that has already been laid out
+		struct TextLayout
+		{
+			Mesh* mesh;					// Null if the string has no visible glyphs
+			unsigned atlasRevision;		// Atlas size the texture coordinates were made for
+			unsigned long lastUsed;		// Draw count when the layout was last used
 		};
-		typedef std::map<char, Character*> CharacterMap;
+		typedef std::unordered_map<std::string, TextLayout> LayoutMap;
 
 		class Font::Implementation
 		{
 		public:
 			Implementation(const std::string& filename, unsigned size, FontFace* face)
-				: filename(filename), size(size), characterMesh(nullptr), face(face),
-				hasKerning(FT_HAS_KERNING(face)), graphics(*EngineGetModule(GraphicsEngine))
+				: filename(filename), size(size), face(face), hasKerning(FT_HAS_KERNING(face)),
+				atlasWidth(0), atlasHeight(0), penX(glyphPadding), penY(glyphPadding), rowHeight(0),
+				atlas(nullptr), atlasGrown(true), atlasRevision(0), drawCount(0),
+				graphics(*EngineGetModule(GraphicsEngine))
 			{
-				characterMesh = EngineGetModule(MeshFactory)->CreateQuadMesh(Vector2D(1, 1), Vector2D(0.5f, 0.5f));
+				glyphTable.Resize(glyphTableSize);
+				for (unsigned i = 0; i < glyphTableSize; ++i)
+					glyphTable[i] = glyphNotLoaded;
+
+				// Start with enough room for the basic ASCII set
+				atlasWidth = minAtlasSize;
+				while (atlasWidth < size * 12)
+					atlasWidth *= 2;
+				atlasHeight = atlasWidth;
+				atlasPixels.Resize(atlasWidth * atlasHeight);
+				memset(atlasPixels.Data(), 0, atlasPixels.Size());
+				ClearDirtyRegion();
 			}
 
 			~Implementation()
 			{
-				for (auto it = characters.begin(); it != characters.end(); ++it)
+				for (auto it = layouts.begin(); it != layouts.end(); ++it)
 				{
-					delete it->second;
+					delete it->second.mesh;
 				}
 
-				delete characterMesh;
+				delete atlas;
 
 				// Unload font face now that we've gotten the data we need
 				FT_Done_Face(face);
 			}
 
+			// Find the glyph for a codepoint, loading it into the atlas if needed.
+			// Returns:
+			//   The index of the glyph, or glyphMissing if it could not be loaded.
+			int FindGlyph(unsigned codepoint)
+			{
+				if (codepoint < glyphTableSize)
+				{
+					if (glyphTable[codepoint] == glyphNotLoaded)
+						glyphTable[codepoint] = LoadGlyph(codepoint);
+					return glyphTable[codepoint];
+				}
+
+				auto location = extendedGlyphs.find(codepoint);
+				if (location != extendedGlyphs.end())
+					return location->second;
+
+				int index = LoadGlyph(codepoint);
+				extendedGlyphs.emplace(codepoint, index);
+				return index;
+			}
+
+			// Render a glyph with FreeType and pack it into the atlas.
+			int LoadGlyph(unsigned codepoint)
+			{
+				// Load character glyph
+				FT_UInt glyphIndex = FT_Get_Char_Index(face, codepoint);
+				if (FT_Load_Glyph(face, glyphIndex, FT_LOAD_RENDER) != FT_Success)
+				{
+					std::cout << "ERROR: Failed to load glyph " << codepoint << " in font " << filename << std::endl;
+					return glyphMissing;
+				}
+
+				const FT_Bitmap& bitmap = face->glyph->bitmap;
+
+				Glyph glyph;
+				glyph.width = bitmap.width;
+				glyph.height = bitmap.rows;
+				glyph.glyphIndex = glyphIndex;
+				PackGlyph(bitmap, glyph);
+
+				// Pre-calculate some values
+				float sizeFloat = static_cast<float>(size);
+				unsigned advanceX = SubPixelsToPixels(face->glyph->advance.x);
+				unsigned advanceY = face->glyph->advance.y == 0 ? size
+					: SubPixelsToPixels(face->glyph->advance.y);
+
+				glyph.size = Vector2D(static_cast<float>(bitmap.width), static_cast<float>(bitmap.rows)) / sizeFloat;
+				glyph.bearing = Vector2D(static_cast<float>(face->glyph->bitmap_left),
+					static_cast<float>(face->glyph->bitmap_top)) / sizeFloat;
+				glyph.advance = Vector2D(static_cast<float>(advanceX), static_cast<float>(advanceY)) / sizeFloat;
+
+				glyphs.PushBack(glyph);
+				return static_cast<int>(glyphs.Size() - 1);
+			}
+
+			// Find space for a glyph in the atlas (left to right in rows) and copy its pixels there.
+			void PackGlyph(const FT_Bitmap& bitmap, Glyph& glyph)
+			{
+				if (glyph.width == 0 || glyph.height == 0)
+				{
+					glyph.x = glyph.y = 0;
+					return;
+				}
+
+				// Start a new row if this one is full
+				if (penX + glyph.width + glyphPadding > atlasWidth)
+				{
+					penX = glyphPadding;
+					penY += rowHeight + glyphPadding;
+					rowHeight = 0;
+				}
+
+				// Grow downward so that existing glyphs keep their pixel positions
+				unsigned newHeight = atlasHeight;
+				while (penY + glyph.height + glyphPadding > newHeight)
+					newHeight *= 2;
+				if (newHeight != atlasHeight)
+				{
+					atlasPixels.Resize(atlasWidth * newHeight);
+					memset(atlasPixels.Data() + atlasWidth * atlasHeight, 0, atlasWidth * (newHeight - atlasHeight));
+					atlasHeight = newHeight;
+					atlasGrown = true;
+
+					// Texture coordinates of existing layouts are no longer valid
+					++atlasRevision;
+				}
+
+				glyph.x = penX;
+				glyph.y = penY;
+				penX += glyph.width + glyphPadding;
+				rowHeight = std::max(rowHeight, glyph.height);
+
+				for (unsigned row = 0; row < glyph.height; ++row)
+				{
+					memcpy(&atlasPixels[(glyph.y + row) * atlasWidth + glyph.x],
+						bitmap.buffer + row * bitmap.pitch, glyph.width);
+				}
+
+				dirtyLeft = std::min(dirtyLeft, glyph.x);
+				dirtyTop = std::min(dirtyTop, glyph.y);
+				dirtyRight = std::max(dirtyRight, glyph.x + glyph.width);
+				dirtyBottom = std::max(dirtyBottom, glyph.y + glyph.height);
+			}
+
+			// Upload the glyphs that have been added since the atlas was last used.
+			// The texture is only created again when the atlas has grown.
+			void UpdateAtlas()
+			{
+				if (atlasGrown)
+				{
+					delete atlas;
+					atlas = new Texture(atlasPixels.Data(), atlasWidth, atlasHeight, filename + " atlas");
+					atlasGrown = false;
+				}
+				else if (dirtyLeft < dirtyRight && dirtyTop < dirtyBottom)
+				{
+					// Copy the changed area into its own buffer, since uploads must be tightly packed
+					unsigned width = dirtyRight - dirtyLeft;
+					unsigned height = dirtyBottom - dirtyTop;
+					uploadPixels.Resize(width * height);
+					for (unsigned row = 0; row < height; ++row)
+					{
+						memcpy(&uploadPixels[row * width],
+							&atlasPixels[(dirtyTop + row) * atlasWidth + dirtyLeft], width);
+					}
+
+					atlas->SetSubImage(uploadPixels.Data(), width, height, 1, dirtyLeft, dirtyTop);
+				}
+
+				ClearDirtyRegion();
+			}
+
+			// Mark the whole atlas as uploaded.
+			void ClearDirtyRegion()
+			{
+				dirtyLeft = atlasWidth;
+				dirtyTop = atlasHeight;
+				dirtyRight = 0;
+				dirtyBottom = 0;
+			}
+
+			// Retrieve the mesh for a string, creating it if it is not cached.
+			TextLayout& GetLayout(const std::string& text)
+			{
+				auto location = layouts.find(text);
+				if (location != layouts.end() && location->second.atlasRevision == atlasRevision)
+				{
+					location->second.lastUsed = drawCount;
+					return location->second;
+				}
+
+				if (location == layouts.end())
+				{
+					// Make room by discarding the layout that has gone unused the longest
+					if (layouts.size() >= maxCachedLayouts)
+					{
+						auto oldest = layouts.begin();
+						for (auto it = layouts.begin(); it != layouts.end(); ++it)
+						{
+							if (it->second.lastUsed < oldest->second.lastUsed)
+								oldest = it;
+						}
+						delete oldest->second.mesh;
+						layouts.erase(oldest);
+					}
+
+					TextLayout newLayout = { nullptr, 0, 0 };
+					location = layouts.emplace(text, newLayout).first;
+				}
+
+				TextLayout& layout = location->second;
+				delete layout.mesh;
+				layout.mesh = BuildMesh(text);
+				layout.atlasRevision = atlasRevision;
+				layout.lastUsed = drawCount;
+				return layout;
+			}
+
+			// Create a mesh containing a quad for each visible character in a string.
+			Mesh* BuildMesh(const std::string& text)
+			{
+				// Find all glyphs first, since loading them can resize the atlas
+				Array<int> indices;
+				indices.Reserve(text.size());
+				for (size_t i = 0; i < text.size(); )
+				{
+					unsigned codepoint = DecodeCodepoint(text, i);
+					indices.PushBack(codepoint == '\n' ? glyphNewLine : FindGlyph(codepoint));
+				}
+
+				int newLineGlyph = FindGlyph('\n');
+				float lineAdvance = newLineGlyph >= 0 ? glyphs[newLineGlyph].advance.y : 1.0f;
+
+				// Positions of characters relative to each other
+				Vector2D offset;
+				FT_UInt previousGlyph = 0;
+				float fontSizeFloat = static_cast<float>(size);
+				Vector2D texelSize(1.0f / atlasWidth, 1.0f / atlasHeight);
+				MeshFactory& meshFactory = *EngineGetModule(MeshFactory);
+				unsigned numVertices = 0;
+
+				for (size_t i = 0; i < indices.Size(); ++i)
+				{
+					// New line! Advance to next line using advance.y.
+					if (indices[i] == glyphNewLine)
+					{
+						offset.x = 0.0f;
+						offset.y -= lineAdvance;
+						previousGlyph = 0;
+						continue;
+					}
+
+					if (indices[i] == glyphMissing)
+						continue;
+
+					const Glyph& glyph = glyphs[indices[i]];
+
+					// Incorporate kerning BEFORE making the quad
+					if (hasKerning && previousGlyph != 0)
+					{
+						FT_Vector kerning;
+						FT_Get_Kerning(face, previousGlyph, glyph.glyphIndex, FT_KERNING_DEFAULT, &kerning);
+						offset.x += static_cast<float>(SubPixelsToPixels(kerning.x)) / fontSizeFloat;
+					}
+					previousGlyph = glyph.glyphIndex;
+
+					if (glyph.width != 0 && glyph.height != 0)
+					{
+						Vector2D position = offset;
+						position.x += glyph.bearing.x;
+						position.y -= (glyph.size.y - glyph.bearing.y);
+
+						// The top row of the bitmap is at the top of the quad
+						float left = glyph.x * texelSize.x;
+						float right = (glyph.x + glyph.width) * texelSize.x;
+						float top = glyph.y * texelSize.y;
+						float bottom = (glyph.y + glyph.height) * texelSize.y;
+
+						Vertex bottomLeft(position, Vector2D(left, bottom));
+						Vertex bottomRight(Vector2D(position.x + glyph.size.x, position.y), Vector2D(right, bottom));
+						Vertex topLeft(Vector2D(position.x, position.y + glyph.size.y), Vector2D(left, top));
+						Vertex topRight(position + glyph.size, Vector2D(right, top));
+
+						meshFactory.AddTriangle(bottomLeft, bottomRight, topLeft);
+						meshFactory.AddTriangle(bottomRight, topRight, topLeft);
+						numVertices += 6;
+					}
+
+					// Now advance cursors for next glyph
+					offset.x += glyph.advance.x;
+				}
+
+				if (numVertices == 0)
+					return nullptr;
+
+				return meshFactory.EndCreate();
+			}
+
 			std::string filename;
 			unsigned size;
-			CharacterMap characters;
-			Mesh* characterMesh;
 			FontFace* face;
 			bool hasKerning;
+
+			// Glyph lookup
+			Array<Glyph> glyphs;
+			Array<int> glyphTable;
+			std::unordered_map<unsigned, int> extendedGlyphs;
+
+			// Glyph atlas
+			Array<unsigned char> atlasPixels;
+			unsigned atlasWidth;
+			unsigned atlasHeight;
+			unsigned penX;
+			unsigned penY;
+			unsigned rowHeight;
+			Texture* atlas;
+			bool atlasGrown;
+			unsigned atlasRevision;
+
+			// Area of the atlas with glyphs that have not been uploaded yet
+			unsigned dirtyLeft;
+			unsigned dirtyTop;
+			unsigned dirtyRight;
+			unsigned dirtyBottom;
+			Array<unsigned char> uploadPixels;
+
+			// Cached strings
+			LayoutMap layouts;
+			unsigned long drawCount;
+
 			GraphicsEngine& graphics;
 		private:
 		};
@@ -139,84 +475,23 @@ namespace Beta
 		//   text = The string of text that should be drawn.
 		void Font::DrawText(const std::string& text) const
 		{
-			UNREFERENCED_PARAMETER(text);
-
-			// Activate corresponding render state
-			GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
-			const ShaderProgram& fontShader = graphics.GetFontShader();
-			fontShader.Use();
+			++pimpl->drawCount;
 
-			// Positions of characters relative to each other
-			Vector2D offset;
+			// Lay out the string, or reuse the layout from a previous draw
+			const TextLayout& layout = pimpl->GetLayout(text);
+			pimpl->UpdateAtlas();
 
-			// Record glyph for kerning
-			FT_Vector kerning;
-			kerning.x = 0; kerning.y = 0;
-			unsigned previousGlyph = 0;
-			float fontSizeFloat = static_cast<float>(pimpl->size);
+			// Nothing visible
+			if (layout.mesh == nullptr)
+				return;
 
-			// Iterate through all characters
-			std::string::const_iterator c;
-			for (c = text.begin(); c != text.end(); c++)
-			{
-				Character& ch = *pimpl->characters[*c];
-
-				if (*c != '\n')
-				{
-					Vector2D meshSize = ch.size;
-
-					// Get kerning information
-					if (pimpl->hasKerning)
-					{
-						FT_UInt currentGlyph = ch.glyphIndex;
-						if (previousGlyph != 0)
-						{
-							FT_Get_Kerning(pimpl->face, previousGlyph, currentGlyph,
-								FT_KERNING_DEFAULT, &kerning);
-							kerning.x = SubPixelsToPixels(kerning.x);
-						}
-						previousGlyph = currentGlyph;
-					}
-
-					// Incorporate kerning BEFORE making the mesh
-					offset.x += static_cast<float>(kerning.x) / fontSizeFloat;
-
-					Vector2D position = offset;
-					position.x += ch.bearing.x;
-					position.y -= (ch.size.y - ch.bearing.y);
-
-					// Calculate vertices for character
-					const size_t numVertices = 6;
-					Vector2D positions[numVertices] = {
-						position,
-						{ position.x + meshSize.x, position.y },
-						{ position.x, position.y + meshSize.y },
-
-						{ position.x + meshSize.x, position.y },
-						{ position.x + meshSize.x, position.y + meshSize.y },
-						{ position.x, position.y + meshSize.y },
-					};
-
-					// Update VBO with new vertices
-					pimpl->characterMesh->UpdatePositionBuffer(positions);
-
-					// Use the appropriate texture
-					ch.texture->Use(Vector2D(), &fontShader);
-
-					// Draw the character using the given mesh
-					pimpl->characterMesh->Draw();
+			// Activate corresponding render state
+			const ShaderProgram& fontShader = pimpl->graphics.GetFontShader();
+			fontShader.Use();
+			pimpl->atlas->Use(Vector2D(), &fontShader);
 
-					// Now advance cursors for next glyph
-					offset.x += ch.advance.x;
-				}
-				else
-				{
-					// New line! Advance to next line using advance.y.
-					offset.x = 0.0f;
-					offset.y -= ch.advance.y;
-					previousGlyph = 0;
-				}
-			}
+			// Draw every character at once
+			layout.mesh->Draw();
 		}
 
 		const std::string& Font::GetName() const
@@ -236,89 +511,31 @@ namespace Beta
 			GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
 			FontSystem* system = graphics.GetFontSystem();
 
-            //TODO: FIND FONTS
-
-			// Get system font path
-			//PWSTR cWStringPath = nullptr;
-			//PSTR systemFontPath = nullptr;
-			//SHGetKnownFolderPath(FOLDERID_Fonts, 0, nullptr, &cWStringPath);
-			// Convert from wstring to string
-			/*int pathSize = WideCharToMultiByte(CP_ACP, 0, cWStringPath, -1, nullptr, 0, nullptr, nullptr);
-			int totalSize = static_cast<int>(pathSize + filename.size() + 1);
-            freetype_
-			systemFontPath = new char[totalSize];
-			WideCharToMultiByte(CP_ACP, 0, cWStringPath, -1, systemFontPath, totalSize, nullptr, nullptr);
-			CoTaskMemFree(cWStringPath);
-			// Add slash and null terminator
-			systemFontPath[pathSize - 1] = '\\';
-			systemFontPath[totalSize - 1] = '\0';
-			// Append filename
-			memcpy(systemFontPath + pathSize, filename.c_str(), filename.size() * sizeof(char));
-
-			// Attempt to load font file from system directory first
-			if (FT_New_Face(system, systemFontPath, 0, &face) != FT_Success)
+			// Load font file from engine font directory. System fonts are not searched,
+			// so games ship every font they use.
+			std::string filePath = EngineCore::GetInstance().GetFilePath() + fontPath + filename;
+			if (FT_New_Face(system, filePath.c_str(), 0, &face) != FT_Success)
 			{
-				// Failing that, try engine font directory
-				std::string filePath = EngineCore::GetInstance().GetFilePath() + fontPath + filename;
-				if (FT_New_Face(system, filePath.c_str(), 0, &face) != FT_Success)
-				{
-					std::cout << "ERROR: Failed to load font " << filename << std::endl;
-					return nullptr;
-				}
+				std::cout << "ERROR: Failed to load font " << filename << std::endl;
+				return nullptr;
 			}
-			delete[] systemFontPath;
 
 			// Set size
 			if (FT_Set_Pixel_Sizes(face, 0, size) != FT_Success)
 			{
 				std::cout << "ERROR: Failed to set font size for font " << filename << std::endl;
+				FT_Done_Face(face);
 				return nullptr;
 			}
 
 			Font* font = new Font(filename, size, face);
-			CharacterMap& characters = font->pimpl->characters;
 
-			// Load basic ASCII set
-
-			// Disable byte-alignment restriction; characters don't line up nicely.
-			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
-			for (GLubyte c = 0; c < numCharacters; c++)
+			// Load basic ASCII set. Other characters are added to the atlas when first drawn.
+			for (int c = 0; c < numCharacters; c++)
 			{
-				// Load character glyph
-				FT_UInt glyphIndex = FT_Get_Char_Index(face, c);
-				if (FT_Load_Glyph(face, glyphIndex, FT_LOAD_RENDER) != FT_Success)
-				{
-					std::cout << "ERROR: Failed to load glyph " << c << " in font " << filename << std::endl;
-					continue;
-				}
-				// Generate texture
-				Texture* texture = new Texture(face->glyph->bitmap.buffer,
-					face->glyph->bitmap.width, face->glyph->bitmap.rows, filename
-					+ " " + static_cast<char>(c));
-
-				// Pre-calculate some values
-				float sizeFloat = static_cast<float>(size);
-				unsigned advanceX = SubPixelsToPixels(face->glyph->advance.x);
-				unsigned advanceY = face->glyph->advance.y == 0 ? size
-					: SubPixelsToPixels(face->glyph->advance.y);
-
-				// Now store character for later use
-				Character* character = new Character(texture,
-					Vector2D(static_cast<float>(face->glyph->bitmap.width),
-						static_cast<float>(face->glyph->bitmap.rows)) / sizeFloat,
-					Vector2D(static_cast<float>(face->glyph->bitmap_left),
-						static_cast<float>(face->glyph->bitmap_top)) / sizeFloat,
-					Vector2D(static_cast<float>(advanceX), static_cast<float>(advanceY)) / sizeFloat,
-					glyphIndex
-				);
-
-				characters.emplace(c, character);
+				font->pimpl->FindGlyph(c);
 			}
 
-			// Set alignment back to normal (4 bytes)
-			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-
 			// Return the (hopefully) complete font
 			return font;
 		}
@@ -329,7 +546,7 @@ namespace Beta
 
 		Font::Font(const std::string& filename, unsigned size, FontFace* face)
 			: pimpl(new Implementation(filename, size, face))
-		{*/
+		{
 		}
 }
 
@@ -18,8 +18,10 @@
 
 #include "EngineCore.h" // GetModule
 #include "GraphicsEngine.h" // GetUseVsync
-#include "../../glfw/src/glfw3.h"
-#include <unistd.h>
+#include <time.h>		// clock_gettime, clock_nanosleep
+#include <errno.h>		// EINTR
+#include <thread>		// yield
+#include <algorithm>	// sort
 
 //------------------------------------------------------------------------------
 
@@ -31,6 +33,46 @@ namespace Beta
 
 	const double averageFrameRate = 60.0;
 	const double millisecondsPerSecond = 1000.0;
+	const double nanosecondsPerSecond = 1000000000.0;
+
+	// Default length of the loop at the end of a frame in hybrid mode
+	const double defaultSpinTime = 0.002;
+
+	// How late a frame can end before it counts as a missed deadline
+	const double deadlineTolerance = 0.0005;
+
+	//------------------------------------------------------------------------------
+	// Private Structures:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Clock that uses CLOCK_MONOTONIC, which is not affected by changes to the system time.
+		class SystemClock : public FrameClock
+		{
+		public:
+			double GetTime() const override
+			{
+				timespec now;
+				clock_gettime(CLOCK_MONOTONIC, &now);
+				return now.tv_sec + now.tv_nsec / nanosecondsPerSecond;
+			}
+
+			void SleepUntil(double time) override
+			{
+				timespec wakeTime;
+				wakeTime.tv_sec = static_cast<time_t>(time);
+				wakeTime.tv_nsec = static_cast<long>((time - wakeTime.tv_sec) * nanosecondsPerSecond);
+
+				// Sleeping until an absolute time means that interruptions can simply retry
+				while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, nullptr) == EINTR)
+				{
+				}
+			}
+		};
+
+		SystemClock systemClock;
+	}
 
 	//------------------------------------------------------------------------------
 	// Public Functions:
@@ -39,7 +81,10 @@ namespace Beta
 	// Constructor
 	FrameRateController::FrameRateController()
 		: currTime(0), prevTime(0), frameCount(0),
-		minDeltaTime(1.0 / averageFrameRate), deltaTime(minDeltaTime), graphics(nullptr)
+		minDeltaTime(1.0 / averageFrameRate), deltaTime(minDeltaTime), virtualClock(false),
+		frameStartTime(0), cpuFrameTime(0),
+		pacingMode(PacingHybrid), spinTime(defaultSpinTime), clock(&systemClock),
+		frames(), framesIndex(0), framesCount(0), graphics(nullptr)
 	{
 	}
 
@@ -48,8 +93,11 @@ namespace Beta
 	// frame does not take enough time.
 	// Params:
 	//   framerateCap = Maximum frames per second.
-	void FrameRateController::Initialize(unsigned framerateCap)
+	//   virtualClock = Whether every frame should last exactly 1 / framerateCap seconds.
+	void FrameRateController::Initialize(unsigned framerateCap, bool virtualClock_)
 	{
+		virtualClock = virtualClock_;
+
 		// Set minimum dt based on provided max rate - at least 1 ms
 		minDeltaTime = std::max(1.0 / static_cast<double>(framerateCap), 1.0 / millisecondsPerSecond);
 
@@ -57,10 +105,13 @@ namespace Beta
 		deltaTime = 1.0 / framerateCap;
 
 		// Store times
-		currTime = prevTime = glfwGetTime();
+		currTime = prevTime = virtualClock ? 0.0 : clock->GetTime();
+		frameStartTime = clock->GetTime();
+		cpuFrameTime = 0.0;
 
 		// Initialize ongoing counters
 		frameCount = 0;
+		ResetFrameTimeStats();
 
 		graphics = EngineGetModule(GraphicsEngine);
 	}
@@ -68,24 +119,42 @@ namespace Beta
 	// End the current frame, updating the delta time.
 	void FrameRateController::FrameEnd()
 	{
-		// Frame rate limiting - wait if necessary
-		currTime = glfwGetTime();
-		if (!graphics->GetUseVsync() && currTime - prevTime < minDeltaTime)
+		// Measure work done this frame before any waiting
+		cpuFrameTime = clock->GetTime() - frameStartTime;
+
+		bool paced = false;
+		double overshoot = 0.0;
+
+		if (virtualClock)
 		{
-			usleep(((prevTime + minDeltaTime) - currTime) * millisecondsPerSecond * 10);
+			// Advance by exactly one frame, regardless of how long the frame took
+			currTime = prevTime + minDeltaTime;
 		}
+		else
+		{
+			// Frame rate limiting - wait if necessary
+			double deadline = prevTime + minDeltaTime;
+			paced = graphics == nullptr || !graphics->GetUseVsync();
+			if (paced && clock->GetTime() < deadline)
+			{
+				WaitUntil(deadline);
+				overshoot = clock->GetTime() - deadline;
+			}
 
-		// Get the current system time
-		currTime = glfwGetTime();
+			// Get the current system time
+			currTime = clock->GetTime();
+		}
 
 		// Calculate dt based on current and previous frame time
 		deltaTime = currTime - prevTime;
+		RecordFrame(deltaTime, paced, overshoot);
 
 		// Update ongoing counters
 		frameCount++;
 
 		// Store previous time
 		prevTime = currTime;
+		frameStartTime = clock->GetTime();
 	}
 
 	// Gets the frame time from Beta Framework.
@@ -106,6 +175,147 @@ namespace Beta
 	{
 		return frameCount;
 	}
+
+	// Gets the real time spent on the previous frame, not including time spent
+	// waiting to limit the frame rate. Measured even when using the virtual clock.
+	// Returns:
+	//   The time in seconds spent processing the previous frame.
+	double FrameRateController::GetCPUFrameTime() const
+	{
+		return cpuFrameTime;
+	}
+
+	// Set how the controller waits when a frame finishes early.
+	// Params:
+	//   mode = The way to wait.
+	void FrameRateController::SetPacingMode(PacingMode mode)
+	{
+		pacingMode = mode;
+	}
+
+	// Get how the controller waits when a frame finishes early.
+	PacingMode FrameRateController::GetPacingMode() const
+	{
+		return pacingMode;
+	}
+
+	// Set how long before the end of a frame the hybrid mode stops sleeping
+	// and starts checking the time in a loop.
+	// Params:
+	//   seconds = The length of the loop at the end of each frame.
+	void FrameRateController::SetSpinTime(double seconds)
+	{
+		spinTime = std::max(seconds, 0.0);
+	}
+
+	// Get how long before the end of a frame the hybrid mode stops sleeping.
+	double FrameRateController::GetSpinTime() const
+	{
+		return spinTime;
+	}
+
+	// Replace the clock used to measure and wait for real time.
+	// Params:
+	//   clock = The clock to use, or nullptr to use the system clock.
+	void FrameRateController::SetClock(FrameClock* clock_)
+	{
+		clock = clock_ != nullptr ? clock_ : &systemClock;
+
+		// Times from the old clock can't be compared with the new one
+		currTime = prevTime = virtualClock ? prevTime : clock->GetTime();
+		frameStartTime = clock->GetTime();
+	}
+
+	// Get statistics about the most recent frames (up to statsLength).
+	// Returns:
+	//   Frame times, percentiles, and missed deadlines.
+	FrameTimeStats FrameRateController::GetFrameTimeStats() const
+	{
+		FrameTimeStats stats = {};
+		stats.frames = framesCount;
+		if (framesCount == 0)
+			return stats;
+
+		double times[statsLength];
+		unsigned pacedFrames = 0;
+		for (unsigned i = 0; i < framesCount; ++i)
+		{
+			const FrameRecord& frame = frames[i];
+			times[i] = frame.time;
+			stats.average += frame.time;
+
+			if (!frame.paced)
+				continue;
+
+			++pacedFrames;
+			stats.averageOvershoot += frame.overshoot;
+			stats.maxOvershoot = std::max(stats.maxOvershoot, frame.overshoot);
+			if (frame.time > minDeltaTime + deadlineTolerance)
+				++stats.missedDeadlines;
+		}
+
+		stats.average /= framesCount;
+		if (pacedFrames != 0)
+			stats.averageOvershoot /= pacedFrames;
+
+		// Percentiles use the nearest frame at or below the given rank
+		std::sort(times, times + framesCount);
+		stats.min = times[0];
+		stats.max = times[framesCount - 1];
+		stats.median = times[(framesCount - 1) / 2];
+		stats.percentile95 = times[(framesCount - 1) * 95 / 100];
+		stats.percentile99 = times[(framesCount - 1) * 99 / 100];
+
+		return stats;
+	}
+
+	// Forget the frames used by GetFrameTimeStats.
+	void FrameRateController::ResetFrameTimeStats()
+	{
+		framesIndex = 0;
+		framesCount = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Wait until the given time using the current pacing mode.
+	// Params:
+	//   time = The time at which the next frame should start.
+	void FrameRateController::WaitUntil(double time)
+	{
+		if (pacingMode == PacingSleep)
+		{
+			clock->SleepUntil(time);
+			return;
+		}
+
+		// Sleep through most of the wait, since the OS may wake us up late
+		if (clock->GetTime() < time - spinTime)
+			clock->SleepUntil(time - spinTime);
+
+		// Spin for the rest
+		while (clock->GetTime() < time)
+			std::this_thread::yield();
+	}
+
+	// Add the frame that just ended to the statistics.
+	// Params:
+	//   frameTime = The length of the frame.
+	//   paced = Whether the controller limited the frame rate.
+	//   overshoot = How long the wait lasted past the end of the frame.
+	void FrameRateController::RecordFrame(double frameTime, bool paced, double overshoot)
+	{
+		FrameRecord& frame = frames[framesIndex];
+		frame.time = frameTime;
+		frame.overshoot = overshoot;
+		frame.paced = paced;
+
+		framesIndex = (framesIndex + 1) % statsLength;
+		if (framesCount < statsLength)
+			++framesCount;
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -33,7 +33,10 @@
 // BETA LOW-LEVEL
 // Systems
 #include "ShaderProgram.h"	// SetUniform
+#include "UniformBuffer.h"	// Camera matrices
 #include "Renderer.h"
+#include "SpriteBatch.h"	// Add, Flush
+#include "NullGraphics.h"	// Install
 
 // Math
 #include "Vector2D.h"	// for texture coordinates
@@ -171,7 +174,7 @@ namespace Beta
 		Implementation();
 		~Implementation();
 
-		void Initialize();
+		void Initialize(bool headless);
 
 		// Viewport clear color
 		void SetBackgroundColor(const Color& color = Colors::Black);
@@ -215,9 +218,12 @@ namespace Beta
 
 		// Renderer
 		Renderer renderer;
+		SpriteBatch spriteBatch;
+		UniformBuffer* cameraBuffer;
 
 		// Settings
 		bool useVsync;
+		bool headless;
 
 		// Fonts
 		FontSystem* fontSystem;
@@ -237,10 +243,10 @@ namespace Beta
 		pimpl = new Implementation();
 	}
 
-	void GraphicsEngine::Initialize(unsigned width, unsigned height)
+	void GraphicsEngine::Initialize(unsigned width, unsigned height, bool headless)
 	{
 		// Initialize OpenGL
-		pimpl->Initialize();
+		pimpl->Initialize(headless);
 
 #if BE_GL_4_3_API
 		// Error handling
@@ -274,12 +280,17 @@ namespace Beta
 
 	void GraphicsEngine::FrameEnd()
 	{
+		// Draw any sprites that are still queued
+		pimpl->spriteBatch.FrameEnd(*this);
+
 		// Wait till OpenGL is done and swap the frame buffer
 		pimpl->renderer.FrameEnd();
 
 		// Unbind current texture (if any)
 		glBindTexture(GL_TEXTURE_2D, 0);
 
+		ShaderProgram::EndFrame();
+
 		CheckForOpenGLErrors();
 	}
 
@@ -313,6 +324,11 @@ namespace Beta
 		pimpl->SetBlendMode(mode, forceSet);
 	}
 
+	BlendMode GraphicsEngine::GetBlendMode() const
+	{
+		return pimpl->blendMode;
+	}
+
 	const Texture& GraphicsEngine::GetDefaultTexture() const
 	{
 		return *pimpl->defaultTexture;
@@ -320,14 +336,18 @@ namespace Beta
 
 	void GraphicsEngine::SetTransform(const Matrix2D& matrix, float depth)
 	{
+		// Something is about to be drawn without batching, so draw queued sprites first
+		FlushSprites();
+
 		// Convert 2D matrix to 3D matrix
 		Matrix3D worldMatrix(matrix);
-		glm::mat4& world = static_cast<glm::mat4&>(*static_cast<glm::mat4*>(worldMatrix.data));
-		world[3].z = depth;
+		worldMatrix.data[3][2] = depth;
 
 		// Send world matrix to OpenGL
-		GetSpriteShader().SetUniform("worldMatrix", worldMatrix);
-		GetFontShader().SetUniform("worldMatrix", worldMatrix);
+		const ShaderProgram& spriteShader = GetSpriteShader();
+		spriteShader.SetUniform(spriteShader.GetSpriteUniforms().worldMatrix, worldMatrix);
+		const ShaderProgram& fontShader = GetFontShader();
+		fontShader.SetUniform(fontShader.GetSpriteUniforms().worldMatrix, worldMatrix);
 	}
 
 	void GraphicsEngine::SetTransform(const Vector2D& translation, const Vector2D& scale, float rotation, float depth)
@@ -341,6 +361,23 @@ namespace Beta
 		return pimpl->defaultCamera;
 	}
 
+	void GraphicsEngine::DrawSprite(const Mesh& mesh, const Texture& texture, const Matrix2D& transform,
+		float depth, const Color& color, const Vector2D& uvOffset, const Vector2D& uvStride, bool flipX, bool flipY)
+	{
+		pimpl->spriteBatch.Add(mesh, texture, transform, depth, color, uvOffset, uvStride,
+			flipX, flipY, pimpl->blendMode);
+	}
+
+	void GraphicsEngine::FlushSprites()
+	{
+		pimpl->spriteBatch.Flush(*this);
+	}
+
+	const SpriteBatchStats& GraphicsEngine::GetSpriteBatchStats() const
+	{
+		return pimpl->spriteBatch.GetStats();
+	}
+
 	const ShaderProgram& GraphicsEngine::GetSpriteShader() const
 	{
 		return pimpl->renderer.GetSpriteShader();
@@ -351,6 +388,16 @@ namespace Beta
 		return pimpl->renderer.GetFontShader();
 	}
 
+	const ShaderProgram& GraphicsEngine::GetSpriteBatchShader() const
+	{
+		return pimpl->spriteBatch.GetShader();
+	}
+
+	const UniformBuffer& GraphicsEngine::GetCameraBuffer() const
+	{
+		return *pimpl->cameraBuffer;
+	}
+
 	void GraphicsEngine::PushEffect(PostEffect& effect)
 	{
 		pimpl->renderer.PushEffect(effect);
@@ -390,6 +437,9 @@ namespace Beta
 		{
 			pimpl->useVsync = _useVsync;
 
+			// No swap chain without a window
+			if (pimpl->headless) return;
+
 			if (pimpl->useVsync) glfwSwapInterval(1);
 			else glfwSwapInterval(0);
 		}
@@ -419,28 +469,39 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	GraphicsEngine::Implementation::Implementation()
-		: defaultTexture(nullptr), blendMode(BM_Blend), useVsync(false),
-		alpha(1.0f), viewportHeight(0), viewportWidth(0), fontSystem(nullptr)
+		: blendMode(BM_Blend), defaultTexture(nullptr), alpha(1.0f), viewportWidth(0), viewportHeight(0),
+		cameraBuffer(nullptr), useVsync(false), headless(false), fontSystem(nullptr)
 	{
 	}
 
 	GraphicsEngine::Implementation::~Implementation()
 	{
 		delete defaultTexture;
+		delete cameraBuffer;
 		if (FT_Done_FreeType(fontSystem) != FT_Success)
 		{
 			std::cout << "ERROR: Could not shut down FreeType Library!" << std::endl;
 		}
 	}
 
-	void GraphicsEngine::Implementation::Initialize()
+	void GraphicsEngine::Implementation::Initialize(bool headless_)
 	{
-		// Initialize OpenGL extension wrangler (GLAD)
-		gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+		headless = headless_;
 
-		// If not using vsync, disable it
-		if (!useVsync) glfwSwapInterval(0);
-		else glfwSwapInterval(1);
+		if (headless)
+		{
+			// Route OpenGL calls to the null backend
+			NullGraphics::Install();
+		}
+		else
+		{
+			// Initialize OpenGL extension wrangler (GLAD)
+			gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+
+			// If not using vsync, disable it
+			if (!useVsync) glfwSwapInterval(0);
+			else glfwSwapInterval(1);
+		}
 
 		std::cout << "OpenGL version supported: " << glGetString(GL_VERSION) << std::endl;
 		std::cout << "OpenGL shader version supported: " << glGetString(GL_SHADING_LANGUAGE_VERSION) << std::endl;
@@ -480,8 +541,9 @@ namespace Beta
 		tintColor = color.Clamp();
 
 		// Tint sprites
-		renderer.GetSpriteShader().SetUniform("tintColor", tintColor);
-		renderer.GetFontShader().SetUniform("tintColor", tintColor);
+		const ShaderProgram* shaders[] = { &renderer.GetSpriteShader(), &renderer.GetFontShader(), &spriteBatch.GetShader() };
+		for (const ShaderProgram* shader : shaders)
+			shader->SetUniform(shader->GetSpriteUniforms().tintColor, tintColor);
 
 		// Update clear color since tint affects it
 		glClearColor(backgroundColor.r * tintColor.r, backgroundColor.g * tintColor.g,
@@ -492,8 +554,9 @@ namespace Beta
 	void GraphicsEngine::Implementation::SetSpriteBlendColor(const Color& color)
 	{
 		blendColor = color.Clamp();
-		renderer.GetSpriteShader().SetUniform("blendColor", blendColor);
-		renderer.GetFontShader().SetUniform("blendColor", blendColor);
+		const ShaderProgram* shaders[] = { &renderer.GetSpriteShader(), &renderer.GetFontShader() };
+		for (const ShaderProgram* shader : shaders)
+			shader->SetUniform(shader->GetSpriteUniforms().blendColor, blendColor);
 	}
 
 	// Set the dimensions of the viewport.
@@ -555,7 +618,11 @@ namespace Beta
 
 	void GraphicsEngine::Implementation::InitRenderer()
 	{
+		// Must exist before shaders are linked so their camera blocks can use it
+		cameraBuffer = new UniformBuffer("CameraData", 2 * sizeof(glm::mat4));
+
 		renderer.Init();
+		spriteBatch.Init();
 		SetBlendMode((BlendMode)blendMode, true);
 		SetBackgroundColor();
 		SetScreenTintColor();
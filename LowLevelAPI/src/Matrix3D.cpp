@@ -20,8 +20,60 @@
 
 #include "Matrix2D.h"
 
+// Use SSE for multiplication where available
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define BE_MATRIX3D_SSE 1
+#include <xmmintrin.h>
+#else
+#define BE_MATRIX3D_SSE 0
+#endif
+
 //------------------------------------------------------------------------------
 
+namespace
+{
+#if BE_MATRIX3D_SSE
+	// Rearranges the elements of a vector, e.g. Swizzle<3, 2, 1, 0>(v) reverses it
+	template<int x, int y, int z, int w>
+	inline __m128 Swizzle(__m128 v)
+	{
+		return _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x));
+	}
+
+	// Takes two elements from a and two from b, e.g. Shuffle<0, 1, 0, 1>(a, b) = (a0, a1, b0, b1)
+	template<int x, int y, int z, int w>
+	inline __m128 Shuffle(__m128 a, __m128 b)
+	{
+		return _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x));
+	}
+
+	// The following treat a vector (a, b, c, d) as the 2x2 matrix | a b |
+	//                                                            | c d |
+	// and use A# to mean the adjugate of A.
+
+	// Returns A * B
+	inline __m128 Mat2Mul(__m128 a, __m128 b)
+	{
+		return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+			_mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+	}
+
+	// Returns A# * B
+	inline __m128 Mat2AdjMul(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+			_mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+	}
+
+	// Returns A * B#
+	inline __m128 Mat2MulAdj(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+			_mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+	}
+#endif
+}
+
 namespace Beta
 {
 	//------------------------------------------------------------------------------
@@ -29,20 +81,14 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	Matrix3D::Matrix3D()
-		: data(new glm::mat4)
-	{
-	}
-
-	Matrix3D::Matrix3D(const Matrix3D& other)
-		: data(new glm::mat4(*static_cast<glm::mat4*>(other.data)))
 	{
+		GlmMatrix(*this) = glm::mat4(1.0f);
 	}
 
 	// Conversion to GLM matrix
 	Matrix3D::Matrix3D(const Matrix2D& m)
-		: data(new glm::mat4)
 	{
-		glm::mat4& matrix = static_cast<glm::mat4&>(*static_cast<glm::mat4*>(data));
+		glm::mat4& matrix = GlmMatrix(*this);
 
 		// Start with GLM identity matrix
 		matrix = glm::mat4(1.0f);
@@ -53,9 +99,95 @@ namespace Beta
 		matrix[0].z = m.m[2][0]; matrix[1].z = m.m[2][1]; matrix[3].z = 0.0f;
 	}
 
-	Matrix3D::~Matrix3D()
+	// Concatenates two matrices
+	Matrix3D Matrix3D::operator*(const Matrix3D& other) const
 	{
-		glm::mat4* matrix = static_cast<glm::mat4*>(data);
-		delete matrix;
+		Matrix3D result;
+
+#if BE_MATRIX3D_SSE
+		// Each column of the result is a linear combination of our columns
+		const __m128 column0 = _mm_load_ps(data[0]);
+		const __m128 column1 = _mm_load_ps(data[1]);
+		const __m128 column2 = _mm_load_ps(data[2]);
+		const __m128 column3 = _mm_load_ps(data[3]);
+
+		for (int i = 0; i < 4; ++i)
+		{
+			__m128 sum = _mm_mul_ps(column0, _mm_set1_ps(other.data[i][0]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(other.data[i][1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(other.data[i][2])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column3, _mm_set1_ps(other.data[i][3])));
+			_mm_store_ps(result.data[i], sum);
+		}
+#else
+		GlmMatrix(result) = GlmMatrix(*this) * GlmMatrix(other);
+#endif
+
+		return result;
+	}
+
+	// Returns the inverse of this matrix
+	Matrix3D Matrix3D::Inverse() const
+	{
+		Matrix3D result;
+
+#if BE_MATRIX3D_SSE
+		// Split the matrix into 2x2 blocks | A B | and invert it blockwise.
+		//                                  | C D |
+		// The inverse of the transpose is the transpose of the inverse,
+		// so this works on columns just as well as on rows.
+		const __m128 column0 = _mm_load_ps(data[0]);
+		const __m128 column1 = _mm_load_ps(data[1]);
+		const __m128 column2 = _mm_load_ps(data[2]);
+		const __m128 column3 = _mm_load_ps(data[3]);
+
+		const __m128 a = _mm_movelh_ps(column0, column1);
+		const __m128 b = _mm_movehl_ps(column1, column0);
+		const __m128 c = _mm_movelh_ps(column2, column3);
+		const __m128 d = _mm_movehl_ps(column3, column2);
+
+		// Determinants of each block as (|A|, |B|, |C|, |D|)
+		const __m128 subDeterminants = _mm_sub_ps(
+			_mm_mul_ps(Shuffle<0, 2, 0, 2>(column0, column2), Shuffle<1, 3, 1, 3>(column1, column3)),
+			_mm_mul_ps(Shuffle<1, 3, 1, 3>(column0, column2), Shuffle<0, 2, 0, 2>(column1, column3)));
+		const __m128 detA = Swizzle<0, 0, 0, 0>(subDeterminants);
+		const __m128 detB = Swizzle<1, 1, 1, 1>(subDeterminants);
+		const __m128 detC = Swizzle<2, 2, 2, 2>(subDeterminants);
+		const __m128 detD = Swizzle<3, 3, 3, 3>(subDeterminants);
+
+		const __m128 dAdjC = Mat2AdjMul(d, c);
+		const __m128 aAdjB = Mat2AdjMul(a, b);
+
+		// Adjugates of the inverse's blocks, before dividing by the determinant
+		__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dAdjC));
+		__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, aAdjB));
+		__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, aAdjB));
+		__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dAdjC));
+
+		// |M| = |A||D| + |B||C| - trace((A#B)(D#C))
+		__m128 trace = _mm_mul_ps(aAdjB, Swizzle<0, 2, 1, 3>(dAdjC));
+		trace = _mm_add_ps(trace, Swizzle<2, 3, 0, 1>(trace));
+		trace = _mm_add_ps(trace, Swizzle<1, 0, 3, 2>(trace));
+		const __m128 determinant = _mm_sub_ps(
+			_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+		// Divide by the determinant, flipping signs to finish the adjugates
+		const __m128 scale = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+		x = _mm_mul_ps(x, scale);
+		y = _mm_mul_ps(y, scale);
+		z = _mm_mul_ps(z, scale);
+		w = _mm_mul_ps(w, scale);
+
+		_mm_store_ps(result.data[0], Shuffle<3, 1, 3, 1>(x, y));
+		_mm_store_ps(result.data[1], Shuffle<2, 0, 2, 0>(x, y));
+		_mm_store_ps(result.data[2], Shuffle<3, 1, 3, 1>(z, w));
+		_mm_store_ps(result.data[3], Shuffle<2, 0, 2, 0>(z, w));
+#else
+		GlmMatrix(result) = glm::inverse(GlmMatrix(*this));
+#endif
+
+		return result;
 	}
 }
+
+//------------------------------------------------------------------------------
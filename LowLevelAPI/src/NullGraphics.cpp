@@ -0,0 +1,329 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	NullGraphics.cpp
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "NullGraphics.h"
+
+// Dependencies
+#include <glad.h>
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Counters for all calls to the null backend
+		NullGraphicsStats stats;
+
+		// Whether the null backend has been installed
+		bool installed = false;
+
+		// Last ID given out by a gen/create function. IDs are never reused, so
+		// every object gets a unique non-zero name like it would with a real context.
+		GLuint lastObjectID = 0;
+
+		// Locations given out for uniform and attribute names. Each name gets its
+		// own location, so that values set for different uniforms stay separate.
+		std::map<std::string, GLint> locations;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Generic replacement for any OpenGL function that returns nothing.
+		// The counter is incremented in addition to the total call count.
+		template<typename Proc>
+		struct NullCall;
+
+		template<typename... Args>
+		struct NullCall<void (APIENTRYP)(Args...)>
+		{
+			template<unsigned long NullGraphicsStats::* counter>
+			static void APIENTRY Call(Args...)
+			{
+				++stats.calls;
+				++(stats.*counter);
+			}
+		};
+
+		// Point a GLAD function pointer at a generic null function.
+		template<unsigned long NullGraphicsStats::* counter, typename Proc>
+		void SetNull(Proc& proc)
+		{
+			proc = &NullCall<Proc>::template Call<counter>;
+		}
+
+		// Object creation
+
+		void APIENTRY GenObjects(GLsizei n, GLuint* objects)
+		{
+			++stats.calls;
+			for (GLsizei i = 0; i < n; ++i)
+			{
+				objects[i] = ++lastObjectID;
+				++stats.objectsCreated;
+			}
+		}
+
+		GLuint APIENTRY CreateShader(GLenum type)
+		{
+			UNREFERENCED_PARAMETER(type);
+			++stats.calls;
+			++stats.objectsCreated;
+			return ++lastObjectID;
+		}
+
+		GLuint APIENTRY CreateProgram()
+		{
+			++stats.calls;
+			++stats.objectsCreated;
+			return ++lastObjectID;
+		}
+
+		void APIENTRY DeleteObjects(GLsizei n, const GLuint* objects)
+		{
+			UNREFERENCED_PARAMETER(objects);
+			++stats.calls;
+			stats.objectsDeleted += n;
+		}
+
+		// Drawing
+
+		void APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
+		{
+			UNREFERENCED_PARAMETER(mode);
+			UNREFERENCED_PARAMETER(first);
+			UNREFERENCED_PARAMETER(count);
+			++stats.calls;
+			++stats.drawCalls;
+			stats.instances += instanceCount;
+		}
+
+		// Queries - report success so that callers continue as they would with a real context
+
+		const GLubyte* APIENTRY GetString(GLenum name)
+		{
+			UNREFERENCED_PARAMETER(name);
+			++stats.calls;
+			return reinterpret_cast<const GLubyte*>("Beta Engine null graphics backend");
+		}
+
+		GLenum APIENTRY GetError()
+		{
+			++stats.calls;
+			return GL_NO_ERROR;
+		}
+
+		void APIENTRY GetIntegerv(GLenum pname, GLint* data)
+		{
+			UNREFERENCED_PARAMETER(pname);
+			++stats.calls;
+			*data = 0;
+		}
+
+		void APIENTRY GetObjectiv(GLuint object, GLenum pname, GLint* params)
+		{
+			UNREFERENCED_PARAMETER(object);
+			++stats.calls;
+			*params = (pname == GL_COMPILE_STATUS || pname == GL_LINK_STATUS) ? GL_TRUE : 0;
+		}
+
+		void APIENTRY GetInfoLog(GLuint object, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+		{
+			UNREFERENCED_PARAMETER(object);
+			++stats.calls;
+			if (length != nullptr) *length = 0;
+			if (bufSize > 0) infoLog[0] = '\0';
+		}
+
+		void APIENTRY GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders)
+		{
+			UNREFERENCED_PARAMETER(program);
+			UNREFERENCED_PARAMETER(maxCount);
+			UNREFERENCED_PARAMETER(shaders);
+			++stats.calls;
+			if (count != nullptr) *count = 0;
+		}
+
+		GLint APIENTRY GetLocation(GLuint program, const GLchar* name)
+		{
+			UNREFERENCED_PARAMETER(program);
+			++stats.calls;
+			return locations.emplace(name, static_cast<GLint>(locations.size())).first->second;
+		}
+
+		GLenum APIENTRY CheckFramebufferStatus(GLenum target)
+		{
+			UNREFERENCED_PARAMETER(target);
+			++stats.calls;
+			return GL_FRAMEBUFFER_COMPLETE;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	NullGraphicsStats::NullGraphicsStats()
+		: calls(0), drawCalls(0), instances(0), bufferUploads(0), textureUploads(0),
+		uniformUpdates(0), stateChanges(0), objectsCreated(0), objectsDeleted(0)
+	{
+	}
+
+	namespace NullGraphics
+	{
+		// Route all OpenGL calls made by the engine to the null backend.
+		// Must be called instead of loading a real OpenGL context.
+		void Install()
+		{
+			// Objects
+			glad_glGenBuffers = GenObjects;
+			glad_glGenTextures = GenObjects;
+			glad_glGenVertexArrays = GenObjects;
+			glad_glGenFramebuffers = GenObjects;
+			glad_glGenRenderbuffers = GenObjects;
+			glad_glCreateShader = CreateShader;
+			glad_glCreateProgram = CreateProgram;
+			glad_glDeleteBuffers = DeleteObjects;
+			glad_glDeleteTextures = DeleteObjects;
+			glad_glDeleteVertexArrays = DeleteObjects;
+			glad_glDeleteFramebuffers = DeleteObjects;
+			glad_glDeleteRenderbuffers = DeleteObjects;
+			SetNull<&NullGraphicsStats::objectsDeleted>(glad_glDeleteShader);
+			SetNull<&NullGraphicsStats::objectsDeleted>(glad_glDeleteProgram);
+
+			// Drawing
+			SetNull<&NullGraphicsStats::drawCalls>(glad_glDrawArrays);
+			glad_glDrawArraysInstanced = DrawArraysInstanced;
+			SetNull<&NullGraphicsStats::drawCalls>(glad_glClear);
+			SetNull<&NullGraphicsStats::drawCalls>(glad_glBlitFramebuffer);
+
+			// Data uploads
+			SetNull<&NullGraphicsStats::bufferUploads>(glad_glBufferData);
+			SetNull<&NullGraphicsStats::bufferUploads>(glad_glBufferSubData);
+			SetNull<&NullGraphicsStats::textureUploads>(glad_glTexImage2D);
+			SetNull<&NullGraphicsStats::textureUploads>(glad_glTexSubImage2D);
+
+			// Uniforms
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform1i);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform1iv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform1f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform1fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform2f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform2fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform3f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform3fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform4f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniform4fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniformMatrix3fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glUniformMatrix4fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform1i);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform1iv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform1f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform1fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform2f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform2fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform3f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform3fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform4f);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniform4fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniformMatrix3fv);
+			SetNull<&NullGraphicsStats::uniformUpdates>(glad_glProgramUniformMatrix4fv);
+
+			// State
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glUseProgram);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBindBuffer);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBindBufferBase);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glUniformBlockBinding);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBindTexture);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBindVertexArray);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBindFramebuffer);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBindRenderbuffer);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glActiveTexture);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glEnable);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glDisable);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glHint);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBlendFunc);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBlendFuncSeparate);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBlendEquation);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glBlendEquationSeparate);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glClearColor);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glViewport);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glPixelStorei);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glTexParameteri);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glGenerateMipmap);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glVertexAttribPointer);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glEnableVertexAttribArray);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glDisableVertexAttribArray);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glVertexAttribDivisor);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glShaderSource);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glCompileShader);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glAttachShader);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glLinkProgram);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glFramebufferTexture2D);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glFramebufferRenderbuffer);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glRenderbufferStorage);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glDrawBuffers);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glReadBuffer);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glReadPixels);
+			SetNull<&NullGraphicsStats::stateChanges>(glad_glDebugMessageCallback);
+
+			// Queries
+			glad_glGetString = GetString;
+			glad_glGetError = GetError;
+			glad_glGetIntegerv = GetIntegerv;
+			glad_glGetShaderiv = GetObjectiv;
+			glad_glGetProgramiv = GetObjectiv;
+			glad_glGetShaderInfoLog = GetInfoLog;
+			glad_glGetProgramInfoLog = GetInfoLog;
+			glad_glGetAttachedShaders = GetAttachedShaders;
+			glad_glGetUniformLocation = GetLocation;
+			glad_glGetAttribLocation = GetLocation;
+			glad_glCheckFramebufferStatus = CheckFramebufferStatus;
+
+			installed = true;
+			ResetStats();
+		}
+
+		// Test whether the null backend is currently installed.
+		bool IsInstalled()
+		{
+			return installed;
+		}
+
+		// Get the counters for all calls made since the backend was installed
+		// or the counters were last reset.
+		const NullGraphicsStats& GetStats()
+		{
+			return stats;
+		}
+
+		// Set all counters back to zero.
+		void ResetStats()
+		{
+			stats = NullGraphicsStats();
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	ObjectPool.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "ObjectPool.h"
+
+#include <cstddef>	// max_align_t
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// List of all pools. Both are constant-initialized, so pools
+		// can safely be created by static constructors.
+		ObjectPool* firstPool = nullptr;
+		std::mutex poolListMutex;
+	}
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor - Creates an empty pool.
+	// Params:
+	//   name = The name shown in the pool's stats.
+	//   objectSize = The size of each piece of memory, in bytes.
+	//   objectsPerSlab = The number of objects in each slab.
+	ObjectPool::ObjectPool(const std::string& name, size_t objectSize, unsigned objectsPerSlab)
+		: name(name), objectSize(objectSize), objectsPerSlab(objectsPerSlab),
+		freeList(nullptr), freeCount(0), live(0), peak(0), nextPool(nullptr), prevPool(nullptr)
+	{
+		// Free slots must be able to hold a pointer, and stay aligned
+		const size_t alignment = alignof(std::max_align_t);
+		if (this->objectSize < sizeof(FreeSlot))
+			this->objectSize = sizeof(FreeSlot);
+		this->objectSize = (this->objectSize + alignment - 1) / alignment * alignment;
+
+		if (this->objectsPerSlab == 0)
+			this->objectsPerSlab = 1;
+
+		std::lock_guard<std::mutex> lock(poolListMutex);
+		nextPool = firstPool;
+		if (firstPool != nullptr)
+			firstPool->prevPool = this;
+		firstPool = this;
+	}
+
+	// Destructor - Frees all slabs, unless objects are still using them.
+	ObjectPool::~ObjectPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(poolListMutex);
+			if (prevPool != nullptr)
+				prevPool->nextPool = nextPool;
+			else
+				firstPool = nextPool;
+			if (nextPool != nullptr)
+				nextPool->prevPool = prevPool;
+		}
+
+		// Objects that outlive the pool would be left pointing at freed memory
+		if (live != 0)
+		{
+			std::cout << "ERROR in ObjectPool: " << name << " destroyed with " << live
+				<< " objects still allocated." << std::endl;
+			return;
+		}
+
+		for (auto it = slabs.Begin(); it != slabs.End(); ++it)
+			delete[] *it;
+	}
+
+	// Get memory for one object.
+	// Returns:
+	//   A pointer to uninitialized memory of at least the pool's object size.
+	void* ObjectPool::Allocate()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (freeList == nullptr)
+			AddSlab();
+
+		FreeSlot* slot = freeList;
+		freeList = slot->next;
+		--freeCount;
+
+		++live;
+		if (live > peak)
+			peak = live;
+
+		return slot;
+	}
+
+	// Return an object's memory to the pool.
+	// Params:
+	//   memory = A pointer returned by Allocate.
+	void ObjectPool::Free(void* memory)
+	{
+		if (memory == nullptr)
+			return;
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		// Most recently freed slots are reused first, while they are still in the cache
+		FreeSlot* slot = static_cast<FreeSlot*>(memory);
+		slot->next = freeList;
+		freeList = slot;
+		++freeCount;
+
+		--live;
+	}
+
+	// Make sure a number of objects can be allocated without creating slabs.
+	// Params:
+	//   count = The number of objects.
+	void ObjectPool::Reserve(unsigned count)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		while (freeCount < count)
+			AddSlab();
+	}
+
+	// Test whether memory came from this pool.
+	// Params:
+	//   memory = The memory to test.
+	bool ObjectPool::Owns(const void* memory) const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		const char* address = static_cast<const char*>(memory);
+		for (auto it = slabs.Begin(); it != slabs.End(); ++it)
+		{
+			if (address >= *it && address < *it + objectSize * objectsPerSlab)
+				return true;
+		}
+
+		return false;
+	}
+
+	// Returns the size of each piece of memory in the pool.
+	size_t ObjectPool::GetObjectSize() const
+	{
+		return objectSize;
+	}
+
+	// Returns the pool's current usage.
+	PoolStats ObjectPool::GetStats() const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		PoolStats stats;
+		stats.name = name;
+		stats.objectSize = objectSize;
+		stats.live = live;
+		stats.peak = peak;
+		stats.freeCount = freeCount;
+		stats.slabCount = static_cast<unsigned>(slabs.Size());
+		return stats;
+	}
+
+	// Get the usage of every pool that exists.
+	// Params:
+	//   stats = The array that the stats will be added to.
+	void ObjectPool::GetAllStats(Array<PoolStats>& stats)
+	{
+		std::lock_guard<std::mutex> lock(poolListMutex);
+
+		for (ObjectPool* pool = firstPool; pool != nullptr; pool = pool->nextPool)
+			stats.PushBack(pool->GetStats());
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Create a slab and add its slots to the free list. Lock must be held.
+	void ObjectPool::AddSlab()
+	{
+		char* slab = new char[objectSize * objectsPerSlab];
+		slabs.PushBack(slab);
+
+		// Link slots in reverse so that they are handed out in address order
+		for (unsigned i = objectsPerSlab; i > 0; --i)
+		{
+			FreeSlot* slot = reinterpret_cast<FreeSlot*>(slab + (i - 1) * objectSize);
+			slot->next = freeList;
+			freeList = slot;
+		}
+
+		freeCount += objectsPerSlab;
+	}
+}
+
+//------------------------------------------------------------------------------
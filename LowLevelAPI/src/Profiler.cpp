@@ -0,0 +1,899 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	Profiler.cpp
+// Author(s):	agent (agent@local)
+// Project:		BetaFramework
+// Course:		WANIC VGP2 2018-2019
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "Profiler.h"
+
+#include <atomic>		// Lock-free buffers
+#include <mutex>		// Zone registry
+#include <thread>		// this_thread
+#include <chrono>		// steady_clock
+#include <fstream>		// ofstream
+#include <sstream>		// ostringstream
+#include <iomanip>		// setprecision
+#include <unordered_map> // Zone IDs by name
+#include <glad.h>		// Timer queries
+
+// Systems
+#include "EngineCore.h"		// GetModule
+#include "GraphicsEngine.h"	// GetViewport, SetTransform
+#include "DebugDraw.h"		// AddRectangle
+#include "NullGraphics.h"	// IsInstalled
+#include "Camera.h"			// Use
+#include "Font.h"			// DrawText
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Number of timings each thread can record between calls to FrameEnd.
+		// Must be a power of two.
+		const unsigned bufferCapacity = 8192;
+
+		// Thread index used for GPU timings in captures
+		const unsigned gpuThread = 0xFFFF;
+
+		// Number of frames to wait before reading timer queries
+		const unsigned gpuLatency = 4;
+
+		// Overlay layout, in rows of text
+		const float overlayRows = 40.0f;
+		const float overlayTextColumns = 14.0f;
+		const float overlayBarLength = 10.0f;
+		const float overlayTextScale = 0.5f;
+
+		// Time that fills an entire bar in the overlay
+		const double overlayFrameBudget = 1000.0 / 60.0;
+
+		const double nanosecondsPerMillisecond = 1000000.0;
+		const double nanosecondsPerMicrosecond = 1000.0;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Structures:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// A single timing recorded by a thread
+		struct Sample
+		{
+			long long start;
+			long long end;
+			unsigned zoneID;
+			unsigned depth;
+		};
+
+		// Timings recorded by a single thread. Only the owning thread writes
+		// samples and only the main thread reads them, so the two indices are
+		// enough to share the buffer without locking.
+		struct ThreadBuffer
+		{
+			ThreadBuffer(unsigned index)
+				: writeIndex(0), readIndex(0), dropped(0), depth(0), index(index), next(nullptr)
+			{
+			}
+
+			Sample samples[bufferCapacity];
+			std::atomic<unsigned> writeIndex;
+			std::atomic<unsigned> readIndex;
+			std::atomic<unsigned long> dropped;
+
+			// Number of zones the thread is currently inside
+			unsigned depth;
+
+			unsigned index;
+			ThreadBuffer* next;
+		};
+
+		// All thread buffers. Buffers are added without locking and are only
+		// freed when the program exits, since their threads may still use them.
+		struct BufferList
+		{
+			BufferList()
+				: first(nullptr), count(0)
+			{
+			}
+
+			~BufferList()
+			{
+				ThreadBuffer* buffer = first.load();
+				while (buffer != nullptr)
+				{
+					ThreadBuffer* next = buffer->next;
+					delete buffer;
+					buffer = next;
+				}
+			}
+
+			std::atomic<ThreadBuffer*> first;
+			std::atomic<unsigned> count;
+
+			// Names of threads, by index (only used when exporting)
+			std::mutex nameMutex;
+			std::unordered_map<unsigned, std::string> names;
+		};
+
+		// Names and IDs of all zones
+		struct ZoneRegistry
+		{
+			std::mutex mutex;
+			Array<std::string> names;
+			std::unordered_map<std::string, unsigned> ids;
+		};
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Whether zones are being recorded
+		std::atomic<bool> enabled(true);
+
+		// Profiler that receives GPU zones
+		Profiler* activeProfiler = nullptr;
+
+		// Thread that owns the OpenGL context
+		std::thread::id mainThread;
+
+		// The calling thread's buffer, created the first time it enters a zone
+		thread_local ThreadBuffer* threadBuffer = nullptr;
+
+		// Time when the program started, so that captures start near zero
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Declarations:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Get the current time in nanoseconds.
+		long long GetTicks();
+
+		// All thread buffers.
+		BufferList& GetBufferList();
+
+		// Names and IDs of all zones.
+		ZoneRegistry& GetZoneRegistry();
+
+		// Get the calling thread's buffer, creating it if needed.
+		ThreadBuffer& GetThreadBuffer();
+
+		// Escape a string for use in JSON.
+		std::string EscapeJSON(const std::string& text);
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Classes:
+	//------------------------------------------------------------------------------
+
+	// Measures time on the GPU. This base version is the null backend, which
+	// is used when there is no GPU and measures nothing.
+	class Profiler::GPUTimer
+	{
+	public:
+		virtual ~GPUTimer() {}
+
+		// Start measuring a zone.
+		virtual void Begin(unsigned zoneID, unsigned depth)
+		{
+			UNREFERENCED_PARAMETER(zoneID);
+			UNREFERENCED_PARAMETER(depth);
+		}
+
+		// Stop measuring the most recent zone that is still open.
+		virtual void End()
+		{
+		}
+
+		// Start a new frame, adding any measurements that are ready to the profiler.
+		virtual void FrameEnd(Profiler& profiler)
+		{
+			UNREFERENCED_PARAMETER(profiler);
+		}
+
+		// Whether this timer measures anything.
+		virtual bool IsNull() const
+		{
+			return true;
+		}
+	};
+
+	// Measures time on the GPU using timestamp queries. Timestamps are used
+	// instead of elapsed time queries because they can be nested.
+	class Profiler::GLTimer : public Profiler::GPUTimer
+	{
+	public:
+		GLTimer()
+			: currentFrame(0), offset(0)
+		{
+			// Convert GPU timestamps to the CPU clock used for other zones
+			GLint64 gpuTime = 0;
+			glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+			offset = GetTicks() - gpuTime;
+		}
+
+		~GLTimer()
+		{
+			for (unsigned i = 0; i < gpuLatency; ++i)
+			{
+				for (auto it = frames[i].Begin(); it != frames[i].End(); ++it)
+				{
+					if (it->begin != 0)
+						freeQueries.PushBack(it->begin);
+					if (it->end != 0)
+						freeQueries.PushBack(it->end);
+				}
+			}
+
+			if (!freeQueries.IsEmpty())
+				glDeleteQueries(static_cast<GLsizei>(freeQueries.Size()), freeQueries.Begin());
+		}
+
+		void Begin(unsigned zoneID, unsigned depth) override
+		{
+			Query query = { zoneID, depth, GetQuery(), 0 };
+			glQueryCounter(query.begin, GL_TIMESTAMP);
+
+			Array<Query>& queries = frames[currentFrame];
+			openQueries.PushBack(static_cast<unsigned>(queries.Size()));
+			queries.PushBack(query);
+		}
+
+		void End() override
+		{
+			if (openQueries.IsEmpty())
+				return;
+
+			Query& query = frames[currentFrame][openQueries.Back()];
+			openQueries.PopBack();
+
+			query.end = GetQuery();
+			glQueryCounter(query.end, GL_TIMESTAMP);
+		}
+
+		void FrameEnd(Profiler& profiler) override
+		{
+			// Zones that were never ended are not measured
+			openQueries.Clear();
+
+			// Read the oldest frame's queries. Any that the GPU still hasn't finished
+			// are dropped rather than waiting for them.
+			currentFrame = (currentFrame + 1) % gpuLatency;
+			Array<Query>& queries = frames[currentFrame];
+
+			for (auto it = queries.Begin(); it != queries.End(); ++it)
+			{
+				if (IsIssued(*it) && IsAvailable(it->begin) && IsAvailable(it->end))
+				{
+					GLuint64 start = 0;
+					GLuint64 end = 0;
+					glGetQueryObjectui64v(it->begin, GL_QUERY_RESULT, &start);
+					glGetQueryObjectui64v(it->end, GL_QUERY_RESULT, &end);
+					profiler.AddSample(it->zoneID, it->depth, static_cast<long long>(start) + offset,
+						static_cast<long long>(end) + offset, gpuThread, true);
+				}
+
+				// Reuse queries
+				if (it->begin != 0)
+					freeQueries.PushBack(it->begin);
+				if (it->end != 0)
+					freeQueries.PushBack(it->end);
+			}
+			queries.Clear();
+		}
+
+		bool IsNull() const override
+		{
+			return false;
+		}
+
+	private:
+		struct Query
+		{
+			unsigned zoneID;
+			unsigned depth;
+			GLuint begin;
+			GLuint end;
+		};
+
+		// Whether both timestamps of a zone were written.
+		static bool IsIssued(const Query& query)
+		{
+			return query.begin != 0 && query.end != 0;
+		}
+
+		// Whether the GPU has written a query's result, so that reading it won't wait.
+		static bool IsAvailable(GLuint query)
+		{
+			GLint available = GL_FALSE;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			return available != GL_FALSE;
+		}
+
+		// Get an unused query object.
+		GLuint GetQuery()
+		{
+			if (freeQueries.IsEmpty())
+			{
+				GLuint query = 0;
+				glGenQueries(1, &query);
+				return query;
+			}
+
+			GLuint query = freeQueries.Back();
+			freeQueries.PopBack();
+			return query;
+		}
+
+		// Queries for the last few frames
+		Array<Query> frames[gpuLatency];
+		unsigned currentFrame;
+
+		// Queries in the current frame that have begun but not ended
+		Array<unsigned> openQueries;
+
+		Array<GLuint> freeQueries;
+
+		// Difference between the CPU and GPU clocks
+		long long offset;
+	};
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor
+	Profiler::Profiler()
+		: historyIndex(0), historyCount(0), gpuTimer(new GPUTimer()), captureFramesLeft(0),
+		overlayEnabled(false), overlayFont(nullptr), overlayCamera(nullptr)
+	{
+	}
+
+	// Destructor - Releases timer queries.
+	Profiler::~Profiler()
+	{
+		if (activeProfiler == this)
+			activeProfiler = nullptr;
+
+		for (auto it = zones.Begin(); it != zones.End(); ++it)
+			delete *it;
+
+		delete gpuTimer;
+		delete overlayCamera;
+	}
+
+	// Choose a GPU timer. Must be called after the graphics engine has been initialized.
+	void Profiler::Initialize()
+	{
+		mainThread = std::this_thread::get_id();
+		activeProfiler = this;
+		SetThreadName("Main");
+
+		// Timer queries are only available with a real context
+		delete gpuTimer;
+		if (!NullGraphics::IsInstalled() && glQueryCounter != nullptr && glGetQueryObjectui64v != nullptr)
+			gpuTimer = new GLTimer();
+		else
+			gpuTimer = new GPUTimer();
+
+		overlayCamera = new Camera();
+		overlayCamera->SetVerticalSize(overlayRows);
+	}
+
+	// Collect the timings recorded by all threads during the frame and update
+	// the statistics. Should only be called by existing Low-Level API systems.
+	void Profiler::FrameEnd()
+	{
+		// Add zones registered since the last frame
+		{
+			ZoneRegistry& registry = GetZoneRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			while (zones.Size() < registry.names.Size())
+			{
+				ZoneHistory* zone = new ZoneHistory();
+				zone->name = registry.names[zones.Size()];
+				zones.PushBack(zone);
+			}
+		}
+
+		// Collect timings from every thread
+		for (ThreadBuffer* buffer = GetBufferList().first.load(std::memory_order_acquire);
+			buffer != nullptr; buffer = buffer->next)
+		{
+			unsigned read = buffer->readIndex.load(std::memory_order_relaxed);
+			unsigned write = buffer->writeIndex.load(std::memory_order_acquire);
+
+			for (; read != write; ++read)
+			{
+				const Sample& sample = buffer->samples[read & (bufferCapacity - 1)];
+				AddSample(sample.zoneID, sample.depth, sample.start, sample.end, buffer->index, false);
+			}
+
+			// Let the thread reuse the space
+			buffer->readIndex.store(write, std::memory_order_release);
+		}
+
+		gpuTimer->FrameEnd(*this);
+
+		// Add this frame to the history
+		for (auto it = zones.Begin(); it != zones.End(); ++it)
+		{
+			ZoneHistory& zone = **it;
+			zone.cpuTime[historyIndex] = static_cast<float>(zone.frameCPU / nanosecondsPerMillisecond);
+			zone.gpuTime[historyIndex] = static_cast<float>(zone.frameGPU / nanosecondsPerMillisecond);
+			zone.calls[historyIndex] = static_cast<unsigned short>(std::min(zone.frameCalls, 0xFFFFu));
+			zone.frameCPU = 0;
+			zone.frameGPU = 0;
+			zone.frameCalls = 0;
+		}
+		historyIndex = (historyIndex + 1) % historyLength;
+		if (historyCount < historyLength)
+			++historyCount;
+
+		if (captureFramesLeft != 0)
+			--captureFramesLeft;
+	}
+
+	// Draw the overlay, if it is enabled. Should only be called by existing Low-Level API systems.
+	void Profiler::Draw()
+	{
+		if (!overlayEnabled || overlayCamera == nullptr)
+			return;
+
+		GraphicsEngine& graphics = *EngineGetModule(GraphicsEngine);
+		DebugDraw& debugDraw = *EngineGetModule(DebugDraw);
+
+		Array<ProfileZoneStats> stats;
+		GetZoneStats(stats);
+
+		// Place rows starting at the top left corner of the screen
+		Vector2D viewport = graphics.GetViewport();
+		float aspectRatio = viewport.y != 0.0f ? viewport.x / viewport.y : 1.0f;
+		float left = -overlayRows * 0.5f * aspectRatio;
+		float top = overlayRows * 0.5f;
+
+		debugDraw.SetCamera(*overlayCamera);
+		if (overlayFont != nullptr)
+		{
+			overlayCamera->Use();
+			graphics.SetSpriteBlendColor(Colors::White);
+		}
+
+		float row = 0.5f;
+		for (auto it = stats.Begin(); it != stats.End(); ++it)
+		{
+			// Skip zones that have not run recently
+			if (it->callsPerFrame == 0.0)
+				continue;
+
+			float y = top - row;
+			row += 1.0f;
+
+			// Bars for CPU and GPU time, red if over budget
+			float barLeft = left + overlayTextColumns;
+			float cpuLength = static_cast<float>(it->cpuAverage / overlayFrameBudget) * overlayBarLength;
+			debugDraw.AddRectangle(Vector2D(barLeft + cpuLength * 0.5f, y + 0.15f),
+				Vector2D(cpuLength * 0.5f, 0.15f), it->cpuAverage > overlayFrameBudget ? Colors::Red : Colors::Green);
+
+			if (it->gpuAverage != 0.0)
+			{
+				float gpuLength = static_cast<float>(it->gpuAverage / overlayFrameBudget) * overlayBarLength;
+				debugDraw.AddRectangle(Vector2D(barLeft + gpuLength * 0.5f, y - 0.15f),
+					Vector2D(gpuLength * 0.5f, 0.15f), Colors::Blue);
+			}
+
+			if (overlayFont == nullptr)
+				continue;
+
+			// Name, indented by depth, and times
+			std::ostringstream text;
+			text << std::fixed << std::setprecision(2) << it->name << " " << it->cpuAverage;
+			if (it->gpuAverage != 0.0)
+				text << " / " << it->gpuAverage;
+
+			graphics.SetTransform(Vector2D(left + 0.5f + it->depth, y),
+				Vector2D(overlayTextScale, overlayTextScale));
+			overlayFont->DrawText(text.str());
+		}
+
+		// Restore cameras
+		debugDraw.SetCamera(graphics.GetDefaultCamera());
+		if (overlayFont != nullptr)
+			graphics.GetDefaultCamera().Use();
+	}
+
+	// Enable or disable recording. Zones entered while disabled are ignored.
+	void Profiler::SetEnabled(bool enabled_)
+	{
+		enabled = enabled_;
+	}
+
+	// Are zones currently being recorded?
+	bool Profiler::IsEnabled() const
+	{
+		return enabled;
+	}
+
+	// Get the statistics for every zone that has been recorded.
+	// Params:
+	//   stats = The array that the stats will be added to, in the order the zones were registered.
+	void Profiler::GetZoneStats(Array<ProfileZoneStats>& stats) const
+	{
+		for (auto it = zones.Begin(); it != zones.End(); ++it)
+		{
+			const ZoneHistory& zone = **it;
+
+			ProfileZoneStats zoneStats;
+			zoneStats.name = zone.name;
+			zoneStats.depth = zone.depth;
+			zoneStats.cpuAverage = 0.0;
+			zoneStats.cpuMin = 0.0;
+			zoneStats.cpuMax = 0.0;
+			zoneStats.gpuAverage = 0.0;
+			zoneStats.callsPerFrame = 0.0;
+
+			for (unsigned i = 0; i < historyCount; ++i)
+			{
+				double cpuTime = zone.cpuTime[i];
+				zoneStats.cpuAverage += cpuTime;
+				zoneStats.cpuMin = (i == 0) ? cpuTime : std::min(zoneStats.cpuMin, cpuTime);
+				zoneStats.cpuMax = std::max(zoneStats.cpuMax, cpuTime);
+				zoneStats.gpuAverage += zone.gpuTime[i];
+				zoneStats.callsPerFrame += zone.calls[i];
+			}
+
+			if (historyCount != 0)
+			{
+				zoneStats.cpuAverage /= historyCount;
+				zoneStats.gpuAverage /= historyCount;
+				zoneStats.callsPerFrame /= historyCount;
+			}
+
+			stats.PushBack(zoneStats);
+		}
+	}
+
+	// Print the statistics for every zone to the console.
+	void Profiler::PrintReport() const
+	{
+		Array<ProfileZoneStats> stats;
+		GetZoneStats(stats);
+
+		std::cout << "Profiler (ms per frame, last " << historyCount << " frames):" << std::endl;
+		std::cout << std::fixed << std::setprecision(3);
+		for (auto it = stats.Begin(); it != stats.End(); ++it)
+		{
+			std::cout << "  " << std::string(it->depth * 2, ' ') << it->name
+				<< ": avg " << it->cpuAverage << ", min " << it->cpuMin << ", max " << it->cpuMax;
+			if (it->gpuAverage != 0.0)
+				std::cout << ", gpu " << it->gpuAverage;
+			std::cout << ", calls " << it->callsPerFrame << std::endl;
+		}
+		std::cout.unsetf(std::ios::floatfield);
+
+		unsigned long dropped = GetDroppedCount();
+		if (dropped != 0)
+			std::cout << "  " << dropped << " timings were dropped." << std::endl;
+	}
+
+	// Show or hide a list of zones and their times on top of the game.
+	// Params:
+	//   enabled = Whether the overlay should be drawn.
+	void Profiler::SetOverlayEnabled(bool enabled_)
+	{
+		overlayEnabled = enabled_;
+	}
+
+	// Is the overlay being drawn?
+	bool Profiler::IsOverlayEnabled() const
+	{
+		return overlayEnabled;
+	}
+
+	// Set the font used to write zone names and times in the overlay.
+	// Params:
+	//   font = The font to use, or nullptr to only draw bars.
+	void Profiler::SetOverlayFont(const Font* font)
+	{
+		overlayFont = font;
+	}
+
+	// Keep every zone recorded during the next few frames so that they can be
+	// exported. Any previous capture is discarded.
+	// Params:
+	//   frames = The number of frames to capture.
+	void Profiler::StartCapture(unsigned frames)
+	{
+		capture.Clear();
+		captureFramesLeft = frames;
+	}
+
+	// Is a capture still in progress?
+	bool Profiler::IsCapturing() const
+	{
+		return captureFramesLeft != 0;
+	}
+
+	// Write the last capture to a file in the Chrome trace event format.
+	// Params:
+	//   filename = The path of the file to write.
+	// Returns:
+	//   True if the file was written, false otherwise.
+	bool Profiler::ExportChromeTrace(const std::string& filename) const
+	{
+		std::ofstream file(filename);
+		if (!file.is_open())
+		{
+			std::cout << "ERROR in Profiler: Could not open " << filename << " for writing." << std::endl;
+			return false;
+		}
+
+		file << "{\"traceEvents\":[\n";
+		file << std::fixed << std::setprecision(3);
+
+		// Thread names
+		bool first = true;
+		{
+			BufferList& buffers = GetBufferList();
+			std::lock_guard<std::mutex> lock(buffers.nameMutex);
+			for (auto it = buffers.names.begin(); it != buffers.names.end(); ++it)
+			{
+				file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+					<< it->first << ",\"args\":{\"name\":\"" << EscapeJSON(it->second) << "\"}}";
+				first = false;
+			}
+		}
+		file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+			<< gpuThread << ",\"args\":{\"name\":\"GPU\"}}";
+
+		// Complete events, with times in microseconds
+		for (auto it = capture.Begin(); it != capture.End(); ++it)
+		{
+			file << ",\n{\"name\":\"" << EscapeJSON(zones[it->zoneID]->name) << "\",\"cat\":\""
+				<< (it->thread == gpuThread ? "GPU" : "CPU") << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << it->thread
+				<< ",\"ts\":" << it->start / nanosecondsPerMicrosecond
+				<< ",\"dur\":" << (it->end - it->start) / nanosecondsPerMicrosecond << "}";
+		}
+
+		file << "\n]}\n";
+		return file.good();
+	}
+
+	// Are GPU times being measured?
+	bool Profiler::HasGPUTimer() const
+	{
+		return !gpuTimer->IsNull();
+	}
+
+	// Returns the number of timings that were lost because a thread recorded
+	// more zones in a single frame than its buffer could hold.
+	unsigned long Profiler::GetDroppedCount() const
+	{
+		unsigned long dropped = 0;
+		for (ThreadBuffer* buffer = GetBufferList().first.load(std::memory_order_acquire);
+			buffer != nullptr; buffer = buffer->next)
+			dropped += buffer->dropped.load(std::memory_order_relaxed);
+		return dropped;
+	}
+
+	// Get the ID of a zone, registering it if needed. Used by the PROFILE_SCOPE macros.
+	// Params:
+	//   name = The name of the zone.
+	unsigned Profiler::RegisterZone(const std::string& name)
+	{
+		ZoneRegistry& registry = GetZoneRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		auto location = registry.ids.find(name);
+		if (location != registry.ids.end())
+			return location->second;
+
+		unsigned id = static_cast<unsigned>(registry.names.Size());
+		registry.names.PushBack(name);
+		registry.ids.emplace(name, id);
+		return id;
+	}
+
+	// Set the name shown for the calling thread in exported captures.
+	// Params:
+	//   name = The name of the thread, e.g. "Worker 1".
+	void Profiler::SetThreadName(const std::string& name)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+
+		BufferList& buffers = GetBufferList();
+		std::lock_guard<std::mutex> lock(buffers.nameMutex);
+		buffers.names[buffer.index] = name;
+	}
+
+	// Enter a zone.
+	// Params:
+	//   zoneID = The ID returned by Profiler::RegisterZone.
+	//   gpu = Whether GPU time should also be measured.
+	ProfileScope::ProfileScope(unsigned zoneID_, bool gpu_)
+		: zoneID(zoneID_), gpu(false), start(0)
+	{
+		if (!enabled.load(std::memory_order_relaxed))
+		{
+			zoneID = static_cast<unsigned>(-1);
+			return;
+		}
+
+		ThreadBuffer& buffer = GetThreadBuffer();
+
+		// GPU zones only make sense on the thread that draws
+		if (gpu_ && std::this_thread::get_id() == mainThread && activeProfiler != nullptr)
+		{
+			gpu = true;
+			activeProfiler->BeginGPUZone(zoneID, buffer.depth);
+		}
+
+		++buffer.depth;
+		start = GetTicks();
+	}
+
+	// Leave the zone, recording the time spent in it.
+	ProfileScope::~ProfileScope()
+	{
+		if (zoneID == static_cast<unsigned>(-1))
+			return;
+
+		long long end = GetTicks();
+		ThreadBuffer& buffer = *threadBuffer;
+		--buffer.depth;
+
+		if (gpu && activeProfiler != nullptr)
+			activeProfiler->EndGPUZone();
+
+		// Drop the timing if the main thread hasn't collected enough of the buffer
+		unsigned write = buffer.writeIndex.load(std::memory_order_relaxed);
+		if (write - buffer.readIndex.load(std::memory_order_acquire) >= bufferCapacity)
+		{
+			buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		Sample& sample = buffer.samples[write & (bufferCapacity - 1)];
+		sample.start = start;
+		sample.end = end;
+		sample.zoneID = zoneID;
+		sample.depth = buffer.depth;
+
+		// Publish the sample to the main thread
+		buffer.writeIndex.store(write + 1, std::memory_order_release);
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	Profiler::ZoneHistory::ZoneHistory()
+		: depth(0), cpuTime(), gpuTime(), calls(), frameCPU(0), frameGPU(0), frameCalls(0)
+	{
+	}
+
+	// Add a timing to the current frame's totals.
+	void Profiler::AddSample(unsigned zoneID, unsigned depth, long long start, long long end, unsigned thread, bool gpu)
+	{
+		if (zoneID >= zones.Size())
+			return;
+
+		ZoneHistory& zone = *zones[zoneID];
+		if (gpu)
+		{
+			zone.frameGPU += end - start;
+		}
+		else
+		{
+			zone.frameCPU += end - start;
+			++zone.frameCalls;
+			zone.depth = depth;
+		}
+
+		if (captureFramesLeft != 0)
+		{
+			CaptureSample sample = { start, end, zoneID, thread };
+			capture.PushBack(sample);
+		}
+	}
+
+	// Begin a GPU zone. Called by ProfileScope.
+	void Profiler::BeginGPUZone(unsigned zoneID, unsigned depth)
+	{
+		gpuTimer->Begin(zoneID, depth);
+	}
+
+	// End the most recent GPU zone. Called by ProfileScope.
+	void Profiler::EndGPUZone()
+	{
+		gpuTimer->End();
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Function Definitions:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Get the current time in nanoseconds.
+		long long GetTicks()
+		{
+			using namespace std::chrono;
+			return duration_cast<nanoseconds>(steady_clock::now() - startTime).count();
+		}
+
+		// All thread buffers.
+		BufferList& GetBufferList()
+		{
+			static BufferList buffers;
+			return buffers;
+		}
+
+		// Names and IDs of all zones.
+		ZoneRegistry& GetZoneRegistry()
+		{
+			static ZoneRegistry registry;
+			return registry;
+		}
+
+		// Get the calling thread's buffer, creating it if needed.
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (threadBuffer != nullptr)
+				return *threadBuffer;
+
+			BufferList& buffers = GetBufferList();
+			threadBuffer = new ThreadBuffer(buffers.count.fetch_add(1));
+
+			// Add to the front of the list without locking
+			ThreadBuffer* first = buffers.first.load(std::memory_order_relaxed);
+			do
+			{
+				threadBuffer->next = first;
+			} while (!buffers.first.compare_exchange_weak(first, threadBuffer,
+				std::memory_order_release, std::memory_order_relaxed));
+
+			return *threadBuffer;
+		}
+
+		// Escape a string for use in JSON.
+		std::string EscapeJSON(const std::string& text)
+		{
+			std::string escaped;
+			for (char c : text)
+			{
+				if (c == '"' || c == '\\')
+					escaped += '\\';
+				if (static_cast<unsigned char>(c) < 0x20)
+					continue;
+				escaped += c;
+			}
+			return escaped;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -27,6 +27,9 @@
 #include "PostEffect.h"
 #include "ShaderProgram.h"
 
+// Systems
+#include "Profiler.h"	// PROFILE_GPU_SCOPE
+
 //------------------------------------------------------------------------------
 
 namespace Beta
@@ -248,6 +251,8 @@ namespace Beta
 
 	void Renderer::ApplyEffects()
 	{
+		PROFILE_GPU_SCOPE("PostEffects");
+
 		// For each effect
 		for (auto it = effects.Begin(); it != effects.End(); ++it)
 		{
@@ -32,6 +32,7 @@
 // Systems
 #include "EngineCore.h"	  // GetFilePath
 #include "GraphicsEngine.h" // IsInitialized
+#include "UniformBuffer.h"  // FindBindingPoint
 
 #include "Array.h"
 
@@ -50,244 +51,290 @@ namespace Beta
 
 	std::string ShaderProgram::shaderPath = "Shaders/";
 
+	// Program most recently set with Use, so setting its uniforms doesn't require switching programs
+	static unsigned activeProgram = 0;
+
+	// Uniform values and buffers sent this frame and last frame
+	static unsigned uploadsThisFrame = 0;
+	static unsigned uploadsLastFrame = 0;
+
+	// List of all programs, for ReloadFile
+	static ShaderProgram* firstProgram = nullptr;
+
 	//------------------------------------------------------------------------------
 	// Public Functions:
 	//------------------------------------------------------------------------------
 
-	ShaderProgram::~ShaderProgram()
+	UniformHandle::UniformHandle()
+		: program(0), location(-1)
 	{
-		unsigned returnedShaders[2];
-		int shaderCount = 0;
-
-		memset(returnedShaders, 0, 2 * sizeof(GLuint));
+	}
 
-		glGetAttachedShaders(id,
-			2,
-			&shaderCount,
-			returnedShaders);
+	bool UniformHandle::IsValid() const
+	{
+		return location != -1;
+	}
 
-		for (int shaderIdx = 0; shaderIdx < shaderCount; ++shaderIdx)
-			glDeleteShader(returnedShaders[shaderIdx]);
+	ShaderProgram::~ShaderProgram()
+	{
+		if (prevProgram != nullptr)
+			prevProgram->nextProgram = nextProgram;
+		else
+			firstProgram = nextProgram;
+		if (nextProgram != nullptr)
+			nextProgram->prevProgram = prevProgram;
 
-		glDeleteProgram(id);
+		DeleteProgram(id);
 	}
 
 	void ShaderProgram::Use() const
 	{
 		glUseProgram(id);
+		activeProgram = id;
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, int value) const
 	{
-		int location = GetUniformLocation(name);
-
-#if BE_GL_4_3_API
-		glProgramUniform1i(id, location, value);
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform1i(location, value);
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), value);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, float value) const
 	{
-		int location = GetUniformLocation(name);
-#if BE_GL_4_3_API
-		glProgramUniform1f(id, location, value);
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform1f(location, value);
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), value);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, bool value) const
 	{
-		int location = GetUniformLocation(name);
-#if BE_GL_4_3_API
-		glProgramUniform1i(id, location, value);
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform1i(location, value);
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), value);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Vector2D & value) const
 	{
-		int location = GetUniformLocation(name);
-#if BE_GL_4_3_API
-		glProgramUniform2f(id, location, value.x, value.y);
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform2f(location, value.x, value.y);
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), value);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Vector3D & value) const
 	{
-		int location = GetUniformLocation(name);
-		glm::vec3& v = static_cast<glm::vec3&>(*static_cast<glm::vec3*>(value.data));
-#if BE_GL_4_3_API
-		glProgramUniform3f(id, location, v.x, v.y, v.z);
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform3f(location, v.x, v.y, v.z);
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), value);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Color & value) const
 	{
-		int location = GetUniformLocation(name);
-#if BE_GL_4_3_API
-		glProgramUniform4f(id, location, value.r, value.g, value.b, value.a);
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform4f(location, value.r, value.g, value.b, value.a);
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), value);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Matrix2D & transform) const
 	{
-		int location = GetUniformLocation(name);
-#if BE_GL_4_3_API
-		glProgramUniformMatrix3fv(id, location, 1, GL_FALSE, &transform.m[0][0]);
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniformMatrix3fv(location, 1, GL_TRUE, &transform.m[0][0]);
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), transform);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Matrix3D & transform) const
 	{
-		int location = GetUniformLocation(name);
-		glm::mat4& matrix = static_cast<glm::mat4&>(*static_cast<glm::mat4*>(transform.data));
-#if BE_GL_4_3_API
-		glProgramUniformMatrix4fv(id, location, 1, GL_FALSE, glm::value_ptr(matrix));
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), transform);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Array<int> & values) const
 	{
-		int location = GetUniformLocation(name);
-#if BE_GL_4_3_API
-		glProgramUniform1iv(id, location, static_cast<GLsizei>(values.Size()), values.Data());
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform1iv(location, static_cast<GLsizei>(values.Size()), values.Data());
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), values);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Array<float> & values) const
 	{
-		int location = GetUniformLocation(name);
-#if BE_GL_4_3_API
-		glProgramUniform1fv(id, location, static_cast<GLsizei>(values.Size()), values.Data());
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform1fv(location, static_cast<GLsizei>(values.Size()), values.Data());
-		glUseProgram(lastProgram);
-#endif
+		SetUniform(GetUniform(name), values);
 	}
 
 	void ShaderProgram::SetUniform(const std::string & name, const Array<Vector2D> & values) const
 	{
-		int location = GetUniformLocation(name);
-		Array<float> floatValues;
+		SetUniform(GetUniform(name), values);
+	}
+
+	void ShaderProgram::SetUniform(const std::string & name, const Array<Vector3D> & values) const
+	{
+		SetUniform(GetUniform(name), values);
+	}
+
+	void ShaderProgram::SetUniform(const std::string & name, const Array<Color> & values) const
+	{
+		SetUniform(GetUniform(name), values);
+	}
+
+	UniformHandle ShaderProgram::GetUniform(const std::string & name) const
+	{
+		return UniformHandle(id, GetUniformLocation(name));
+	}
+
+	const SpriteUniforms& ShaderProgram::GetSpriteUniforms() const
+	{
+		return spriteUniforms;
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, int value) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		UniformValue& stored = StoreUniform(uniform.location, UT_Int, 1);
+		stored.ints.PushBack(value);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, float value) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		UniformValue& stored = StoreUniform(uniform.location, UT_Float, 1);
+		stored.floats.PushBack(value);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, bool value) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		UniformValue& stored = StoreUniform(uniform.location, UT_Int, 1);
+		stored.ints.PushBack(value);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Vector2D & value) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		UniformValue& stored = StoreUniform(uniform.location, UT_Vector2, 1);
+		stored.floats.PushBack(value.x);
+		stored.floats.PushBack(value.y);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Vector3D & value) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		const glm::vec3& v = GlmVector(value);
+		UniformValue& stored = StoreUniform(uniform.location, UT_Vector3, 1);
+		stored.floats.PushBack(v.x);
+		stored.floats.PushBack(v.y);
+		stored.floats.PushBack(v.z);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Color & value) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		UniformValue& stored = StoreUniform(uniform.location, UT_Vector4, 1);
+		stored.floats.PushBack(value.r);
+		stored.floats.PushBack(value.g);
+		stored.floats.PushBack(value.b);
+		stored.floats.PushBack(value.a);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Matrix2D & transform) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		UniformValue& stored = StoreUniform(uniform.location, UT_Matrix3, 1);
+		for (int row = 0; row < 3; ++row)
+			for (int column = 0; column < 3; ++column)
+				stored.floats.PushBack(transform.m[row][column]);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Matrix3D & transform) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		const float* matrix = glm::value_ptr(GlmMatrix(transform));
+		UniformValue& stored = StoreUniform(uniform.location, UT_Matrix4, 1);
+		for (int i = 0; i < 16; ++i)
+			stored.floats.PushBack(matrix[i]);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Array<int> & values) const
+	{
+		if (!BeginUpload(uniform))
+			return;
 		size_t size = values.Size();
-		floatValues.Reserve(size * 2);
+		UniformValue& stored = StoreUniform(uniform.location, UT_Int, static_cast<int>(size));
+		stored.ints.Reserve(size);
+		for (size_t i = 0; i < size; ++i)
+			stored.ints.PushBack(values[i]);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Array<float> & values) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		size_t size = values.Size();
+		UniformValue& stored = StoreUniform(uniform.location, UT_Float, static_cast<int>(size));
+		stored.floats.Reserve(size);
+		for (size_t i = 0; i < size; ++i)
+			stored.floats.PushBack(values[i]);
+		UploadUniform(uniform.location, stored);
+		EndUpload();
+	}
+
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Array<Vector2D> & values) const
+	{
+		if (!BeginUpload(uniform))
+			return;
+		size_t size = values.Size();
+		UniformValue& stored = StoreUniform(uniform.location, UT_Vector2, static_cast<int>(size));
+		stored.floats.Reserve(size * 2);
 		for (size_t i = 0; i < size; ++i)
 		{
-			floatValues.PushBack(values[i].x);
-			floatValues.PushBack(values[i].y);
+			stored.floats.PushBack(values[i].x);
+			stored.floats.PushBack(values[i].y);
 		}
-#if BE_GL_4_3_API
-		glProgramUniform2fv(id, location, static_cast<GLsizei>(values.Size()), floatValues.Data());
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform2fv(location, static_cast<GLsizei>(values.Size()), floatValues.Data());
-		glUseProgram(lastProgram);
-#endif
+		UploadUniform(uniform.location, stored);
+		EndUpload();
 	}
 
-	void ShaderProgram::SetUniform(const std::string & name, const Array<Vector3D> & values) const
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Array<Vector3D> & values) const
 	{
-		int location = GetUniformLocation(name);
-		Array<float> floatValues;
+		if (!BeginUpload(uniform))
+			return;
 		size_t size = values.Size();
-		floatValues.Reserve(size * 3);
+		UniformValue& stored = StoreUniform(uniform.location, UT_Vector3, static_cast<int>(size));
+		stored.floats.Reserve(size * 3);
 		for (size_t i = 0; i < size; ++i)
 		{
-			const glm::vec3& v = *static_cast<const glm::vec3*>(values[i].data);
-			floatValues.PushBack(v.x);
-			floatValues.PushBack(v.y);
-			floatValues.PushBack(v.z);
+			const glm::vec3& v = GlmVector(values[i]);
+			stored.floats.PushBack(v.x);
+			stored.floats.PushBack(v.y);
+			stored.floats.PushBack(v.z);
 		}
-#if BE_GL_4_3_API
-		glProgramUniform3fv(id, location, static_cast<GLsizei>(values.Size()), floatValues.Data());
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform3fv(location, static_cast<GLsizei>(values.Size()), floatValues.Data());
-		glUseProgram(lastProgram);
-#endif
+		UploadUniform(uniform.location, stored);
+		EndUpload();
 	}
 
-	void ShaderProgram::SetUniform(const std::string & name, const Array<Color> & values) const
+	void ShaderProgram::SetUniform(const UniformHandle & uniform, const Array<Color> & values) const
 	{
-		int location = GetUniformLocation(name);
-		Array<float> floatValues;
+		if (!BeginUpload(uniform))
+			return;
 		size_t size = values.Size();
-		floatValues.Reserve(size * 4);
+		UniformValue& stored = StoreUniform(uniform.location, UT_Vector4, static_cast<int>(size));
+		stored.floats.Reserve(size * 4);
 		for (size_t i = 0; i < size; ++i)
 		{
-			floatValues.PushBack(values[i].r);
-			floatValues.PushBack(values[i].g);
-			floatValues.PushBack(values[i].b);
-			floatValues.PushBack(values[i].a);
+			stored.floats.PushBack(values[i].r);
+			stored.floats.PushBack(values[i].g);
+			stored.floats.PushBack(values[i].b);
+			stored.floats.PushBack(values[i].a);
 		}
-#if BE_GL_4_3_API
-		glProgramUniform4fv(id, location, static_cast<GLsizei>(values.Size()), floatValues.Data());
-#else
-		int lastProgram;
-		glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
-		Use();
-		glUniform4fv(location, static_cast<GLsizei>(values.Size()), floatValues.Data());
-		glUseProgram(lastProgram);
-#endif
+		UploadUniform(uniform.location, stored);
+		EndUpload();
 	}
 
 	bool ShaderProgram::operator==(const ShaderProgram & other) const
@@ -295,15 +342,125 @@ namespace Beta
 		return (vertexShader == other.vertexShader && pixelShader == other.pixelShader);
 	}
 
+	unsigned ShaderProgram::GetUniformUploadCount()
+	{
+		return uploadsLastFrame;
+	}
+
 	ShaderProgram* ShaderProgram::CreateProgramFromFile(const std::string & vertexShaderFile, const std::string & fragmentShaderFile)
 	{
+		unsigned id = LinkProgramFromFiles(vertexShaderFile, fragmentShaderFile);
+		if (id == 0)
+			return nullptr;
+
+		// Return completed program
+		return new ShaderProgram(id, vertexShaderFile, fragmentShaderFile);
+	}
+
+	// Compile and link the program's shader files again, after they have changed.
+	// If the new shaders can't be compiled or linked, the old program is kept.
+	// Uniform values set on the old program are set again on the new one. The
+	// program gets a new id, so handles from GetUniform must be found again.
+	// Returns:
+	//   True if the program was rebuilt, false otherwise.
+	bool ShaderProgram::Reload()
+	{
+		unsigned newId = LinkProgramFromFiles(vertexShader, pixelShader);
+		if (newId == 0)
+			return false;
+
+		DeleteProgram(id);
+		id = newId;
+
+		// Locations can change when a program is linked again, so old values are found by name
+		std::map<std::string, int> oldLocations;
+		oldLocations.swap(uniformLocations);
+		Array<UniformValue> oldValues(std::move(uniformValues));
+		uniformValues.Clear();
+
+		attributeLocations.clear();
+		FindUniforms();
+
+		// A new program starts with every uniform at zero, including values like
+		// tint colors and texture units that are only set once.
+		for (auto it = oldLocations.begin(); it != oldLocations.end(); ++it)
+		{
+			int oldLocation = it->second;
+			if (oldLocation < 0 || static_cast<size_t>(oldLocation) >= oldValues.Size()
+				|| oldValues[oldLocation].type == UT_None)
+				continue;
+
+			UniformHandle uniform(id, FindUniformLocation(it->first));
+			if (!BeginUpload(uniform))
+				continue;
+
+			const UniformValue& oldValue = oldValues[oldLocation];
+			UniformValue& stored = StoreUniform(uniform.location, oldValue.type, oldValue.count);
+			stored.ints = oldValue.ints;
+			stored.floats = oldValue.floats;
+			UploadUniform(uniform.location, stored);
+			EndUpload();
+		}
+
+		return true;
+	}
+
+	// Rebuild every program that uses a shader file, after the file has changed.
+	// Params:
+	//   filename = The file name of the shader.
+	// Returns:
+	//   True if any program uses the file, false otherwise.
+	bool ShaderProgram::ReloadFile(const std::string& filename)
+	{
+		bool used = false;
 
+		for (ShaderProgram* program = firstProgram; program != nullptr; program = program->nextProgram)
+		{
+			if (program->vertexShader != filename && program->pixelShader != filename)
+				continue;
+
+			program->Reload();
+			used = true;
+		}
+
+		return used;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	UniformHandle::UniformHandle(unsigned program, int location)
+		: program(program), location(location)
+	{
+	}
+
+	ShaderProgram::UniformValue::UniformValue()
+		: type(UT_None), count(0)
+	{
+	}
+
+	ShaderProgram::ShaderProgram(unsigned id, const std::string & vertexShader, const std::string & pixelShader)
+		: id(id), vertexShader(vertexShader), pixelShader(pixelShader), nextProgram(firstProgram), prevProgram(nullptr)
+	{
+		if (firstProgram != nullptr)
+			firstProgram->prevProgram = this;
+		firstProgram = this;
+
+		FindUniforms();
+	}
+
+	// Create a program from shader files and link it.
+	// Returns:
+	//   The id of the program, or 0 if it could not be compiled or linked.
+	unsigned ShaderProgram::LinkProgramFromFiles(const std::string & vertexShaderFile, const std::string & fragmentShaderFile)
+	{
 		// Don't load shader if graphics is not initialized
 		if (EngineGetModule(GraphicsEngine) == nullptr)
 		{
 			std::cout << "Error loading shader " << vertexShaderFile << ", " << fragmentShaderFile << "; graphics system not "
 				<< "yet initialized." << std::endl;
-			return nullptr;
+			return 0;
 		}
 
 		// Get id for program
@@ -326,9 +483,7 @@ namespace Beta
 		if (status == GL_TRUE && fragSuccess && vertSuccess)
 		{
 			std::cout << "Shaders linked successfully." << std::endl;
-
-			// Return completed program
-			return new ShaderProgram(id, vertexShaderFile, fragmentShaderFile);
+			return id;
 		}
 		else
 		{
@@ -348,39 +503,94 @@ namespace Beta
 				std::cout << "Linker error/warning info: " << errorLogString << std::endl;
 			}
 
-			// Delete the program to avoid leaks.
-			glDeleteProgram(id);
+			// Delete the program and its shaders to avoid leaks.
+			DeleteProgram(id);
 
-			return nullptr;
+			return 0;
 		}
 	}
 
-	//------------------------------------------------------------------------------
-	// Private Functions:
-	//------------------------------------------------------------------------------
-
-	ShaderProgram::ShaderProgram(unsigned id, const std::string & vertexShader, const std::string & pixelShader)
-		: id(id), vertexShader(vertexShader), pixelShader(pixelShader)
+	// Delete a program along with the shaders attached to it.
+	void ShaderProgram::DeleteProgram(unsigned program)
 	{
+		unsigned returnedShaders[2];
+		int shaderCount = 0;
+
+		memset(returnedShaders, 0, 2 * sizeof(GLuint));
+
+		glGetAttachedShaders(program,
+			2,
+			&shaderCount,
+			returnedShaders);
+
+		for (int shaderIdx = 0; shaderIdx < shaderCount; ++shaderIdx)
+			glDeleteShader(returnedShaders[shaderIdx]);
+
+		glDeleteProgram(program);
+
+		if (activeProgram == program)
+			activeProgram = 0;
 	}
 
-	int ShaderProgram::GetUniformLocation(const std::string & name) const
+	void ShaderProgram::FindUniforms()
 	{
-		int location = -1;
+		GLint count = 0;
+		GLint maxLength = 0;
 
-       // uniformLocations.;
-
-		std::map<std::string, int>::const_iterator it = uniformLocations.find(name);
+		// Store locations of all active uniforms, so later lookups don't need to ask OpenGL
+		glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+		for (GLint i = 0; i < count; ++i)
+		{
+			GLsizei length = 0;
+			GLint size = 0;
+			GLenum type = 0;
+			std::string name(maxLength, '\0');
+			glGetActiveUniform(id, i, maxLength, &length, &size, &type, &name[0]);
+			name.resize(length);
+
+			// Arrays are listed by their first element
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+				name.resize(name.size() - 3);
+
+			// Uniforms inside blocks don't have locations
+			int location = glGetUniformLocation(id, name.c_str());
+			if (location != -1)
+				uniformLocations[name] = location;
+		}
 
-		// We've tried to locate this before
-		if (it != uniformLocations.end())
-			location = it->second;
-		// This is the first lookup
-		else
+		// Connect uniform blocks to the buffers with the same names
+		glGetProgramiv(id, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+		glGetProgramiv(id, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+		for (GLint i = 0; i < count; ++i)
 		{
-			location = glGetUniformLocation(id, name.c_str());
-			uniformLocations.emplace(name, location);
+			GLsizei length = 0;
+			std::string name(maxLength, '\0');
+			glGetActiveUniformBlockName(id, i, maxLength, &length, &name[0]);
+			name.resize(length);
+
+			unsigned bindingPoint;
+			if (UniformBuffer::FindBindingPoint(name, bindingPoint))
+				glUniformBlockBinding(id, i, bindingPoint);
+			else
+				std::cout << "ERROR in ShaderProgram: No uniform buffer exists for block " << name
+					<< " in shader " << id << "." << std::endl;
 		}
+
+		// Uniforms set by the engine for every sprite
+		spriteUniforms.worldMatrix = UniformHandle(id, FindUniformLocation("worldMatrix"));
+		spriteUniforms.uvOffset = UniformHandle(id, FindUniformLocation("uvOffset"));
+		spriteUniforms.uvStride = UniformHandle(id, FindUniformLocation("uvStride"));
+		spriteUniforms.flipX = UniformHandle(id, FindUniformLocation("flipX"));
+		spriteUniforms.flipY = UniformHandle(id, FindUniformLocation("flipY"));
+		spriteUniforms.diffuse = UniformHandle(id, FindUniformLocation("diffuse"));
+		spriteUniforms.tintColor = UniformHandle(id, FindUniformLocation("tintColor"));
+		spriteUniforms.blendColor = UniformHandle(id, FindUniformLocation("blendColor"));
+	}
+
+	int ShaderProgram::GetUniformLocation(const std::string & name) const
+	{
+		int location = FindUniformLocation(name);
 #if _DEBUG
 		if (location == -1)
 		{
@@ -398,6 +608,20 @@ namespace Beta
 		return location;
 	}
 
+	int ShaderProgram::FindUniformLocation(const std::string & name) const
+	{
+		std::map<std::string, int>::const_iterator it = uniformLocations.find(name);
+
+		// Found when the program was linked, or tried before
+		if (it != uniformLocations.end())
+			return it->second;
+
+		// Not an active uniform name, but may still be valid (e.g. an array element)
+		int location = glGetUniformLocation(id, name.c_str());
+		uniformLocations.emplace(name, location);
+		return location;
+	}
+
 	int ShaderProgram::GetAttributeLocation(const std::string & name) const
 	{
 		int location = -1;
@@ -513,6 +737,130 @@ namespace Beta
 		}
 		return buffer.str();
 	}
+
+	bool ShaderProgram::BeginUpload(const UniformHandle & uniform) const
+	{
+		// Missing uniforms are ignored, like they would be by OpenGL
+		if (!uniform.IsValid())
+			return false;
+
+		if (uniform.program != id)
+		{
+			std::cout << "ERROR in ShaderProgram: Uniform handle from shader " << uniform.program
+				<< " used with shader " << id << "." << std::endl;
+			return false;
+		}
+
+		CountUpload();
+
+#if !BE_GL_4_3_API
+		if (activeProgram != id)
+			glUseProgram(id);
+#endif
+		return true;
+	}
+
+	ShaderProgram::UniformValue& ShaderProgram::StoreUniform(int location, UniformType type, int count) const
+	{
+		if (uniformValues.Size() <= static_cast<size_t>(location))
+			uniformValues.Resize(location + 1);
+
+		UniformValue& value = uniformValues[location];
+		value.type = type;
+		value.count = count;
+		value.ints.Clear();
+		value.floats.Clear();
+		return value;
+	}
+
+	void ShaderProgram::UploadUniform(int location, const UniformValue& value) const
+	{
+		const GLsizei count = value.count;
+		const GLint* ints = value.ints.Data();
+		const GLfloat* floats = value.floats.Data();
+
+		switch (value.type)
+		{
+		case UT_Int:
+#if BE_GL_4_3_API
+			glProgramUniform1iv(id, location, count, ints);
+#else
+			glUniform1iv(location, count, ints);
+#endif
+			break;
+		case UT_Float:
+#if BE_GL_4_3_API
+			glProgramUniform1fv(id, location, count, floats);
+#else
+			glUniform1fv(location, count, floats);
+#endif
+			break;
+		case UT_Vector2:
+#if BE_GL_4_3_API
+			glProgramUniform2fv(id, location, count, floats);
+#else
+			glUniform2fv(location, count, floats);
+#endif
+			break;
+		case UT_Vector3:
+#if BE_GL_4_3_API
+			glProgramUniform3fv(id, location, count, floats);
+#else
+			glUniform3fv(location, count, floats);
+#endif
+			break;
+		case UT_Vector4:
+#if BE_GL_4_3_API
+			glProgramUniform4fv(id, location, count, floats);
+#else
+			glUniform4fv(location, count, floats);
+#endif
+			break;
+		case UT_Matrix3:
+#if BE_GL_4_3_API
+			glProgramUniformMatrix3fv(id, location, count, GL_FALSE, floats);
+#else
+			glUniformMatrix3fv(location, count, GL_TRUE, floats);
+#endif
+			break;
+		case UT_Matrix4:
+#if BE_GL_4_3_API
+			glProgramUniformMatrix4fv(id, location, count, GL_FALSE, floats);
+#else
+			glUniformMatrix4fv(location, count, GL_FALSE, floats);
+#endif
+			break;
+		default:
+			break;
+		}
+	}
+
+	void ShaderProgram::EndUpload() const
+	{
+#if !BE_GL_4_3_API
+		if (activeProgram != id)
+			glUseProgram(activeProgram);
+#endif
+	}
+
+	void ShaderProgram::CountUpload()
+	{
+		++uploadsThisFrame;
+	}
+
+	void ShaderProgram::EndFrame()
+	{
+		uploadsLastFrame = uploadsThisFrame;
+		uploadsThisFrame = 0;
+	}
+
+	// Make a program current by its id, e.g. to restore a program saved with
+	// glGetIntegerv. Keeps track of it so that uniform uploads restore it.
+	void ShaderProgram::UseProgramID(unsigned programID)
+	{
+		glUseProgram(programID);
+		activeProgram = programID;
+	}
 }
 
 //------------------------------------------------------------------------------
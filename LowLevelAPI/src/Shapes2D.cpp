@@ -61,7 +61,7 @@ namespace Beta
 	}
 
 	BoundingRectangle::BoundingRectangle(const Vector2D & center, const Vector2D & extents_)
-		: center(center), extents(Vector2D(abs(extents_.x), abs(extents_.y)))
+		: center(center), extents(Vector2D(fabsf(extents_.x), fabsf(extents_.y)))
 	{
 		top = center.y + extents.y;
 		bottom = center.y - extents.y;
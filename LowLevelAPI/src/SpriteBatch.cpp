@@ -0,0 +1,302 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	SpriteBatch.cpp
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "SpriteBatch.h"
+
+// Dependencies
+#include <glad.h>
+#include "../../glfw/src/glfw3.h"
+
+// Systems
+#include "GraphicsEngine.h"	// SetBlendMode, GetBlendMode
+#include "ShaderProgram.h"	// Use, SetUniform
+
+// Resources
+#include "Mesh.h"		// arrayObjectID, numVertices, drawMode
+#include "Texture.h"	// GetBufferID
+
+// Math
+#include "Matrix2D.h"
+#include "Vector2D.h"
+#include "Color.h"
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Consts:
+	//------------------------------------------------------------------------------
+
+	// First attribute location used for per-instance data. Locations below this
+	// are used by the mesh itself (see BufferType).
+	static const GLuint firstInstanceAttribute = BT_Num;
+
+	// Number of vec4 attributes in each instance
+	static const GLuint numInstanceAttributes = 4;
+
+	// Initial capacity of the instance buffer, in instances
+	static const unsigned initialInstanceCapacity = 1024;
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	SpriteBatchStats::SpriteBatchStats()
+		: sprites(0), batches(0), drawCalls(0), textureBinds(0)
+	{
+	}
+
+	SpriteBatch::SpriteBatch()
+		: shader(nullptr), instanceBuffer(0), instanceBufferCapacity(0)
+	{
+	}
+
+	SpriteBatch::~SpriteBatch()
+	{
+		delete shader;
+		glDeleteBuffers(1, &instanceBuffer);
+	}
+
+	// Load the instancing shader and create the instance buffer.
+	void SpriteBatch::Init()
+	{
+		shader = ShaderProgram::CreateProgramFromFile("spriteShaderInstanced.vert", "spriteShader.frag");
+
+		// Color is supplied per instance, so the shared blend color stays white
+		shader->SetUniform("diffuse", 0);
+		shader->SetUniform("blendColor", Colors::White);
+
+		// Create persistent instance buffer
+		instanceBufferCapacity = initialInstanceCapacity;
+		glGenBuffers(1, &instanceBuffer);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+		glBufferData(GL_ARRAY_BUFFER, instanceBufferCapacity * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		instances.Reserve(initialInstanceCapacity);
+		commands.Reserve(initialInstanceCapacity);
+		sortedInstances.Reserve(initialInstanceCapacity);
+	}
+
+	// Draw any remaining sprites and save the counters for the frame.
+	void SpriteBatch::FrameEnd(GraphicsEngine& graphics)
+	{
+		Flush(graphics);
+
+		frameStats = stats;
+		stats = SpriteBatchStats();
+	}
+
+	// Queue a sprite for drawing.
+	void SpriteBatch::Add(const Mesh& mesh, const Texture& texture, const Matrix2D& transform,
+		float depth, const Color& color, const Vector2D& uvOffset, const Vector2D& uvStride,
+		bool flipX, bool flipY, BlendMode blendMode, const ShaderProgram* shader_)
+	{
+		Instance instance;
+
+		// 2D affine part of the world matrix, stored as columns
+		instance.basis[0] = transform.m[0][0]; instance.basis[1] = transform.m[1][0];
+		instance.basis[2] = transform.m[0][1]; instance.basis[3] = transform.m[1][1];
+		instance.translation[0] = transform.m[0][2];
+		instance.translation[1] = transform.m[1][2];
+		instance.translation[2] = depth;
+		instance.translation[3] = 1.0f;
+
+		// Mirroring a frame is the same as starting at its far edge and stepping backwards
+		instance.uv[0] = flipX ? uvOffset.x + uvStride.x : uvOffset.x;
+		instance.uv[1] = flipY ? uvOffset.y + uvStride.y : uvOffset.y;
+		instance.uv[2] = flipX ? -uvStride.x : uvStride.x;
+		instance.uv[3] = flipY ? -uvStride.y : uvStride.y;
+
+		Color clamped = color.Clamp();
+		instance.color[0] = clamped.r; instance.color[1] = clamped.g;
+		instance.color[2] = clamped.b; instance.color[3] = clamped.a;
+
+		Command command;
+		command.depth = depth;
+		command.shader = shader_ != nullptr ? shader_ : shader;
+		command.blendMode = blendMode;
+		command.textureID = texture.GetBufferID();
+		command.mesh = &mesh;
+		command.instanceIndex = static_cast<unsigned>(instances.Size());
+
+		instances.PushBack(instance);
+		commands.PushBack(command);
+		++stats.sprites;
+	}
+
+	// Draw all queued sprites and empty the queue.
+	void SpriteBatch::Flush(GraphicsEngine& graphics)
+	{
+		if (commands.IsEmpty())
+			return;
+
+		// Order sprites by depth, keeping submission order within each depth.
+		// Consecutive sprites that share state are then drawn together.
+		std::sort(commands.Begin(), commands.End());
+
+		size_t numInstances = commands.Size();
+		sortedInstances.Resize(numInstances);
+		for (size_t i = 0; i < numInstances; ++i)
+		{
+			sortedInstances[i] = instances[commands[i].instanceIndex];
+		}
+
+		// Upload instance data, growing the buffer if needed
+		glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+		if (numInstances > instanceBufferCapacity)
+		{
+			while (instanceBufferCapacity < numInstances)
+				instanceBufferCapacity *= 2;
+		}
+		// Orphan the old storage so we don't stall on draws still using it
+		glBufferData(GL_ARRAY_BUFFER, instanceBufferCapacity * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, numInstances * sizeof(Instance), sortedInstances.Data());
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		// Save state that we will be changing
+		GLint previousProgram;
+		glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+		BlendMode previousBlendMode = graphics.GetBlendMode();
+
+		glActiveTexture(GL_TEXTURE0);
+		GLint previousTexture;
+		glGetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+
+		const ShaderProgram* currentShader = nullptr;
+		unsigned currentTexture = 0;
+		bool textureBound = false;
+
+		size_t start = 0;
+		while (start < numInstances)
+		{
+			const Command& first = commands[start];
+
+			// Find the end of the run of sprites sharing this state
+			size_t end = start + 1;
+			while (end < numInstances
+				&& commands[end].shader == first.shader
+				&& commands[end].blendMode == first.blendMode
+				&& commands[end].textureID == first.textureID
+				&& commands[end].mesh == first.mesh)
+			{
+				++end;
+			}
+
+			// Only change state that differs from the previous run
+			if (first.shader != currentShader)
+			{
+				currentShader = first.shader;
+				currentShader->Use();
+			}
+
+			graphics.SetBlendMode(static_cast<BlendMode>(first.blendMode));
+
+			if (!textureBound || first.textureID != currentTexture)
+			{
+				currentTexture = first.textureID;
+				textureBound = true;
+				glBindTexture(GL_TEXTURE_2D, currentTexture);
+				++stats.textureBinds;
+			}
+
+			// Draw the whole run at once
+			const Mesh& mesh = *first.mesh;
+			BindInstanceAttributes(mesh, static_cast<unsigned>(start));
+			glDrawArraysInstanced(mesh.drawMode, 0, mesh.numVertices, static_cast<GLsizei>(end - start));
+			UnbindInstanceAttributes();
+			++stats.drawCalls;
+
+			start = end;
+		}
+
+		// Restore previous state, through ShaderProgram so it knows which program is current
+		ShaderProgram::UseProgramID(static_cast<unsigned>(previousProgram));
+		graphics.SetBlendMode(previousBlendMode);
+		glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previousTexture));
+
+		instances.Clear();
+		commands.Clear();
+		++stats.batches;
+	}
+
+	// Returns the number of sprites waiting to be drawn.
+	unsigned SpriteBatch::GetQueuedCount() const
+	{
+		return static_cast<unsigned>(commands.Size());
+	}
+
+	// Get the default instancing shader (usually for the purposes of setting uniforms)
+	const ShaderProgram& SpriteBatch::GetShader() const
+	{
+		return *shader;
+	}
+
+	// Returns counters for the most recently completed frame.
+	const SpriteBatchStats& SpriteBatch::GetStats() const
+	{
+		return frameStats;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	bool SpriteBatch::Command::operator<(const Command& other) const
+	{
+		// Back to front, since blending depends on draw order. Sprites at the same
+		// depth may overlap and the depth test is usually off, so they are never
+		// reordered by state: they keep the order in which they were submitted.
+		if (depth != other.depth)
+			return depth < other.depth;
+		return instanceIndex < other.instanceIndex;
+	}
+
+	// Point the instance attributes of the given mesh at the instance buffer.
+	void SpriteBatch::BindInstanceAttributes(const Mesh& mesh, unsigned firstInstance) const
+	{
+		// Attribute pointers are stored in the mesh's VAO
+		glBindVertexArray(mesh.arrayObjectID);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+
+		const size_t baseOffset = firstInstance * sizeof(Instance);
+		for (GLuint i = 0; i < numInstanceAttributes; ++i)
+		{
+			GLuint location = firstInstanceAttribute + i;
+			glEnableVertexAttribArray(location);
+			glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(Instance),
+				(void*)(baseOffset + i * 4 * sizeof(float)));
+			glVertexAttribDivisor(location, 1);
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	// Disable the instance attributes of the bound mesh so that it can still be
+	// drawn without instancing.
+	void SpriteBatch::UnbindInstanceAttributes() const
+	{
+		for (GLuint i = 0; i < numInstanceAttributes; ++i)
+		{
+			glDisableVertexAttribArray(firstInstanceAttribute + i);
+		}
+
+		glBindVertexArray(0);
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -29,7 +29,8 @@ namespace Beta
 	StartupSettings::StartupSettings()
 		: windowWidth(800), windowHeight(600), framerateCap(60),
 		showWindow(true), debugConsole(true), fullscreen(false),
-		allowMaximize(false), closeOnEscape(true), vSync(true)
+		allowMaximize(false), closeOnEscape(true), vSync(true),
+		headless(false), frameLimit(0)
 	{
 	}
 }
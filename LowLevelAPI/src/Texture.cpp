@@ -82,6 +82,12 @@ namespace Beta
 	}
 
 	void Texture::Use(unsigned spriteColumns, unsigned spriteRows, bool flipX, bool flipY, const Vector2D& uvOffset, const ShaderProgram* shader) const
+	{
+		Use(uvOffset, Vector2D(1.0f / static_cast<float>(spriteColumns), 1.0f / static_cast<float>(spriteRows)),
+			flipX, flipY, shader);
+	}
+
+	void Texture::Use(const Vector2D& uvOffset, const Vector2D& uvStride, bool flipX, bool flipY, const ShaderProgram* shader) const
 	{
 		glActiveTexture(GL_TEXTURE0);
 		glBindTexture(GL_TEXTURE_2D, bufferID);
@@ -90,16 +96,16 @@ namespace Beta
 		if (shader == nullptr)
 			shader = &graphics.GetSpriteShader();
 
-		shader->SetUniform("diffuse", 0);
+		const SpriteUniforms& uniforms = shader->GetSpriteUniforms();
+		shader->SetUniform(uniforms.diffuse, 0);
 
 		// Store UV
-		Vector2D modifiedUV = uvOffset;
-		shader->SetUniform("uvOffset", modifiedUV);
-		shader->SetUniform("uvStride", Vector2D(1.0f / static_cast<float>(spriteColumns), 1.0f / static_cast<float>(spriteRows)));
+		shader->SetUniform(uniforms.uvOffset, uvOffset);
+		shader->SetUniform(uniforms.uvStride, uvStride);
 
 		// Flip
-		shader->SetUniform("flipX", flipX);
-		shader->SetUniform("flipY", flipY);
+		shader->SetUniform(uniforms.flipX, flipX);
+		shader->SetUniform(uniforms.flipY, flipY);
 	}
 
 	const std::string& Texture::GetName() const
@@ -112,51 +118,157 @@ namespace Beta
 		return bufferID;
 	}
 
+	// Replace the contents of this texture with a decoded image.
+	// Params:
+	//   image = The image to upload.
+	//   mode = The filtering mode to use for the texture.
+	// Returns:
+	//   True if the image was uploaded, false if its format is not supported.
+	bool Texture::SetImage(const TextureImage& image, TextureFilterMode mode)
+	{
+		return UploadImage(image.pixels, image.width, image.height, image.numChannels, mode);
+	}
+
+	// Replace part of this texture with new pixels.
+	// Params:
+	//   pixels = The pixel data, one byte per channel.
+	//   width, height = The size of the area to replace, in pixels.
+	//   numChannels = The number of color channels in the pixel data (1 to 4).
+	//   x, y = The top-left corner of the area to replace.
+	// Returns:
+	//   True if the pixels were uploaded, false if their format is not supported.
+	bool Texture::SetSubImage(const unsigned char* pixels, int width, int height, int numChannels, int x, int y)
+	{
+		unsigned channelMode = GetChannelFormat(numChannels);
+		if (channelMode == 0)
+		{
+			std::cout << "Error updating texture " << name << std::endl
+				<< "Unknown color channel format." << std::endl;
+			return false;
+		}
+
+		glBindTexture(GL_TEXTURE_2D, bufferID);
+
+		// Rows of 1-3 channel images are not always 4-byte aligned
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, channelMode, GL_UNSIGNED_BYTE, pixels);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+		glGenerateMipmap(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		return true;
+	}
+
 	// Loads a texture from a file
 	Texture* Texture::CreateTextureFromFile(const std::string & filename, TextureFilterMode mode)
+	{
+		// Attempt to open file
+		TextureImage image;
+		if (!LoadImageFromFile(filename, image))
+			return nullptr;
+
+		// Create texture object from bitmap
+		Texture* texture = new Texture(0, filename);
+		if (!texture->UploadImage(image.pixels, image.width, image.height, image.numChannels, mode))
+		{
+			delete texture;
+			return nullptr;
+		}
+
+		// Return finished texture
+		return texture;
+	}
+
+	// Creates an RGBA texture whose pixels will be filled in later with SetSubImage.
+	Texture* Texture::CreateEmptyTexture(unsigned width, unsigned height, const std::string& name, TextureFilterMode mode)
+	{
+		Texture* texture = new Texture(0, name);
+		texture->UploadImage(nullptr, static_cast<int>(width), static_cast<int>(height), 4, mode);
+		return texture;
+	}
+
+	// Reads and decodes an image file without creating a texture.
+	// Does not use OpenGL, so it is safe to call from worker threads.
+	// Params:
+	//   filename = The name of the file, relative to the texture path.
+	//   image = (Out) The decoded image.
+	// Returns:
+	//   True if the image was loaded, false otherwise.
+	bool Texture::LoadImageFromFile(const std::string& filename, TextureImage& image)
 	{
 		// Create full filepath
 		const std::string& enginePath = EngineCore::GetInstance().GetFilePath();
 		std::string filePath = enginePath + texturePath + filename;
 
+		// Discard anything already in the image
+		stbi_image_free(image.pixels);
+		image.pixels = nullptr;
+
 		// Attempt to open file
-		int width, height, numChannels;
-		unsigned char* data = stbi_load(filePath.c_str(), &width, &height, &numChannels, 0);
-		if (data == nullptr || width == 0 || height == 0)
+		image.pixels = stbi_load(filePath.c_str(), &image.width, &image.height, &image.numChannels, 0);
+		if (image.pixels == nullptr || image.width == 0 || image.height == 0)
 		{
 			std::cout << "Error loading texture from file " << filename << std::endl
 				<< "Make sure the specified path is valid." << std::endl;
-			return nullptr;
+			return false;
 		}
 
-		// Pick format based on channels
-		unsigned channelMode = 0;
+		return true;
+	}
+
+	// Creates an empty image.
+	TextureImage::TextureImage()
+		: pixels(nullptr), width(0), height(0), numChannels(0)
+	{
+	}
+
+	// Frees the pixel data.
+	TextureImage::~TextureImage()
+	{
+		stbi_image_free(pixels);
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Creates a texture with the given buffer ID and name
+	Texture::Texture(unsigned buffer, const std::string & name)
+		: bufferID(buffer), name(name), graphics(*EngineGetModule(GraphicsEngine))
+	{
+	}
+
+	// Returns the OpenGL format for pixel data with the given number of channels, or 0 if there is none.
+	unsigned Texture::GetChannelFormat(int numChannels)
+	{
 		switch (numChannels)
 		{
 		case 4:
-			channelMode = GL_RGBA;
-			break;
+			return GL_RGBA;
 		case 3:
-			channelMode = GL_RGB;
-			break;
+			return GL_RGB;
 		case 2:
-			channelMode = GL_RG;
-			break;
+			return GL_RG;
 		case 1:
-			channelMode = GL_RED;
-			break;
+			return GL_RED;
 		default:
-			std::cout << "Error loading texture from file " << filename << std::endl
-				<< "Unknown color channel format." << std::endl;
-			stbi_image_free(data);
-			return nullptr;
-			break;
+			return 0;
 		}
+	}
 
-		// Create texture object from bitmap
-		unsigned bufferID;
-		glGenTextures(1, &bufferID);
-		Texture* texture = new Texture(bufferID, filename);
+	// Uploads pixel data to a new OpenGL texture, replacing the current one.
+	bool Texture::UploadImage(const unsigned char* pixels, int width, int height,
+		int numChannels, TextureFilterMode mode)
+	{
+		// Pick format based on channels
+		unsigned channelMode = GetChannelFormat(numChannels);
+		if (channelMode == 0)
+		{
+			std::cout << "Error loading texture from file " << name << std::endl
+				<< "Unknown color channel format." << std::endl;
+			return false;
+		}
 
 		unsigned minFilter;
 		unsigned magFilter;
@@ -176,12 +288,17 @@ namespace Beta
 			break;
 		}
 
+		// Replace any existing texture object
+		if (bufferID != 0)
+			glDeleteTextures(1, &bufferID);
+		glGenTextures(1, &bufferID);
+
 		// Bind created texture
 		glBindTexture(GL_TEXTURE_2D, bufferID);
 
 		// Load the data
 		glTexImage2D(GL_TEXTURE_2D, 0, channelMode, width,
-			height, 0, channelMode, GL_UNSIGNED_BYTE, data);
+			height, 0, channelMode, GL_UNSIGNED_BYTE, pixels);
 
 		// Generate mipmaps
 		glGenerateMipmap(GL_TEXTURE_2D);
@@ -193,21 +310,7 @@ namespace Beta
 		// Unbind the texture
 		glBindTexture(GL_TEXTURE_2D, 0);
 
-		// Free the image data
-		stbi_image_free(data);
-
-		// Return finished texture
-		return texture;
-	}
-
-	//------------------------------------------------------------------------------
-	// Private Functions:
-	//------------------------------------------------------------------------------
-
-	// Creates a texture with the given buffer ID and name
-	Texture::Texture(unsigned buffer, const std::string & name)
-		: bufferID(buffer), name(name), graphics(*EngineGetModule(GraphicsEngine))
-	{
+		return true;
 	}
 
 	// Loads a texture from an array
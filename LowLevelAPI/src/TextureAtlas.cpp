@@ -0,0 +1,268 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	TextureAtlas.cpp
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "TextureAtlas.h"
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	AtlasRegion::AtlasRegion()
+		: uvSize(1.0f, 1.0f)
+	{
+	}
+
+	AtlasStats::AtlasStats()
+		: pages(0), images(0), usedPixels(0), totalPixels(0), efficiency(0.0f)
+	{
+	}
+
+	// Constructor - Creates an empty atlas. Pages are created as needed.
+	// Params:
+	//   pageSize = The width and height of each page, in pixels.
+	//   padding = The number of pixels to leave around each image.
+	//   mode = The filtering mode to use for the page textures.
+	TextureAtlas::TextureAtlas(unsigned pageSize, unsigned padding, TextureFilterMode mode)
+		: pageSize(pageSize), padding(padding), mode(mode), usedPixels(0)
+	{
+	}
+
+	// Pack an image into the atlas. Must be called on the main thread.
+	// Params:
+	//   name = The name used to find the image later.
+	//   image = The image to pack.
+	//   region = (Out) Where the image was placed.
+	// Returns:
+	//   True if the image was packed (or already had been), false if it is too large for a page.
+	bool TextureAtlas::Add(const std::string& name, const TextureImage& image, AtlasRegion& region)
+	{
+		if (Find(name, region))
+			return true;
+
+		unsigned width = static_cast<unsigned>(image.width);
+		unsigned height = static_cast<unsigned>(image.height);
+		unsigned paddedWidth = width + 2 * padding;
+		unsigned paddedHeight = height + 2 * padding;
+		if (image.pixels == nullptr || paddedWidth > pageSize || paddedHeight > pageSize)
+			return false;
+
+		// Use the first page with room, or start a new one
+		unsigned x = 0;
+		unsigned y = 0;
+		Page* page = nullptr;
+		for (auto it = pages.Begin(); it != pages.End(); ++it)
+		{
+			if (Insert(*it, paddedWidth, paddedHeight, x, y))
+			{
+				page = &*it;
+				break;
+			}
+		}
+		if (page == nullptr)
+		{
+			page = &AddPage();
+			Insert(*page, paddedWidth, paddedHeight, x, y);
+		}
+
+		// Copy the image into the middle of the padded area, repeating its edge pixels outwards
+		const unsigned channels = static_cast<unsigned>(image.numChannels);
+		Array<unsigned char> padded(paddedWidth * paddedHeight * channels);
+		for (unsigned row = 0; row < paddedHeight; ++row)
+		{
+			unsigned sourceRow = static_cast<unsigned>(std::min(std::max(static_cast<int>(row) - static_cast<int>(padding), 0),
+				static_cast<int>(height) - 1));
+			for (unsigned column = 0; column < paddedWidth; ++column)
+			{
+				unsigned sourceColumn = static_cast<unsigned>(std::min(std::max(static_cast<int>(column) - static_cast<int>(padding), 0),
+					static_cast<int>(width) - 1));
+				const unsigned char* source = image.pixels + (sourceRow * width + sourceColumn) * channels;
+				unsigned char* destination = &padded[(row * paddedWidth + column) * channels];
+				for (unsigned c = 0; c < channels; ++c)
+					destination[c] = source[c];
+			}
+		}
+
+		if (!page->texture->SetSubImage(padded.Data(), paddedWidth, paddedHeight, image.numChannels, x, y))
+			return false;
+
+		region.page = page->texture;
+		region.uvOffset = Vector2D(static_cast<float>(x + padding), static_cast<float>(y + padding)) / static_cast<float>(pageSize);
+		region.uvSize = Vector2D(static_cast<float>(width), static_cast<float>(height)) / static_cast<float>(pageSize);
+		regions.emplace(name, region);
+
+		usedPixels += static_cast<unsigned long>(width) * height;
+		return true;
+	}
+
+	// Find an image that was already packed.
+	// Params:
+	//   name = The name given to Add.
+	//   region = (Out) Where the image was placed.
+	// Returns:
+	//   True if the image is in the atlas, false otherwise.
+	bool TextureAtlas::Find(const std::string& name, AtlasRegion& region) const
+	{
+		auto it = regions.find(name);
+		if (it == regions.end())
+			return false;
+
+		region = it->second;
+		return true;
+	}
+
+	// Returns how well images have been packed so far.
+	AtlasStats TextureAtlas::GetStats() const
+	{
+		AtlasStats stats;
+		stats.pages = static_cast<unsigned>(pages.Size());
+		stats.images = static_cast<unsigned>(regions.size());
+		stats.usedPixels = usedPixels;
+		stats.totalPixels = static_cast<unsigned long>(pageSize) * pageSize * stats.pages;
+		if (stats.totalPixels != 0)
+			stats.efficiency = static_cast<float>(stats.usedPixels) / static_cast<float>(stats.totalPixels);
+		return stats;
+	}
+
+	//------------------------------------------------------------------------------
+	// Private Functions:
+	//------------------------------------------------------------------------------
+
+	// Find the lowest place in a page where a rectangle fits, and reserve it.
+	// Params:
+	//   page = The page to search.
+	//   width, height = The size of the rectangle, including padding.
+	//   x, y = (Out) The top-left corner of the reserved space.
+	// Returns:
+	//   True if the rectangle fits, false otherwise.
+	bool TextureAtlas::Insert(Page& page, unsigned width, unsigned height, unsigned& x, unsigned& y) const
+	{
+		Array<SkylineNode>& skyline = page.skyline;
+
+		// Pick the node where the rectangle's bottom edge would be lowest,
+		// preferring narrower nodes to leave wide gaps for larger images
+		unsigned bestIndex = static_cast<unsigned>(skyline.Size());
+		unsigned bestBottom = pageSize + 1;
+		unsigned bestWidth = pageSize + 1;
+		for (unsigned i = 0; i < skyline.Size(); ++i)
+		{
+			unsigned top;
+			if (!Fit(page, i, width, height, top))
+				continue;
+
+			unsigned bottom = top + height;
+			if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestWidth))
+			{
+				bestIndex = i;
+				bestBottom = bottom;
+				bestWidth = skyline[i].width;
+				y = top;
+			}
+		}
+
+		if (bestIndex == skyline.Size())
+			return false;
+
+		x = skyline[bestIndex].x;
+
+		// The rectangle's bottom edge becomes part of the skyline
+		SkylineNode node = { x, bestBottom, width };
+		skyline.PushBack(node);
+		for (unsigned i = static_cast<unsigned>(skyline.Size()) - 1; i > bestIndex; --i)
+			skyline[i] = skyline[i - 1];
+		skyline[bestIndex] = node;
+
+		// Trim or remove the nodes now covered by the rectangle
+		unsigned i = bestIndex + 1;
+		while (i < skyline.Size())
+		{
+			SkylineNode& previous = skyline[i - 1];
+			SkylineNode& current = skyline[i];
+			unsigned previousEnd = previous.x + previous.width;
+			if (current.x >= previousEnd)
+				break;
+
+			unsigned shrink = previousEnd - current.x;
+			if (current.width > shrink)
+			{
+				current.x += shrink;
+				current.width -= shrink;
+				break;
+			}
+
+			skyline.Erase(skyline.Begin() + i);
+		}
+
+		// Merge neighbors at the same height
+		for (i = 0; i + 1 < skyline.Size();)
+		{
+			if (skyline[i].y == skyline[i + 1].y)
+			{
+				skyline[i].width += skyline[i + 1].width;
+				skyline.Erase(skyline.Begin() + i + 1);
+			}
+			else
+				++i;
+		}
+
+		return true;
+	}
+
+	// Find the top of the skyline under a rectangle that starts at a node.
+	// Returns false if the rectangle would stick out of the page.
+	bool TextureAtlas::Fit(const Page& page, unsigned index, unsigned width, unsigned height, unsigned& y) const
+	{
+		const Array<SkylineNode>& skyline = page.skyline;
+
+		unsigned x = skyline[index].x;
+		if (x + width > pageSize)
+			return false;
+
+		// The rectangle rests on the highest node it spans
+		y = 0;
+		unsigned remaining = width;
+		for (unsigned i = index; remaining > 0 && i < skyline.Size(); ++i)
+		{
+			y = std::max(y, skyline[i].y);
+			if (y + height > pageSize)
+				return false;
+
+			remaining -= std::min(remaining, skyline[i].width);
+		}
+
+		return true;
+	}
+
+	// Add an empty page.
+	TextureAtlas::Page& TextureAtlas::AddPage()
+	{
+		Page page;
+		page.texture.reset(Texture::CreateEmptyTexture(pageSize, pageSize,
+			"Atlas" + std::to_string(pages.Size()), mode));
+
+		// The whole page starts out empty
+		SkylineNode node = { 0, 0, pageSize };
+		page.skyline.PushBack(node);
+
+		pages.PushBack(page);
+		return pages.Back();
+	}
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+//
+// File Name:	UniformBuffer.cpp
+// Author(s):	agent (agent@local)
+// Project:		Beta Engine
+// Course:		WANIC VGP2
+//
+// Copyright  2026 DigiPen (USA) Corporation.
+//
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Include Files:
+//------------------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "UniformBuffer.h"
+
+// Libraries
+#include <glad.h>
+
+// Systems
+#include "ShaderProgram.h"	// CountUpload
+
+#include "Array.h"
+
+//------------------------------------------------------------------------------
+
+namespace Beta
+{
+	//------------------------------------------------------------------------------
+	// Private Variables:
+	//------------------------------------------------------------------------------
+
+	namespace
+	{
+		// Buffers that exist, indexed by binding point (nullptr if the point is free)
+		Array<const UniformBuffer*> buffers;
+	}
+
+	//------------------------------------------------------------------------------
+	// Public Functions:
+	//------------------------------------------------------------------------------
+
+	// Constructor - Creates the buffer and assigns it a binding point.
+	// Programs linked after this will use the buffer for the block automatically.
+	// Params:
+	//   blockName = The name of the uniform block in the shaders.
+	//   size = The size of the block, in bytes.
+	UniformBuffer::UniformBuffer(const std::string& blockName, size_t size)
+		: blockName(blockName), size(size), id(0), bindingPoint(0)
+	{
+		unsigned existing;
+		if (FindBindingPoint(blockName, existing))
+		{
+			std::cout << "ERROR in UniformBuffer: A buffer for block " << blockName
+				<< " already exists; shaders will keep using the first one." << std::endl;
+		}
+
+		// Use the first free binding point
+		while (bindingPoint < buffers.Size() && buffers[bindingPoint] != nullptr)
+			++bindingPoint;
+		if (bindingPoint == buffers.Size())
+			buffers.PushBack(this);
+		else
+			buffers[bindingPoint] = this;
+
+		glGenBuffers(1, &id);
+		glBindBuffer(GL_UNIFORM_BUFFER, id);
+		glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, id);
+	}
+
+	// Destructor - Frees the buffer and its binding point.
+	UniformBuffer::~UniformBuffer()
+	{
+		buffers[bindingPoint] = nullptr;
+		glDeleteBuffers(1, &id);
+	}
+
+	// Send data to part of the buffer.
+	// Params:
+	//   data = The values to send.
+	//   size = The number of bytes to send.
+	//   offset = Where the data starts in the block, in bytes.
+	void UniformBuffer::SetData(const void* data, size_t size_, size_t offset) const
+	{
+		if (offset + size_ > size)
+		{
+			std::cout << "ERROR in UniformBuffer: Data does not fit in block " << blockName << "." << std::endl;
+			return;
+		}
+
+		glBindBuffer(GL_UNIFORM_BUFFER, id);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset, size_, data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		ShaderProgram::CountUpload();
+	}
+
+	// Returns the name of the uniform block.
+	const std::string& UniformBuffer::GetBlockName() const
+	{
+		return blockName;
+	}
+
+	// Returns the binding point used by the buffer.
+	unsigned UniformBuffer::GetBindingPoint() const
+	{
+		return bindingPoint;
+	}
+
+	// Find the binding point of a buffer by its block name.
+	// Params:
+	//   blockName = The name of the uniform block in the shaders.
+	//   bindingPoint = Set to the binding point if a buffer is found.
+	// Returns:
+	//   True if a buffer exists for the block, false otherwise.
+	bool UniformBuffer::FindBindingPoint(const std::string& blockName, unsigned& bindingPoint)
+	{
+		for (unsigned i = 0; i < buffers.Size(); ++i)
+		{
+			if (buffers[i] != nullptr && buffers[i]->blockName == blockName)
+			{
+				bindingPoint = i;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+//------------------------------------------------------------------------------
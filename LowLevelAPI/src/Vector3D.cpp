@@ -16,8 +16,6 @@
 #include "stdafx.h"
 #include "Vector3D.h"
 
-#include "glm_include.h"
-
 #include "Vector2D.h"
 
 //------------------------------------------------------------------------------
@@ -29,35 +27,23 @@ namespace Beta
 	//------------------------------------------------------------------------------
 
 	Vector3D::Vector3D()
-		: data(new glm::vec3)
-	{
-
-	}
-
-	Vector3D::Vector3D(const Vector3D& other)
-		: data(new glm::vec3(*static_cast<glm::vec3*>(other.data)))
+		: data{ 0.0f, 0.0f, 0.0f }
 	{
 	}
 
 	Vector3D::Vector3D(float value)
-		: data(new glm::vec3(value))
+		: data{ value, value, value }
 	{
 	}
 
 	Vector3D::Vector3D(float x, float y, float z)
-		: data(new glm::vec3(x, y, z))
+		: data{ x, y, z }
 	{
 	}
 
 	Vector3D::Vector3D(const Vector2D& v, float z)
-		: data(new glm::vec3(v.x, v.y, z))
-	{
-	}
-
-	Vector3D::~Vector3D()
+		: data{ v.x, v.y, z }
 	{
-		glm::vec3* v = static_cast<glm::vec3*>(data);
-		delete v;
 	}
 }
 
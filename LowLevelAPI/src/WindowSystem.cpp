@@ -70,19 +70,14 @@ namespace Beta
 
 		// Set GLFW error callback
 		glfwSetErrorCallback(ErrorCallback);
-
-		// Attempt to initialize GLFW
-		if (!glfwInit())
-		{
-			std::cout << "ERROR: Failed to initialize GLFW!" << std::endl;
-		}
 	}
 
 	// Shutdown the WindowSystem (Windows, Event Handlers).
 	WindowSystem::~WindowSystem()
 	{
 		// Destroy the window
-		glfwDestroyWindow(glfwWindow);
+		if (glfwWindow != nullptr)
+			glfwDestroyWindow(glfwWindow);
 
 		// Terminate GLFW
 		glfwTerminate();
@@ -108,6 +103,10 @@ namespace Beta
 	// End the frame and draw
 	void WindowSystem::Draw()
 	{
+		// Nothing to present
+		if (glfwWindow == nullptr)
+			return;
+
 		// Handle messages
 		// handle windows message
 		// * do it outside the frame start => frame end so that it will not effect
@@ -123,6 +122,9 @@ namespace Beta
 	//   text = The string that the window title will be set to.
 	void WindowSystem::SetWindowTitle(const std::string & text)
 	{
+		if (glfwWindow == nullptr)
+			return;
+
 		glfwSetWindowTitle(glfwWindow, text.c_str());
 	}
 
@@ -132,6 +134,12 @@ namespace Beta
 		return winExists;
 	}
 
+	// Is the engine running without a window?
+	bool WindowSystem::IsHeadless() const
+	{
+		return systemInfo.headless;
+	}
+
 	// Test whether the application is in fullscreen mode.
 	bool WindowSystem::IsFullScreen() const
 	{
@@ -141,6 +149,13 @@ namespace Beta
 	// Sets whether the window is fullscreen.
 	void WindowSystem::SetFullScreen(bool fullscreen_)
 	{
+		// No monitor to switch to
+		if (glfwWindow == nullptr)
+		{
+			fullscreen = fullscreen_;
+			return;
+		}
+
 		// Get window width height
 		int width, height;
 		glfwGetWindowSize(glfwWindow, &width, &height);
@@ -178,6 +193,14 @@ namespace Beta
 	//   height = The new height of the window.
 	void WindowSystem::SetResolution(unsigned width, unsigned height)
 	{
+		// No window to resize
+		if (glfwWindow == nullptr)
+		{
+			systemInfo.windowWidth = width;
+			systemInfo.windowHeight = height;
+			return;
+		}
+
 		if (fullscreen)
 		{
 			// Get reolution of monitor
@@ -241,8 +264,26 @@ namespace Beta
 		// Print engine info to console
 		std::cout << "Beta Framework Low-Level API version: " << BE_LL_VERSION << std::endl << std::endl;
 
-		// Window creation
-		CreateWindowGLFW();
+		if (systemInfo.headless)
+		{
+			// No monitor, so native resolution falls back to the default size
+			StartupSettings defaults;
+			systemInfo.windowWidth = systemInfo.windowWidth == 0 ? defaults.windowWidth : systemInfo.windowWidth;
+			systemInfo.windowHeight = systemInfo.windowHeight == 0 ? defaults.windowHeight : systemInfo.windowHeight;
+
+			std::cout << "Running in headless mode - no window will be created." << std::endl;
+		}
+		else
+		{
+			// Attempt to initialize GLFW
+			if (!glfwInit())
+			{
+				std::cout << "ERROR: Failed to initialize GLFW!" << std::endl;
+			}
+
+			// Window creation
+			CreateWindowGLFW();
+		}
 
 		// Window currently exists
 		winExists = true;